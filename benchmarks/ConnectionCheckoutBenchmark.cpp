@@ -0,0 +1,64 @@
+// Checkout y devolución de conexiones del PostgresConnectionProvider con 1 a 64 hilos sobre
+// un pool fijo. No se ejecuta ninguna consulta: solo se mide el pool (bitmap de conexiones
+// ociosas, afinidad por hilo y, cuando hay más hilos que conexiones, la espera).
+//
+//   TOURNAMENT_DB_URL=postgresql://... POOL_SIZE=16 ./connection_checkout_benchmark
+#include "BenchmarkHarness.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include <cstdlib>
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main() {
+    const char* poolSizeValue = std::getenv("POOL_SIZE");
+    const size_t poolSize = poolSizeValue ? std::stoul(poolSizeValue) : 16;
+    const auto iterations = benchmark::Iterations(100000);
+
+    PostgresConnectionProvider provider(ConnectionPoolConfiguration{
+        .connectionString = benchmark::ConnectionString(),
+        .minSize = poolSize,
+        .maxSize = poolSize,
+        .acquireTimeout = std::chrono::milliseconds(30000)});
+
+    for (size_t threads : {1, 2, 4, 8, 16, 32, 64}) {
+        std::vector<std::vector<double>> samples(threads);
+        std::latch go(1);
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (size_t t = 0; t < threads; t++) {
+            workers.emplace_back([&, t] {
+                auto& own = samples[t];
+                own.reserve(iterations);
+                go.wait();
+                for (size_t i = 0; i < iterations; i++) {
+                    const auto start = std::chrono::steady_clock::now();
+                    {
+                        auto pooled = provider.Connection();
+                        [[maybe_unused]] volatile auto* connection = AsPostgres(pooled)->connection.get();
+                    }
+                    const auto end = std::chrono::steady_clock::now();
+                    own.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+                }
+            });
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        go.count_down();
+        for (auto& worker : workers) worker.join();
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<double> all;
+        all.reserve(threads * iterations);
+        for (const auto& own : samples) all.insert(all.end(), own.begin(), own.end());
+        const auto throughput = static_cast<double>(all.size()) / seconds;
+        benchmark::Print(benchmark::Summarize(
+            "Checkout+return x" + std::to_string(threads) + " threads (" + std::to_string(static_cast<long>(throughput)) + "/s)", all));
+    }
+
+    const auto metrics = provider.Metrics();
+    std::cout << "acquisitions=" << metrics.acquisitions << " exhausted=" << metrics.exhausted
+              << " maxWaitMicros=" << metrics.maxWaitMicros << std::endl;
+    return 0;
+}
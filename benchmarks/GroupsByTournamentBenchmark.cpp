@@ -0,0 +1,86 @@
+// Latencia de "grupos de un torneo" mientras crece la cantidad de grupos de otros torneos:
+// ReadAll + filtro en C++ (camino anterior de GroupDelegate::GetGroups) contra
+// GroupRepository::FindByTournamentId (filtro en SQL sobre idx_groups_tournament).
+// El segundo debe mantenerse plano; el primero crece con el tamaño de la tabla.
+//
+//   TOURNAMENT_DB_URL=postgresql://... ./groups_by_tournament_benchmark
+#include "BenchmarkHarness.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/StatementRegistry.hpp"
+#include "persistence/repository/GroupRepository.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include "domain/Group.hpp"
+#include <nlohmann/json.hpp>
+#include <pqxx/pqxx>
+#include <memory>
+
+namespace {
+    const std::string TargetTournament = "benchmark-groups-target";
+    const std::string OtherTournamentPrefix = "benchmark-groups-other-";
+
+    void InsertGroups(pqxx::connection& connection, size_t count, size_t offset) {
+        constexpr size_t BatchSize = 1000;
+        for (size_t start = 0; start < count; start += BatchSize) {
+            nlohmann::json groups = nlohmann::json::array();
+            for (size_t i = start; i < std::min(count, start + BatchSize); i++) {
+                // 8 grupos por torneo, como en la fase de grupos real
+                const auto tournament = OtherTournamentPrefix + std::to_string((offset + i) / 8);
+                groups.push_back({{"id", GenerateUuid()}, {"name", "Group " + std::to_string(i % 8)}, {"tournamentId", tournament}, {"teams", nlohmann::json::array()}});
+            }
+            pqxx::work tx(connection);
+            tx.exec_prepared(statements::group::InsertMany.name, groups.dump());
+            tx.commit();
+        }
+    }
+}
+
+int main() {
+    const auto connectionString = benchmark::ConnectionString();
+    pqxx::connection connection(connectionString);
+    StatementRegistry::PrepareAll(connection);
+
+    auto provider = std::make_shared<PostgresConnectionProvider>(connectionString, 1);
+    GroupRepository repository(provider);
+    const auto iterations = benchmark::Iterations(200);
+
+    for (int i = 0; i < 8; i++) {
+        domain::Group group("Group " + std::to_string(i));
+        group.TournamentId() = TargetTournament;
+        repository.Create(group);
+    }
+    {
+        pqxx::work tx(connection);
+        tx.exec("ANALYZE groups");
+        tx.commit();
+    }
+
+    size_t inserted = 0;
+    for (const size_t unrelated : {0, 1000, 10000, 100000}) {
+        InsertGroups(connection, unrelated - inserted, inserted);
+        inserted = unrelated;
+        {
+            pqxx::work tx(connection);
+            tx.exec("ANALYZE groups");
+            tx.commit();
+        }
+
+        const auto suffix = " (" + std::to_string(unrelated) + " other groups)";
+        // el recorrido completo es órdenes de magnitud más lento: menos iteraciones
+        benchmark::Print(benchmark::Run("ReadAll + filter" + suffix, std::max<size_t>(iterations / 10, 10), [&] {
+            size_t found = 0;
+            for (const auto& group : repository.ReadAll()) {
+                if (group->TournamentId() == TargetTournament) found++;
+            }
+            return found;
+        }, 5));
+        benchmark::Print(benchmark::Run("FindByTournamentId" + suffix, iterations, [&] {
+            return repository.FindByTournamentId(TargetTournament).size();
+        }));
+    }
+
+    pqxx::work tx(connection);
+    tx.exec_params("DELETE FROM groups WHERE document->>'tournamentId' = $1 OR document->>'tournamentId' LIKE $2",
+                   TargetTournament, OtherTournamentPrefix + "%");
+    tx.commit();
+    return 0;
+}
@@ -0,0 +1,153 @@
+// Sin base de datos: throughput de decodificar JSON en entidades del dominio con nlohmann
+// (json::parse + from_json, y json::accept antes en los POST) contra domain::json_reader (simdjson
+// on-demand, sin DOM). Los documentos son como los que devuelven las consultas: las filas de
+// MATCHES de un torneo de 104 partidos, la fila de GET /tournaments/<id>/full (grupos con sus
+// equipos y el arreglo de partidos) y los cuerpos de POST /teams, /tournaments y .../groups.
+//
+//   BENCHMARK_ITERATIONS=2000 ./json_parse_benchmark
+#include "BenchmarkHarness.hpp"
+#include "domain/Group.hpp"
+#include "domain/JsonReader.hpp"
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace {
+    constexpr size_t Groups = 8;
+    constexpr size_t TeamsPerGroup = 4;
+    constexpr size_t Matches = 104;
+
+    std::vector<domain::Match> MakeMatches(const std::string& tournamentId) {
+        std::vector<domain::Match> matches;
+        matches.reserve(Matches);
+        for (size_t i = 0; i < Matches; i++) {
+            domain::Match match(tournamentId, i < 48 ? domain::MatchPhase::GROUP_STAGE : domain::MatchPhase::ROUND_OF_16, static_cast<int>(i + 1));
+            match.Id() = GenerateUuid();
+            match.SetGroupId(GenerateUuid());
+            match.SetTeam1(GenerateUuid());
+            match.SetTeam2(GenerateUuid());
+            if (i % 2 == 0) match.SetScore(static_cast<int>(i % 4), static_cast<int>(i % 3));
+            if (i >= 48) match.SetNextMatchId(GenerateUuid());
+            matches.push_back(std::move(match));
+        }
+        return matches;
+    }
+
+    std::vector<domain::Group> MakeGroups(const std::string& tournamentId) {
+        std::vector<domain::Group> groups;
+        for (size_t g = 0; g < Groups; g++) {
+            domain::Group group("Grupo " + std::string(1, static_cast<char>('A' + g)), GenerateUuid());
+            group.TournamentId() = tournamentId;
+            for (size_t t = 0; t < TeamsPerGroup; t++) {
+                group.Teams().emplace_back(GenerateUuid(), "Selección " + std::to_string(g * TeamsPerGroup + t + 1));
+            }
+            groups.push_back(std::move(group));
+        }
+        return groups;
+    }
+
+    size_t TotalBytes(const std::vector<std::string>& documents) {
+        size_t bytes = 0;
+        for (const auto& document : documents) bytes += document.size();
+        return bytes;
+    }
+
+    // Corre la operación sobre todos los documentos por iteración e imprime también MB/s
+    template<typename Decode>
+    void Measure(const std::string& name, const std::vector<std::string>& documents, size_t iterations, Decode&& decode) {
+        const auto result = benchmark::Run(name, iterations, [&] {
+            for (const auto& document : documents) decode(document);
+        });
+        benchmark::Print(result);
+        const auto megabytesPerSecond = static_cast<double>(TotalBytes(documents)) / result.meanMicros;
+        std::cout << "    " << std::fixed << std::setprecision(1) << megabytesPerSecond << " MB/s, "
+                  << static_cast<double>(documents.size()) / result.meanMicros * 1e6 << " documentos/s" << std::endl;
+    }
+
+    template<typename T>
+    void FromNlohmann(const std::string& document, T& entity) {
+        from_json(nlohmann::json::parse(document), entity);
+    }
+
+    template<typename T>
+    void FromNlohmannArray(const std::string& document, std::vector<T>& entities) {
+        const auto items = nlohmann::json::parse(document);
+        entities.clear();
+        entities.reserve(items.size());
+        for (const auto& item : items) from_json(item, entities.emplace_back());
+    }
+
+    template<typename T>
+    void FromReader(const std::string& document, T& entity) {
+        if (!domain::json_reader::Read(document, entity)) throw std::runtime_error("Documento inválido: " + document);
+    }
+}
+
+int main() {
+    const auto iterations = benchmark::Iterations(2000);
+    const auto tournamentId = GenerateUuid();
+    const auto matches = MakeMatches(tournamentId);
+    const auto groups = MakeGroups(tournamentId);
+
+    // Filas de MATCHES: un documento por partido
+    std::vector<std::string> matchRows;
+    for (const auto& match : matches) matchRows.push_back(nlohmann::json(match).dump());
+
+    // Columnas groups y matches de la fila agregada
+    const std::vector<std::string> aggregate{nlohmann::json(groups).dump(), nlohmann::json(matches).dump()};
+
+    // Cuerpos de los POST
+    std::vector<std::string> bodies;
+    for (const auto& group : groups) {
+        bodies.push_back(nlohmann::json{{"name", group.Name()}}.dump());
+        for (const auto& team : group.Teams()) bodies.push_back(nlohmann::json{{"name", team.Name()}}.dump());
+    }
+
+    // Ambos caminos deben dar las mismas entidades
+    for (const auto& row : matchRows) {
+        domain::Match expected, actual;
+        FromNlohmann(row, expected);
+        FromReader(row, actual);
+        if (nlohmann::json(expected) != nlohmann::json(actual)) {
+            std::cerr << "Los partidos no coinciden: " << row << std::endl;
+            return 1;
+        }
+    }
+    std::vector<domain::Group> readGroups;
+    FromReader(aggregate[0], readGroups);
+    if (nlohmann::json(readGroups) != nlohmann::json(groups)) {
+        std::cerr << "Los grupos no coinciden" << std::endl;
+        return 1;
+    }
+
+    const auto matchesLabel = " (" + std::to_string(Matches) + " filas de MATCHES)";
+    domain::Match match;
+    Measure("nlohmann" + matchesLabel, matchRows, iterations, [&](const std::string& row) { FromNlohmann(row, match); });
+    Measure("json_reader" + matchesLabel, matchRows, iterations, [&](const std::string& row) { FromReader(row, match); });
+
+    const std::string aggregateLabel = " (fila de /tournaments/<id>/full)";
+    std::vector<domain::Group> groupList;
+    std::vector<domain::Match> matchList;
+    Measure("nlohmann" + aggregateLabel, aggregate, iterations, [&](const std::string& document) {
+        if (&document == &aggregate[0]) FromNlohmannArray(document, groupList); else FromNlohmannArray(document, matchList);
+    });
+    Measure("json_reader" + aggregateLabel, aggregate, iterations, [&](const std::string& document) {
+        if (&document == &aggregate[0]) FromReader(document, groupList); else FromReader(document, matchList);
+    });
+
+    const auto bodiesLabel = " (" + std::to_string(bodies.size()) + " cuerpos de POST)";
+    domain::Team team;
+    Measure("accept + parse" + bodiesLabel, bodies, iterations, [&](const std::string& body) {
+        if (!nlohmann::json::accept(body)) throw std::runtime_error("Cuerpo inválido");
+        FromNlohmann(body, team);
+    });
+    Measure("json_reader" + bodiesLabel, bodies, iterations, [&](const std::string& body) { FromReader(body, team); });
+    return 0;
+}
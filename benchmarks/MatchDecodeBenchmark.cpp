@@ -0,0 +1,96 @@
+// Costo de convertir filas en domain::Match: documento JSONB de MATCHES (json::parse + from_json)
+// contra columnas tipadas de MATCH_RECORDS (TypedMatchRepository::Decode). El resultado se lee
+// una sola vez y solo se mide la conversión, para separarla de la red y del servidor; después
+// se mide FindByTournamentId completo con cada repositorio.
+//
+//   TOURNAMENT_DB_URL=postgresql://... ./match_decode_benchmark
+#include "BenchmarkHarness.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/StatementRegistry.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include "persistence/repository/MatchRepository.hpp"
+#include "persistence/repository/TeamRepository.hpp"
+#include "persistence/repository/TypedMatchRepository.hpp"
+#include "domain/Match.hpp"
+#include <nlohmann/json.hpp>
+#include <pqxx/pqxx>
+#include <memory>
+
+namespace {
+    constexpr size_t Rows = 1000;
+
+    pqxx::result Fetch(pqxx::connection& connection, const PreparedStatement& statement, const std::string& tournamentId) {
+        pqxx::work tx(connection);
+        auto result = tx.exec_prepared(statement.name, tournamentId, PageRequest{}.AfterOrFirst(), std::optional<size_t>{});
+        tx.commit();
+        return result;
+    }
+}
+
+int main() {
+    const auto connectionString = benchmark::ConnectionString();
+    pqxx::connection connection(connectionString);
+    StatementRegistry::PrepareAll(connection);
+    StatementRegistry::Prepare(connection, StatementRegistry::MatchRecords);
+
+    auto provider = std::make_shared<PostgresConnectionProvider>(connectionString, 1);
+    TeamRepository teams(provider);
+    repository::MatchRepository documents(provider);
+    repository::TypedMatchRepository records(provider);
+    const auto iterations = benchmark::Iterations(200);
+
+    // MATCH_RECORDS exige UUIDs y equipos existentes
+    const auto team1 = teams.Create(domain::Team{"", "Benchmark decode 1"}).value();
+    const auto team2 = teams.Create(domain::Team{"", "Benchmark decode 2"}).value();
+    const auto tournamentId = GenerateUuid();
+    std::vector<domain::Match> matches;
+    matches.reserve(Rows);
+    for (size_t i = 0; i < Rows; i++) {
+        domain::Match match(tournamentId, domain::MatchPhase::GROUP_STAGE, static_cast<int>(i % 6) + 1);
+        match.SetGroupId(GenerateUuid());
+        match.SetTeam1(team1);
+        match.SetTeam2(team2);
+        if (i % 2 == 0) match.SetScore(static_cast<int>(i % 5), 1);
+        matches.push_back(match);
+    }
+    documents.CreateMany(matches);
+    records.CreateMany(matches);
+
+    const auto documentRows = Fetch(connection, statements::match::FindByTournamentId, tournamentId);
+    const auto typedRows = Fetch(connection, statements::match_record::FindByTournamentId, tournamentId);
+    const auto label = " x" + std::to_string(documentRows.size()) + " rows";
+
+    benchmark::Print(benchmark::Run("Decode JSONB document" + label, iterations, [&] {
+        std::vector<domain::Match> decoded;
+        decoded.reserve(documentRows.size());
+        for (const auto& row : documentRows) {
+            auto& match = decoded.emplace_back();
+            from_json(nlohmann::json::parse(row["document"].c_str()), match);
+            match.Id() = row["id"].c_str();
+        }
+    }));
+    benchmark::Print(benchmark::Run("Decode typed columns" + label, iterations, [&] {
+        std::vector<domain::Match> decoded;
+        decoded.reserve(typedRows.size());
+        for (const auto& row : typedRows) {
+            decoded.push_back(repository::TypedMatchRepository::Decode(row));
+        }
+    }));
+
+    benchmark::Print(benchmark::Run("FindByTournamentId (MatchRepository)" + label, iterations, [&] {
+        documents.FindByTournamentId(tournamentId);
+    }));
+    benchmark::Print(benchmark::Run("FindByTournamentId (TypedMatchRepository)" + label, iterations, [&] {
+        records.FindByTournamentId(tournamentId);
+    }));
+
+    {
+        pqxx::work tx(connection);
+        tx.exec_params("DELETE FROM match_records WHERE tournament_id = $1", tournamentId);
+        tx.exec_params("DELETE FROM matches WHERE document->>'tournamentId' = $1", tournamentId);
+        tx.commit();
+    }
+    teams.Delete(team1);
+    teams.Delete(team2);
+    return 0;
+}
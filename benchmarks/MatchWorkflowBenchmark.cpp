@@ -0,0 +1,46 @@
+// Latencia de los dos flujos de escritura de partidos, antes y después de agruparlos en lote:
+//   - registrar resultado: ReadById + Update  vs  UpdateById (2 idas y vueltas, 1 checkout)
+//   - siguiente partido de playoffs: Save (Create + ReadById) + Update  vs  CreateLinked (2 idas y vueltas)
+// El camino "antes" es la implementación por defecto de IMatchRepository, que encadena las
+// llamadas individuales igual que lo hacían MatchService y MatchEventHandler.
+//
+//   TOURNAMENT_DB_URL=postgresql://... ./match_workflow_benchmark
+#include "BenchmarkHarness.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/repository/MatchRepository.hpp"
+#include "domain/Match.hpp"
+#include <memory>
+
+int main() {
+    auto provider = std::make_shared<PostgresConnectionProvider>(benchmark::ConnectionString(), 1);
+    repository::MatchRepository repository(provider);
+    const auto iterations = benchmark::Iterations(1000);
+    const std::string tournamentId = "benchmark-workflow-tournament";
+
+    domain::Match scored(tournamentId, domain::MatchPhase::QUARTERFINALS, 1);
+    scored.Team1Id() = "team-a";
+    scored.Team2Id() = "team-b";
+    scored = repository.Save(scored);
+    int goals = 0;
+    const auto setScore = [&goals](domain::Match& match) { match.SetScore(++goals % 5, 0); };
+
+    benchmark::Print(benchmark::Run("RegisterMatchResult (ReadById + Update)", iterations, [&] {
+        repository.IMatchRepository::UpdateById(scored.Id(), setScore);
+    }));
+    benchmark::Print(benchmark::Run("RegisterMatchResult (UpdateById, pipelined)", iterations, [&] {
+        repository.UpdateById(scored.Id(), setScore);
+    }));
+
+    const domain::Match next(tournamentId, domain::MatchPhase::SEMIFINALS, 1);
+    benchmark::Print(benchmark::Run("CreateAndAssignNextMatch (Save + Update)", iterations, [&] {
+        repository.IMatchRepository::CreateLinked(next, scored);
+    }));
+    benchmark::Print(benchmark::Run("CreateAndAssignNextMatch (CreateLinked, pipelined)", iterations, [&] {
+        repository.CreateLinked(next, scored);
+    }));
+
+    for (const auto& match : repository.FindByTournamentId(tournamentId)) {
+        repository.Delete(match->Id());
+    }
+    return 0;
+}
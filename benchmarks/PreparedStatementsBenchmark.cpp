@@ -0,0 +1,54 @@
+// Compara el camino exec_params (SQL como texto en cada request) contra exec_prepared
+// (sentencias del StatementRegistry preparadas una vez por conexión).
+//
+//   TOURNAMENT_DB_URL=postgresql://... ./prepared_statements_benchmark
+#include "BenchmarkHarness.hpp"
+#include "persistence/configuration/StatementRegistry.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include "persistence/repository/PageRequest.hpp"
+#include <nlohmann/json.hpp>
+#include <pqxx/pqxx>
+
+int main() {
+    pqxx::connection connection(benchmark::ConnectionString());
+    StatementRegistry::PrepareAll(connection);
+    const auto iterations = benchmark::Iterations(2000);
+
+    std::string teamId;
+    std::string tournamentId = "benchmark-tournament";
+    {
+        pqxx::work tx(connection);
+        teamId = GenerateUuid();
+        nlohmann::json team = {{"id", teamId}, {"name", "Benchmark Team"}};
+        tx.exec_prepared(statements::team::Insert.name, teamId, team.dump());
+        for (int i = 0; i < 64; i++) {
+            const auto matchId = GenerateUuid();
+            nlohmann::json match = {{"id", matchId}, {"tournamentId", tournamentId}, {"phase", "GROUP_STAGE"}, {"status", "PENDING"}, {"matchNumber", i}};
+            tx.exec_prepared(statements::match::Insert.name, matchId, match.dump());
+        }
+        tx.commit();
+    }
+
+    const auto compare = [&](const PreparedStatement& statement, const auto&... parameters) {
+        benchmark::Print(benchmark::Run(std::string(statement.name) + " (exec_params)", iterations, [&] {
+            pqxx::work tx(connection);
+            tx.exec_params(statement.sql, parameters...);
+            tx.commit();
+        }));
+        benchmark::Print(benchmark::Run(std::string(statement.name) + " (exec_prepared)", iterations, [&] {
+            pqxx::work tx(connection);
+            tx.exec_prepared(statement.name, parameters...);
+            tx.commit();
+        }));
+    };
+
+    compare(statements::team::ReadById, teamId);
+    compare(statements::match::FindByTournamentId, tournamentId, PageRequest{}.AfterOrFirst(), PageRequest{}.limit);
+    compare(statements::match::IsGroupStageComplete, tournamentId);
+
+    pqxx::work tx(connection);
+    tx.exec_prepared(statements::team::Delete.name, teamId);
+    tx.exec_params("DELETE FROM matches WHERE document->>'tournamentId' = $1", tournamentId);
+    tx.commit();
+    return 0;
+}
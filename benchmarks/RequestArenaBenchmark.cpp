@@ -0,0 +1,159 @@
+// Asignaciones y latencia de GET /tournaments/<id>/matches sin base de datos: se decodifican
+// las filas (id + documento JSONB, como las devuelve la consulta) y se arma el cuerpo.
+// "antes": un make_shared por partido, vector normal, DOM de nlohmann para la respuesta y dump().
+// "RequestArena": partidos y vector en la arena de la petición y cuerpo escrito sin DOM
+// (MatchController::GetMatchesByTournament). Las asignaciones se cuentan reemplazando
+// operator new en este ejecutable; también se mide con varios hilos a la vez.
+//
+//   MATCHES=104 ./request_arena_benchmark
+#include "BenchmarkHarness.hpp"
+#include "domain/JsonWriter.hpp"
+#include "domain/Match.hpp"
+#include "memory/RequestArena.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <latch>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace {
+    std::atomic<size_t> allocations{0};
+}
+
+void* operator new(size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) return pointer;
+    throw std::bad_alloc();
+}
+void* operator new(size_t size, std::align_val_t alignment) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    const auto align = static_cast<size_t>(alignment);
+    if (void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align)) return pointer;
+    throw std::bad_alloc();
+}
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { std::free(pointer); }
+
+namespace {
+    struct Row {
+        std::string id;
+        std::string document;
+    };
+
+    std::vector<Row> MakeRows(size_t count) {
+        const auto tournamentId = GenerateUuid();
+        std::vector<Row> rows;
+        rows.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            domain::Match match(tournamentId, i < 48 ? domain::MatchPhase::GROUP_STAGE : domain::MatchPhase::ROUND_OF_16, static_cast<int>(i + 1));
+            match.SetGroupId(GenerateUuid());
+            match.SetTeam1(GenerateUuid());
+            match.SetTeam2(GenerateUuid());
+            if (i % 2 == 0) match.SetScore(static_cast<int>(i % 4), static_cast<int>(i % 3));
+            if (i >= 48) match.SetNextMatchId(GenerateUuid());
+            rows.push_back({GenerateUuid(), nlohmann::json(match).dump()});
+        }
+        return rows;
+    }
+
+    std::string BeforeRequest(const std::vector<Row>& rows) {
+        std::vector<std::shared_ptr<domain::Match>> matches;
+        for (const auto& row : rows) {
+            nlohmann::json matchDoc = nlohmann::json::parse(row.document);
+            auto match = std::make_shared<domain::Match>();
+            from_json(matchDoc, *match);
+            match->Id() = row.id;
+            matches.push_back(match);
+        }
+        nlohmann::json responseBody = matches;
+        return responseBody.dump();
+    }
+
+    std::string ArenaRequest(const std::vector<Row>& rows) {
+        RequestArena arena;
+        std::pmr::vector<std::shared_ptr<domain::Match>> matches(arena.Resource());
+        matches.reserve(rows.size());
+        const std::pmr::polymorphic_allocator<domain::Match> allocator(arena.Resource());
+        for (const auto& row : rows) {
+            auto match = std::allocate_shared<domain::Match>(allocator);
+            from_json(nlohmann::json::parse(row.document), *match);
+            match->Id() = row.id;
+            matches.push_back(std::move(match));
+        }
+        std::string body;
+        body.reserve(matches.size() * 384 + 2);
+        domain::AppendJsonArray(body, matches);
+        return body;
+    }
+
+    template<typename Request>
+    double AllocationsPerRequest(Request&& request, const std::vector<Row>& rows) {
+        constexpr size_t Requests = 100;
+        request(rows); // calienta el bloque del hilo
+        const auto before = allocations.load();
+        for (size_t i = 0; i < Requests; i++) {
+            [[maybe_unused]] volatile auto size = request(rows).size();
+        }
+        return static_cast<double>(allocations.load() - before) / Requests;
+    }
+
+    template<typename Request>
+    void RunThreads(const std::string& name, size_t threads, size_t iterations, const std::vector<Row>& rows, Request&& request) {
+        std::vector<std::vector<double>> samples(threads);
+        std::latch go(1);
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; t++) {
+            workers.emplace_back([&, t] {
+                auto& own = samples[t];
+                own.reserve(iterations);
+                go.wait();
+                for (size_t i = 0; i < iterations; i++) {
+                    const auto start = std::chrono::steady_clock::now();
+                    [[maybe_unused]] volatile auto size = request(rows).size();
+                    own.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+                }
+            });
+        }
+        const auto start = std::chrono::steady_clock::now();
+        go.count_down();
+        for (auto& worker : workers) worker.join();
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<double> all;
+        for (const auto& own : samples) all.insert(all.end(), own.begin(), own.end());
+        const auto throughput = static_cast<double>(all.size()) / seconds;
+        benchmark::Print(benchmark::Summarize(
+            name + " x" + std::to_string(threads) + " threads (" + std::to_string(static_cast<long>(throughput)) + "/s)", all));
+    }
+}
+
+int main() {
+    const char* matchesValue = std::getenv("MATCHES");
+    const size_t matchCount = matchesValue ? std::stoul(matchesValue) : 104;
+    const auto iterations = benchmark::Iterations(2000);
+    const auto rows = MakeRows(matchCount);
+
+    if (BeforeRequest(rows) != ArenaRequest(rows)) {
+        std::cerr << "Los cuerpos no coinciden" << std::endl;
+        return 1;
+    }
+
+    const auto label = " (" + std::to_string(matchCount) + " partidos)";
+    std::cout << "Asignaciones por petición, antes" << label << ": " << AllocationsPerRequest(BeforeRequest, rows) << std::endl;
+    std::cout << "Asignaciones por petición, RequestArena" << label << ": " << AllocationsPerRequest(ArenaRequest, rows) << std::endl;
+
+    benchmark::Print(benchmark::Run("Antes" + label, iterations, [&] { return BeforeRequest(rows); }));
+    benchmark::Print(benchmark::Run("RequestArena" + label, iterations, [&] { return ArenaRequest(rows); }));
+
+    const auto threads = std::max(2u, std::thread::hardware_concurrency());
+    RunThreads("Antes", threads, iterations, rows, BeforeRequest);
+    RunThreads("RequestArena", threads, iterations, rows, ArenaRequest);
+    return 0;
+}
@@ -0,0 +1,120 @@
+// Tabla de posiciones de un grupo y generación de la fase de grupos, sin base de datos.
+// "ids como texto" reproduce el cálculo anterior (std::map con claves std::string de 36
+// caracteres, que no caben en el SSO); "Uuid" es MatchEventHandler::ComputeStandings, e
+// "ids heredados" el mismo cálculo con ids que no son UUID ("team-1"), que se comparan como texto.
+//
+//   ./standings_benchmark
+#include "BenchmarkHarness.hpp"
+#include "domain/Group.hpp"
+#include "domain/IMatchStrategy.hpp"
+#include "domain/Uuid.hpp"
+#include "handlers/MatchEventHandler.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr size_t Groups = 8;
+    constexpr size_t TeamsPerGroup = 4;
+
+    struct TextResult {
+        std::string team1Id;
+        std::string team2Id;
+        int team1Score = 0;
+        int team2Score = 0;
+    };
+
+    struct TextStanding {
+        std::string teamId;
+        int wins = 0;
+        int pointsFor = 0;
+        int pointsAgainst = 0;
+        int draws = 0;
+        int losses = 0;
+        int matchesPlayed = 0;
+
+        bool operator<(const TextStanding& other) const {
+            if (wins != other.wins) return wins > other.wins;
+            if (pointsFor != other.pointsFor) return pointsFor > other.pointsFor;
+            return pointsAgainst < other.pointsAgainst;
+        }
+    };
+
+    std::vector<TextStanding> TextStandings(const std::vector<TextResult>& results) {
+        std::map<std::string, TextStanding> standings;
+        for (const auto& result : results) {
+            if (standings.find(result.team1Id) == standings.end()) standings[result.team1Id] = TextStanding{result.team1Id};
+            if (standings.find(result.team2Id) == standings.end()) standings[result.team2Id] = TextStanding{result.team2Id};
+            standings[result.team1Id].matchesPlayed++;
+            standings[result.team2Id].matchesPlayed++;
+            standings[result.team1Id].pointsFor += result.team1Score;
+            standings[result.team1Id].pointsAgainst += result.team2Score;
+            standings[result.team2Id].pointsFor += result.team2Score;
+            standings[result.team2Id].pointsAgainst += result.team1Score;
+            if (result.team1Score > result.team2Score) {
+                standings[result.team1Id].wins++;
+                standings[result.team2Id].losses++;
+            } else if (result.team2Score > result.team1Score) {
+                standings[result.team2Id].wins++;
+                standings[result.team1Id].losses++;
+            } else {
+                standings[result.team1Id].draws++;
+                standings[result.team2Id].draws++;
+            }
+        }
+        std::vector<TextStanding> sorted;
+        for (const auto& [teamId, standing] : standings) sorted.push_back(standing);
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    }
+}
+
+int main() {
+    const auto iterations = benchmark::Iterations(20000);
+
+    std::vector<domain::Group> groups;
+    std::vector<std::vector<TextResult>> textResults;
+    std::vector<std::vector<repository::MatchResult>> uuidResults;
+    std::vector<std::vector<repository::MatchResult>> legacyResults;
+    for (size_t g = 0; g < Groups; g++) {
+        auto& group = groups.emplace_back("Group " + std::to_string(g), GenerateUuid());
+        for (size_t t = 0; t < TeamsPerGroup; t++) {
+            group.Teams().emplace_back(GenerateUuid(), "Team " + std::to_string(t));
+        }
+        auto& text = textResults.emplace_back();
+        auto& uuids = uuidResults.emplace_back();
+        auto& legacy = legacyResults.emplace_back();
+        const auto& teams = group.Teams();
+        for (size_t i = 0; i < teams.size(); i++) {
+            for (size_t j = i + 1; j < teams.size(); j++) {
+                const int score1 = static_cast<int>((i * 3 + j) % 4);
+                const int score2 = static_cast<int>((j * 5 + i) % 3);
+                text.push_back({teams[i].Id(), teams[j].Id(), score1, score2});
+                uuids.push_back({*domain::Uuid::Parse(teams[i].Id()), *domain::Uuid::Parse(teams[j].Id()), score1, score2});
+                legacy.push_back(repository::MatchResult::FromText("team-" + std::to_string(g * TeamsPerGroup + i),
+                                                                   "team-" + std::to_string(g * TeamsPerGroup + j), score1, score2));
+            }
+        }
+    }
+
+    const auto label = " (" + std::to_string(Groups) + " groups x " + std::to_string(TeamsPerGroup) + " teams)";
+    size_t sink = 0;
+    benchmark::Print(benchmark::Run("Standings, ids como texto" + label, iterations, [&] {
+        for (const auto& results : textResults) sink += TextStandings(results).size();
+    }));
+    benchmark::Print(benchmark::Run("Standings, Uuid" + label, iterations, [&] {
+        for (const auto& results : uuidResults) sink += handlers::MatchEventHandler::ComputeStandings(results).size();
+    }));
+    benchmark::Print(benchmark::Run("Standings, ids heredados" + label, iterations, [&] {
+        for (const auto& results : legacyResults) sink += handlers::MatchEventHandler::ComputeStandings(results).size();
+    }));
+
+    domain::SingleEliminationStrategy strategy;
+    const auto tournamentId = GenerateUuid();
+    benchmark::Print(benchmark::Run("GenerateGroupStageMatches" + label, iterations, [&] {
+        sink += strategy.GenerateGroupStageMatches(groups, tournamentId).size();
+    }));
+
+    return sink == 0 ? 1 : 0;
+}
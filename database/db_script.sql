@@ -79,6 +79,12 @@ BEFORE UPDATE ON MATCHES
 FOR EACH ROW
 EXECUTE FUNCTION trigger_set_timestamp();
 
+-- ====================================
+-- Migraciones
+-- ====================================
+-- Los cambios posteriores al esquema base viven en database/migrations/ (V<versión>__<nombre>.sql),
+-- se aplican en orden después de este script y registran su versión en SCHEMA_MIGRATIONS.
+
 -- ====================================
 -- Permisos
 -- ====================================
@@ -0,0 +1,53 @@
+-- ====================================
+-- U005: volver de MATCH_RECORDS a MATCHES
+-- ====================================
+-- Con "matchStorage": "typed" los partidos solo se escriben en MATCH_RECORDS, así que MATCHES
+-- se queda con lo que había al pasar a la tabla tipada. Este script devuelve a MATCHES cada
+-- fila de MATCH_RECORDS como documento (mismo formato que to_json de domain::Match) y borra
+-- los documentos de los partidos que ya no existen en la tabla tipada. No toca MATCH_RECORDS
+-- ni SCHEMA_MIGRATIONS: se puede aplicar más de una vez y volver a "typed" después.
+--
+-- Camino de vuelta:
+--   1. detener el consumer y el servicio REST;
+--   2. aplicar este script;
+--   3. arrancar ambos con "matchStorage": "document" en databaseConfig.
+--   psql -d tournament_db -v ON_ERROR_STOP=1 -f database/migrations/U005__typed_matches.sql
+--
+-- No lleva prefijo V para que el ciclo que aplica las migraciones (V*.sql) no lo ejecute.
+
+BEGIN;
+
+-- El borrado de abajo supone que V005 terminó su copia (la versión se registra al final)
+DO $$
+BEGIN
+    IF NOT EXISTS (SELECT 1 FROM SCHEMA_MIGRATIONS WHERE version = 5) THEN
+        RAISE EXCEPTION 'V005 no está aplicada: MATCHES sigue siendo la única copia de los partidos';
+    END IF;
+END
+$$;
+
+INSERT INTO MATCHES (id, document)
+SELECT r.id,
+       jsonb_build_object(
+           'id', r.id::text,
+           'tournamentId', r.tournament_id::text,
+           'groupId', COALESCE(r.group_id::text, ''),
+           'phase', r.phase::text,
+           'matchNumber', r.match_number,
+           'team1Id', r.team1_id::text,
+           'team2Id', r.team2_id::text,
+           'team1Score', r.team1_score,
+           'team2Score', r.team2_score,
+           'status', r.status::text,
+           'nextMatchId', r.next_match_id::text)
+FROM MATCH_RECORDS r
+ON CONFLICT (id) DO UPDATE SET document = EXCLUDED.document
+WHERE MATCHES.document IS DISTINCT FROM EXCLUDED.document;
+
+-- V005 copió todo MATCHES a MATCH_RECORDS: lo que falta en la tabla tipada se borró allí
+DELETE FROM MATCHES m
+WHERE NOT EXISTS (SELECT 1 FROM MATCH_RECORDS r WHERE r.id = m.id);
+
+COMMIT;
+
+ANALYZE MATCHES;
@@ -0,0 +1,43 @@
+-- ====================================
+-- V002: índices para los finders de MatchRepository
+-- ====================================
+-- Los finders filtran por expresiones (document->>'tournamentId', ...) que el índice
+-- GIN sobre el documento completo no puede usar con igualdad. Cada índice termina en
+-- id para servir también el ORDER BY id LIMIT de la paginación por cursor.
+--
+-- CONCURRENTLY no bloquea las escrituras, pero no puede ejecutarse dentro de una
+-- transacción: aplicar con psql sin --single-transaction.
+--   psql -d tournament_db -f database/migrations/V002__match_finder_indexes.sql
+-- Si una creación concurrente falla, el índice queda INVALID y IF NOT EXISTS no lo
+-- reconstruye: eliminarlo con DROP INDEX CONCURRENTLY y volver a aplicar.
+
+CREATE TABLE IF NOT EXISTS SCHEMA_MIGRATIONS (
+    version INT PRIMARY KEY,
+    description TEXT NOT NULL,
+    applied_at TIMESTAMPTZ NOT NULL DEFAULT CURRENT_TIMESTAMP
+);
+
+-- FindByTournamentId
+CREATE INDEX CONCURRENTLY IF NOT EXISTS idx_matches_tournament
+    ON MATCHES ((document->>'tournamentId'), id);
+
+-- FindByTournamentIdAndPhase, IsGroupStageComplete
+CREATE INDEX CONCURRENTLY IF NOT EXISTS idx_matches_tournament_phase
+    ON MATCHES ((document->>'tournamentId'), (document->>'phase'), id);
+
+-- FindByGroupId
+CREATE INDEX CONCURRENTLY IF NOT EXISTS idx_matches_group
+    ON MATCHES ((document->>'groupId'), id);
+
+-- FindByTeamId: una rama del UNION ALL por cada columna de equipo
+CREATE INDEX CONCURRENTLY IF NOT EXISTS idx_matches_team1
+    ON MATCHES ((document->>'team1Id'), id);
+CREATE INDEX CONCURRENTLY IF NOT EXISTS idx_matches_team2
+    ON MATCHES ((document->>'team2Id'), id);
+
+-- Estadísticas de las expresiones nuevas para que el planificador las considere
+ANALYZE MATCHES;
+
+INSERT INTO SCHEMA_MIGRATIONS (version, description)
+VALUES (2, 'match finder indexes')
+ON CONFLICT (version) DO NOTHING;
@@ -0,0 +1,15 @@
+-- ====================================
+-- V003: índice para los grupos de un torneo
+-- ====================================
+-- GroupRepository::FindByTournamentId y ReadPageByTournamentId filtran por
+-- document->>'tournamentId' y ordenan por id. Ver V002 para las notas sobre CONCURRENTLY.
+--   psql -d tournament_db -f database/migrations/V003__group_tournament_index.sql
+
+CREATE INDEX CONCURRENTLY IF NOT EXISTS idx_groups_tournament
+    ON GROUPS ((document->>'tournamentId'), id);
+
+ANALYZE GROUPS;
+
+INSERT INTO SCHEMA_MIGRATIONS (version, description)
+VALUES (3, 'group tournament index')
+ON CONFLICT (version) DO NOTHING;
@@ -0,0 +1,37 @@
+-- ====================================
+-- V004: notificaciones de cambios para invalidar cachés entre réplicas
+-- ====================================
+-- Cada escritura sobre TEAMS y TOURNAMENTS publica '<tabla>:<id>' en el canal
+-- entity_changed. NOTIFY es transaccional: se entrega al confirmar y se descarta en un
+-- rollback. El trigger cubre también COPY y las escrituras del consumer.
+--   psql -d tournament_db -f database/migrations/V004__entity_change_notifications.sql
+
+CREATE OR REPLACE FUNCTION notify_entity_change()
+RETURNS TRIGGER AS $$
+BEGIN
+    IF TG_OP = 'DELETE' THEN
+        PERFORM pg_notify('entity_changed', TG_TABLE_NAME || ':' || OLD.id::text);
+    ELSE
+        PERFORM pg_notify('entity_changed', TG_TABLE_NAME || ':' || NEW.id::text);
+    END IF;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+DROP TRIGGER IF EXISTS notify_teams_change ON TEAMS;
+CREATE TRIGGER notify_teams_change
+AFTER INSERT OR UPDATE OR DELETE ON TEAMS
+FOR EACH ROW
+EXECUTE FUNCTION notify_entity_change();
+
+DROP TRIGGER IF EXISTS notify_tournaments_change ON TOURNAMENTS;
+CREATE TRIGGER notify_tournaments_change
+AFTER INSERT OR UPDATE OR DELETE ON TOURNAMENTS
+FOR EACH ROW
+EXECUTE FUNCTION notify_entity_change();
+
+GRANT EXECUTE ON FUNCTION notify_entity_change() TO tournament_svc;
+
+INSERT INTO SCHEMA_MIGRATIONS (version, description)
+VALUES (4, 'entity change notifications')
+ON CONFLICT (version) DO NOTHING;
@@ -0,0 +1,109 @@
+-- ====================================
+-- V005: partidos en columnas tipadas (MATCH_RECORDS)
+-- ====================================
+-- Cada columna del documento de MATCHES pasa a su propio tipo: leer un partido ya no
+-- requiere parsear JSON y actualizar un marcador no reescribe el documento completo.
+-- TypedMatchRepository usa esta tabla; MatchRepository sigue usando MATCHES.
+--
+-- Camino de migración:
+--   1. aplicar este script (crea la tabla y copia MATCHES);
+--   2. detener el consumer, volver a aplicarlo para copiar lo escrito mientras tanto
+--      (el INSERT ... ON CONFLICT lo hace idempotente);
+--   3. arrancar el consumer y el servicio REST con "matchStorage": "typed" en databaseConfig.
+-- Desde ese momento los partidos solo se escriben en MATCH_RECORDS y MATCHES deja de
+-- actualizarse. Para volver a "document" hay que aplicar antes U005__typed_matches.sql, que
+-- devuelve a MATCHES lo escrito en la tabla tipada.
+--   psql -d tournament_db -f database/migrations/V005__typed_matches.sql
+--
+-- La copia falla entera si algún documento tiene ids que no son UUID o equipos que no
+-- existen en TEAMS; para encontrarlos:
+--   SELECT id FROM MATCHES WHERE document->>'team1Id' IS NOT NULL
+--     AND NOT EXISTS (SELECT 1 FROM TEAMS t WHERE t.id::text = document->>'team1Id');
+
+DO $$
+BEGIN
+    CREATE TYPE match_phase AS ENUM ('GROUP_STAGE', 'ROUND_OF_16', 'QUARTERFINALS', 'SEMIFINALS', 'FINALS');
+EXCEPTION WHEN duplicate_object THEN NULL;
+END
+$$;
+
+DO $$
+BEGIN
+    CREATE TYPE match_status AS ENUM ('PENDING', 'COMPLETED');
+EXCEPTION WHEN duplicate_object THEN NULL;
+END
+$$;
+
+CREATE TABLE IF NOT EXISTS MATCH_RECORDS (
+    id UUID PRIMARY KEY DEFAULT uuid_generate_v4(),
+    tournament_id UUID NOT NULL,
+    group_id UUID,
+    phase match_phase NOT NULL,
+    match_number SMALLINT NOT NULL,
+    team1_id UUID REFERENCES TEAMS(id),
+    team2_id UUID REFERENCES TEAMS(id),
+    team1_score SMALLINT,
+    team2_score SMALLINT,
+    status match_status NOT NULL DEFAULT 'PENDING',
+    -- diferida: un lote puede enlazar un partido con otro que se inserta después
+    next_match_id UUID REFERENCES MATCH_RECORDS(id) ON DELETE SET NULL DEFERRABLE INITIALLY DEFERRED,
+    updated_at TIMESTAMPTZ NOT NULL DEFAULT CURRENT_TIMESTAMP
+);
+
+-- Equivalente de set_matches_timestamp: actualiza una columna, no el documento
+CREATE OR REPLACE FUNCTION trigger_set_updated_at()
+RETURNS TRIGGER AS $$
+BEGIN
+    NEW.updated_at = CURRENT_TIMESTAMP;
+    RETURN NEW;
+END;
+$$ LANGUAGE plpgsql;
+
+DROP TRIGGER IF EXISTS set_match_records_timestamp ON MATCH_RECORDS;
+CREATE TRIGGER set_match_records_timestamp
+BEFORE UPDATE ON MATCH_RECORDS
+FOR EACH ROW
+EXECUTE FUNCTION trigger_set_updated_at();
+
+GRANT EXECUTE ON FUNCTION trigger_set_updated_at() TO tournament_svc;
+GRANT ALL PRIVILEGES ON MATCH_RECORDS TO tournament_svc;
+
+-- Copia desde el documento; los campos ausentes toman los mismos valores por defecto que from_json
+INSERT INTO MATCH_RECORDS (id, tournament_id, group_id, phase, match_number, team1_id, team2_id,
+                           team1_score, team2_score, status, next_match_id)
+SELECT id,
+       (document->>'tournamentId')::uuid,
+       NULLIF(document->>'groupId', '')::uuid,
+       COALESCE(document->>'phase', 'GROUP_STAGE')::match_phase,
+       COALESCE((document->>'matchNumber')::smallint, 0),
+       (document->>'team1Id')::uuid,
+       (document->>'team2Id')::uuid,
+       (document->>'team1Score')::smallint,
+       (document->>'team2Score')::smallint,
+       COALESCE(document->>'status', 'PENDING')::match_status,
+       (document->>'nextMatchId')::uuid
+FROM MATCHES
+ON CONFLICT (id) DO UPDATE SET
+    tournament_id = EXCLUDED.tournament_id,
+    group_id = EXCLUDED.group_id,
+    phase = EXCLUDED.phase,
+    match_number = EXCLUDED.match_number,
+    team1_id = EXCLUDED.team1_id,
+    team2_id = EXCLUDED.team2_id,
+    team1_score = EXCLUDED.team1_score,
+    team2_score = EXCLUDED.team2_score,
+    status = EXCLUDED.status,
+    next_match_id = EXCLUDED.next_match_id;
+
+-- Los mismos accesos que los índices de V002, sobre columnas en lugar de expresiones
+CREATE INDEX IF NOT EXISTS idx_match_records_tournament ON MATCH_RECORDS (tournament_id, id);
+CREATE INDEX IF NOT EXISTS idx_match_records_tournament_phase ON MATCH_RECORDS (tournament_id, phase, id);
+CREATE INDEX IF NOT EXISTS idx_match_records_group ON MATCH_RECORDS (group_id, id);
+CREATE INDEX IF NOT EXISTS idx_match_records_team1 ON MATCH_RECORDS (team1_id, id);
+CREATE INDEX IF NOT EXISTS idx_match_records_team2 ON MATCH_RECORDS (team2_id, id);
+
+ANALYZE MATCH_RECORDS;
+
+INSERT INTO SCHEMA_MIGRATIONS (version, description)
+VALUES (5, 'typed match records')
+ON CONFLICT (version) DO NOTHING;
@@ -0,0 +1,34 @@
+-- ====================================
+-- V006: UUIDv7 como valor por omisión de las llaves primarias
+-- ====================================
+-- Los repositorios generan los ids en la aplicación (IdGenerator.hpp, UUIDv7) y los envían en
+-- el INSERT. Este script solo cambia el DEFAULT de las columnas id para que las filas creadas
+-- fuera del servicio (psql, scripts de carga) también sean ordenadas por tiempo y caigan al
+-- final del índice de la llave primaria. PostgreSQL 17 no trae uuidv7(), de ahí la función.
+--   psql -d tournament_db -f database/migrations/V006__uuidv7_defaults.sql
+
+CREATE OR REPLACE FUNCTION uuid_generate_v7() RETURNS uuid AS $$
+DECLARE
+    bytes BYTEA := uuid_send(gen_random_uuid());
+    millis BIGINT := floor(extract(epoch FROM clock_timestamp()) * 1000);
+BEGIN
+    -- 48 bits de milisegundos Unix
+    FOR i IN 0..5 LOOP
+        bytes := set_byte(bytes, i, ((millis >> ((5 - i) * 8)) & 255)::int);
+    END LOOP;
+    -- versión 7 y variante RFC 9562
+    bytes := set_byte(bytes, 6, (get_byte(bytes, 6) & 15) | 112);
+    bytes := set_byte(bytes, 8, (get_byte(bytes, 8) & 63) | 128);
+    RETURN encode(bytes, 'hex')::uuid;
+END
+$$ LANGUAGE plpgsql VOLATILE;
+
+ALTER TABLE TEAMS ALTER COLUMN id SET DEFAULT uuid_generate_v7();
+ALTER TABLE TOURNAMENTS ALTER COLUMN id SET DEFAULT uuid_generate_v7();
+ALTER TABLE GROUPS ALTER COLUMN id SET DEFAULT uuid_generate_v7();
+ALTER TABLE MATCHES ALTER COLUMN id SET DEFAULT uuid_generate_v7();
+ALTER TABLE MATCH_RECORDS ALTER COLUMN id SET DEFAULT uuid_generate_v7();
+
+INSERT INTO SCHEMA_MIGRATIONS (version, description)
+VALUES (6, 'uuidv7 id defaults')
+ON CONFLICT (version) DO NOTHING;
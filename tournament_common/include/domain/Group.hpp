@@ -9,19 +9,23 @@
 
 namespace domain {
     class Group {
+    public:
+        // Cupo de un grupo mientras el formato del torneo no lo persista
+        static constexpr int DefaultMaxTeams = 4;
+    private:
         std::string id;
         std::string name;
-        int maxTeams = 4;
+        int maxTeams = DefaultMaxTeams;
         std::string tournamentId;
         std::vector<Team> teams;
     public:
         explicit Group(const std::string_view & name = "", const std::string_view& id = "") : id(id), name(name) {}
 
-        [[nodiscard]] std::string Id() const { return id; }
+        [[nodiscard]] const std::string& Id() const { return id; }
         std::string& Id() { return id; }
-        [[nodiscard]] std::string Name() const { return name; }
+        [[nodiscard]] const std::string& Name() const { return name; }
         std::string& Name() { return name; }
-        [[nodiscard]] std::string TournamentId() const { return tournamentId; }
+        [[nodiscard]] const std::string& TournamentId() const { return tournamentId; }
         std::string& TournamentId() { return tournamentId; }
         [[nodiscard]] const std::vector<Team>& Teams() const { return teams; }
         std::vector<Team>& Teams() { return teams; }
@@ -0,0 +1,51 @@
+#ifndef DOMAIN_JSONREADER_HPP
+#define DOMAIN_JSONREADER_HPP
+
+#include <expected>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+
+// Lectura directa de JSON con el API on-demand de simdjson: cada campo se decodifica sobre la
+// entidad al recorrer el texto, sin construir el DOM de nlohmann. El resultado es el mismo que
+// from_json: mismas claves, mismos valores por defecto y las claves desconocidas se ignoran.
+//
+// El texto se copia a un búfer del hilo con el relleno que exige simdjson y el parser también es
+// del hilo, así que en régimen estable solo se asignan los strings de la entidad. A diferencia de
+// nlohmann::json::accept, el valor de una clave desconocida se salta sin validarlo a fondo.
+namespace domain::json_reader {
+
+    enum class ReadError {
+        InvalidJson,     // el texto no es JSON
+        InvalidDocument  // es JSON, pero no tiene la forma de la entidad (tipo incorrecto o falta un campo obligatorio)
+    };
+
+    using ReadResult = std::expected<void, ReadError>;
+
+    [[nodiscard]] ReadResult Read(std::string_view json, Match& match);
+    [[nodiscard]] ReadResult Read(std::string_view json, Group& group);
+    [[nodiscard]] ReadResult Read(std::string_view json, Team& team);
+    [[nodiscard]] ReadResult Read(std::string_view json, Tournament& tournament);
+
+    // Arreglos JSON; el vector se reemplaza y se reserva con el tamaño del arreglo
+    [[nodiscard]] ReadResult Read(std::string_view json, std::vector<Match>& matches);
+    [[nodiscard]] ReadResult Read(std::string_view json, std::vector<Group>& groups);
+    [[nodiscard]] ReadResult Read(std::string_view json, std::vector<Team>& teams);
+
+    // Para documentos que vienen de la base (JSONB, siempre válidos): un fallo es inesperado y se
+    // lanza como excepción, igual que lo hacía json::parse en los repositorios.
+    template<typename T>
+    void ReadDocument(std::string_view json, T& value) {
+        if (!Read(json, value)) {
+            throw std::runtime_error("Documento JSON inválido");
+        }
+    }
+
+} // namespace domain::json_reader
+
+#endif // DOMAIN_JSONREADER_HPP
@@ -0,0 +1,109 @@
+#ifndef DOMAIN_JSONWRITER_HPP
+#define DOMAIN_JSONWRITER_HPP
+
+#include <charconv>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "domain/Match.hpp"
+
+// Serialización directa a texto (std::string o std::pmr::string), sin construir el DOM de
+// nlohmann ni un string intermedio por elemento. La salida es la misma que
+// nlohmann::json(x).dump(): claves en orden alfabético y el mismo escapado. El texto de entrada
+// se asume UTF-8 válido (lo es todo lo que sale de JSONB); a diferencia de dump() no se valida.
+namespace domain::json_writer {
+
+    template<typename String>
+    void AppendString(String& out, std::string_view value) {
+        constexpr char hex[] = "0123456789abcdef";
+        out.push_back('"');
+        for (const char c : value) {
+            switch (c) {
+                case '"': out.append("\\\""); break;
+                case '\\': out.append("\\\\"); break;
+                case '\b': out.append("\\b"); break;
+                case '\t': out.append("\\t"); break;
+                case '\n': out.append("\\n"); break;
+                case '\f': out.append("\\f"); break;
+                case '\r': out.append("\\r"); break;
+                default:
+                    if (static_cast<unsigned char>(c) <= 0x1F) {
+                        out.append("\\u00");
+                        out.push_back(hex[(c >> 4) & 0x0F]);
+                        out.push_back(hex[c & 0x0F]);
+                    } else {
+                        out.push_back(c);
+                    }
+            }
+        }
+        out.push_back('"');
+    }
+
+    template<typename String>
+    void AppendInt(String& out, long long value) {
+        char buffer[24];
+        const auto end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+        out.append(buffer, end);
+    }
+
+    template<typename String>
+    void AppendOptional(String& out, const std::optional<std::string>& value) {
+        if (value) AppendString(out, *value); else out.append("null");
+    }
+
+    template<typename String>
+    void AppendOptional(String& out, const std::optional<int>& value) {
+        if (value) AppendInt(out, *value); else out.append("null");
+    }
+
+} // namespace domain::json_writer
+
+namespace domain {
+
+    // Mismo documento que to_json(nlohmann::json&, const Match&)
+    template<typename String>
+    void AppendJson(String& out, const Match& m) {
+        using namespace json_writer;
+        out.append("{\"groupId\":");
+        AppendString(out, m.GroupId());
+        out.append(",\"id\":");
+        AppendString(out, m.Id());
+        out.append(",\"matchNumber\":");
+        AppendInt(out, m.MatchNumber());
+        out.append(",\"nextMatchId\":");
+        AppendOptional(out, m.NextMatchId());
+        out.append(",\"phase\":");
+        AppendString(out, Match::PhaseToString(m.Phase()));
+        out.append(",\"status\":");
+        AppendString(out, Match::StatusToString(m.Status()));
+        out.append(",\"team1Id\":");
+        AppendOptional(out, m.Team1Id());
+        out.append(",\"team1Score\":");
+        AppendOptional(out, m.Team1Score());
+        out.append(",\"team2Id\":");
+        AppendOptional(out, m.Team2Id());
+        out.append(",\"team2Score\":");
+        AppendOptional(out, m.Team2Score());
+        out.append(",\"tournamentId\":");
+        AppendString(out, m.TournamentId());
+        out.push_back('}');
+    }
+
+    // Arreglo JSON de una lista de partidos; un puntero nulo se escribe como null
+    template<typename String, typename Matches>
+    void AppendJsonArray(String& out, const Matches& matches) {
+        out.push_back('[');
+        bool first = true;
+        for (const std::shared_ptr<Match>& match : matches) {
+            if (!first) out.push_back(',');
+            first = false;
+            if (match) AppendJson(out, *match); else out.append("null");
+        }
+        out.push_back(']');
+    }
+
+} // namespace domain
+
+#endif // DOMAIN_JSONWRITER_HPP
@@ -39,9 +39,9 @@ namespace domain {
 
         // --- Getters y Setters (Corregidos) ---
         // Getters (const) para leer
-        [[nodiscard]] std::string Id() const { return id; }
-        [[nodiscard]] std::string TournamentId() const { return tournamentId; }
-        [[nodiscard]] std::string GroupId() const { return groupId; }
+        [[nodiscard]] const std::string& Id() const { return id; }
+        [[nodiscard]] const std::string& TournamentId() const { return tournamentId; }
+        [[nodiscard]] const std::string& GroupId() const { return groupId; }
         [[nodiscard]] MatchPhase Phase() const { return phase; }
         [[nodiscard]] int MatchNumber() const { return matchNumber; }
         [[nodiscard]] const std::optional<std::string>& Team1Id() const { return team1Id; }
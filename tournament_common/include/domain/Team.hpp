@@ -17,8 +17,8 @@ namespace domain {
             Team(const std::string& id, const std::string& name) : id(id), name(name) {}
 
             // Getters
-            std::string Id() const { return id; }
-            std::string Name() const { return name; }
+            const std::string& Id() const { return id; }
+            const std::string& Name() const { return name; }
 
             // Setters
             void SetId(const std::string& id) { this->id = id; }
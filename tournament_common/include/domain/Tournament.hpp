@@ -51,14 +51,16 @@ namespace domain {
             this->name = name;
             this->format = format;
         }
-        [[nodiscard]] std::string Id() const { return this->id; }
+        [[nodiscard]] const std::string& Id() const { return this->id; }
         std::string& Id() { return this->id; }
-        [[nodiscard]] std::string Name() const { return this->name; }
+        [[nodiscard]] const std::string& Name() const { return this->name; }
         std::string& Name() { return this->name; }
         [[nodiscard]] const TournamentFormat& Format() const { return this->format; }
         TournamentFormat& Format() { return this->format; }
+        [[nodiscard]] const std::vector<Group>& Groups() const { return this->groups; }
         std::vector<Group>& Groups() { return this->groups; }
         [[nodiscard]] const std::vector<Match>& Matches() const { return this->matches; }
+        std::vector<Match>& Matches() { return this->matches; }
 
         bool operator==(const Tournament& other) const {
             return id == other.id && name == other.name && format == other.format;
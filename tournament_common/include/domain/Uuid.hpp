@@ -0,0 +1,110 @@
+#ifndef DOMAIN_UUID_HPP
+#define DOMAIN_UUID_HPP
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <nlohmann/json.hpp>
+
+namespace domain {
+
+    // Identificador de 16 bytes. Se copia y compara como un valor (sin memoria dinámica) y
+    // se ordena byte por byte, igual que el tipo uuid de PostgreSQL. Las entidades conservan
+    // su id como texto en los bordes (JSON, HTTP); Uuid es para los ciclos que comparan ids.
+    class Uuid {
+        std::array<uint8_t, 16> bytes{};
+
+        static constexpr int HexValue(char c) {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        }
+
+    public:
+        static constexpr size_t TextLength = 36;
+
+        constexpr Uuid() = default;
+        explicit constexpr Uuid(const std::array<uint8_t, 16>& bytes) : bytes(bytes) {}
+
+        // Forma canónica 8-4-4-4-12, en mayúsculas o minúsculas; nullopt si no lo es
+        static constexpr std::optional<Uuid> Parse(std::string_view text) {
+            if (text.size() != TextLength) return std::nullopt;
+            Uuid uuid;
+            size_t position = 0;
+            for (size_t i = 0; i < 16; i++) {
+                if (position == 8 || position == 13 || position == 18 || position == 23) {
+                    if (text[position] != '-') return std::nullopt;
+                    position++;
+                }
+                const int high = HexValue(text[position]);
+                const int low = HexValue(text[position + 1]);
+                if (high < 0 || low < 0) return std::nullopt;
+                uuid.bytes[i] = static_cast<uint8_t>((high << 4) | low);
+                position += 2;
+            }
+            return uuid;
+        }
+
+        // Escribe los 36 caracteres en minúsculas (sin terminador); devuelve el final
+        constexpr char* FormatTo(char* out) const {
+            constexpr char digits[] = "0123456789abcdef";
+            for (size_t i = 0; i < 16; i++) {
+                if (i == 4 || i == 6 || i == 8 || i == 10) *out++ = '-';
+                *out++ = digits[bytes[i] >> 4];
+                *out++ = digits[bytes[i] & 0x0F];
+            }
+            return out;
+        }
+
+        [[nodiscard]] std::string ToString() const {
+            std::string text(TextLength, '\0');
+            FormatTo(text.data());
+            return text;
+        }
+
+        [[nodiscard]] constexpr const std::array<uint8_t, 16>& Bytes() const { return bytes; }
+        [[nodiscard]] constexpr bool IsNil() const { return *this == Uuid{}; }
+
+        constexpr auto operator<=>(const Uuid&) const = default;
+        constexpr bool operator==(const Uuid&) const = default;
+    };
+
+    static_assert(sizeof(Uuid) == 16 && std::is_trivially_copyable_v<Uuid>);
+
+    inline void to_json(nlohmann::json& j, const Uuid& uuid) {
+        j = uuid.ToString();
+    }
+
+    inline void from_json(const nlohmann::json& j, Uuid& uuid) {
+        const auto parsed = Uuid::Parse(j.get_ref<const std::string&>());
+        if (!parsed) {
+            throw std::invalid_argument("Invalid UUID: " + j.get<std::string>());
+        }
+        uuid = *parsed;
+    }
+
+} // namespace domain
+
+template<>
+struct std::hash<domain::Uuid> {
+    size_t operator()(const domain::Uuid& uuid) const noexcept {
+        uint64_t high = 0;
+        uint64_t low = 0;
+        for (size_t i = 0; i < 8; i++) {
+            high = (high << 8) | uuid.Bytes()[i];
+            low = (low << 8) | uuid.Bytes()[i + 8];
+        }
+        // la mitad alta puede ser casi constante (p. ej. la marca de tiempo de un UUIDv7)
+        return static_cast<size_t>(low ^ (high * 0x9E3779B97F4A7C15ULL));
+    }
+};
+
+#endif // DOMAIN_UUID_HPP
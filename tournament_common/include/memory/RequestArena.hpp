@@ -0,0 +1,84 @@
+#ifndef TOURNAMENTS_REQUESTARENA_HPP
+#define TOURNAMENTS_REQUESTARENA_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+// Arena de una petición: un monotonic_buffer_resource sobre un bloque del hilo que se reutiliza
+// de una petición a otra. Lo que se pide a Resource() no se libera pieza por pieza; todo se
+// descarta junto al destruir la arena, así que nada de lo asignado debe sobrevivirla.
+//
+// El bloque es del hilo (sin candados ni contención con otros hilos). Si una petición no cabe,
+// el resto se pide a malloc y el bloque crece para la siguiente, hasta MaxRetainedBytes; en
+// régimen estable la arena no llama a malloc. Una arena anidada en el mismo hilo no comparte
+// el bloque: trabaja directamente sobre malloc.
+class RequestArena {
+public:
+    static constexpr size_t InitialBlockBytes = 64 * 1024;
+    static constexpr size_t MaxRetainedBytes = 1024 * 1024;
+
+    RequestArena() : block(AcquireThreadBlock()), resource(BufferFor(block), SizeFor(block), &overflow) {}
+
+    ~RequestArena() {
+        resource.release();
+        if (block == nullptr) return;
+        if (overflow.bytes > 0 && block->size < MaxRetainedBytes) {
+            block->size = std::min(std::bit_ceil(block->size + overflow.bytes), MaxRetainedBytes);
+            block->data = std::make_unique<std::byte[]>(block->size);
+        }
+        block->inUse = false;
+    }
+
+    RequestArena(const RequestArena&) = delete;
+    RequestArena& operator=(const RequestArena&) = delete;
+
+    [[nodiscard]] std::pmr::memory_resource* Resource() { return &resource; }
+
+    // Bytes que no cupieron en el bloque del hilo y se pidieron a malloc
+    [[nodiscard]] size_t OverflowBytes() const { return overflow.bytes; }
+
+private:
+    struct ThreadBlock {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+        bool inUse = false;
+    };
+
+    // Pasa a new_delete_resource contando los bytes pedidos
+    class OverflowResource : public std::pmr::memory_resource {
+    public:
+        size_t bytes = 0;
+    private:
+        void* do_allocate(size_t size, size_t alignment) override {
+            bytes += size;
+            return std::pmr::new_delete_resource()->allocate(size, alignment);
+        }
+        void do_deallocate(void* pointer, size_t size, size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(pointer, size, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    static ThreadBlock* AcquireThreadBlock() {
+        thread_local ThreadBlock threadBlock;
+        if (threadBlock.inUse) return nullptr;
+        if (threadBlock.data == nullptr) {
+            threadBlock.size = InitialBlockBytes;
+            threadBlock.data = std::make_unique<std::byte[]>(threadBlock.size);
+        }
+        threadBlock.inUse = true;
+        return &threadBlock;
+    }
+
+    static void* BufferFor(ThreadBlock* block) { return block != nullptr ? block->data.get() : nullptr; }
+    static size_t SizeFor(ThreadBlock* block) { return block != nullptr ? block->size : 0; }
+
+    ThreadBlock* block;
+    OverflowResource overflow;
+    std::pmr::monotonic_buffer_resource resource;
+};
+
+#endif //TOURNAMENTS_REQUESTARENA_HPP
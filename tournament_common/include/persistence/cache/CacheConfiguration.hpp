@@ -0,0 +1,26 @@
+#ifndef TOURNAMENTS_CACHECONFIGURATION_HPP
+#define TOURNAMENTS_CACHECONFIGURATION_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <nlohmann/json.hpp>
+
+// Parámetros del caché de entidades de un repositorio. Se leen de "cacheConfig".<entidad>;
+// capacity = 0 desactiva el caché.
+struct CacheConfiguration {
+    size_t capacity = 10000;
+    size_t shards = 16;
+    std::chrono::milliseconds ttl{30000};
+    // cuánto se recuerda que un id no existe
+    std::chrono::milliseconds negativeTtl{2000};
+};
+
+inline void from_json(const nlohmann::json& json, CacheConfiguration& configuration) {
+    configuration.capacity = json.value("capacity", static_cast<size_t>(10000));
+    configuration.shards = std::max(json.value("shards", static_cast<size_t>(16)), static_cast<size_t>(1));
+    configuration.ttl = std::chrono::milliseconds(json.value("ttlMs", 30000));
+    configuration.negativeTtl = std::chrono::milliseconds(json.value("negativeTtlMs", 2000));
+}
+
+#endif //TOURNAMENTS_CACHECONFIGURATION_HPP
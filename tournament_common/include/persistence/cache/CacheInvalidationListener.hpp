@@ -0,0 +1,66 @@
+#ifndef TOURNAMENTS_CACHEINVALIDATIONLISTENER_HPP
+#define TOURNAMENTS_CACHEINVALIDATIONLISTENER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+// Escucha el canal entity_changed (ver database/migrations/V004) en una conexión dedicada
+// y desaloja la entidad notificada del caché local. Así cada réplica ve las escrituras de las
+// demás en milisegundos, no cuando vence el TTL.
+//
+// Mientras la conexión está caída se pierden notificaciones: al reconectar se vacían todos
+// los cachés suscritos.
+class CacheInvalidationListener {
+public:
+    static constexpr std::string_view Channel = "entity_changed";
+
+    struct Subscription {
+        std::function<void(const std::string& id)> evict;
+        std::function<void()> clear;
+    };
+
+private:
+    std::string connectionString;
+    std::map<std::string, Subscription, std::less<>> subscriptions;
+    mutable std::mutex subscriptionsMutex;
+
+    std::atomic<bool> running{false};
+    std::thread worker;
+    std::mutex stopMutex;
+    std::condition_variable stopCondition;
+
+    std::atomic<uint64_t> received{0};
+    std::atomic<uint64_t> reconnects{0};
+
+    void Run();
+    void ClearAll();
+
+public:
+    explicit CacheInvalidationListener(std::string connectionString);
+    ~CacheInvalidationListener();
+
+    CacheInvalidationListener(const CacheInvalidationListener&) = delete;
+    CacheInvalidationListener& operator=(const CacheInvalidationListener&) = delete;
+
+    // entity es el nombre de la tabla tal como llega en la notificación ("teams", "tournaments")
+    void Subscribe(const std::string& entity, Subscription subscription);
+
+    // Aplica un payload "<tabla>:<id>"; los payloads de tablas sin suscripción se ignoran
+    void Dispatch(std::string_view payload);
+
+    void Start();
+    void Stop();
+
+    uint64_t Received() const { return received.load(); }
+    uint64_t Reconnects() const { return reconnects.load(); }
+};
+
+#endif //TOURNAMENTS_CACHEINVALIDATIONLISTENER_HPP
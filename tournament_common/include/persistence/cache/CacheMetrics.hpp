@@ -0,0 +1,34 @@
+#ifndef TOURNAMENTS_CACHEMETRICS_HPP
+#define TOURNAMENTS_CACHEMETRICS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+
+// Fotografía de los contadores de un caché en un instante dado.
+struct CacheMetrics {
+    size_t size = 0;
+    size_t capacity = 0;
+
+    uint64_t hits = 0;
+    uint64_t negativeHits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t expirations = 0;
+    uint64_t invalidations = 0;
+};
+
+inline void to_json(nlohmann::json& json, const CacheMetrics& metrics) {
+    json = nlohmann::json{
+        {"size", metrics.size},
+        {"capacity", metrics.capacity},
+        {"hits", metrics.hits},
+        {"negativeHits", metrics.negativeHits},
+        {"misses", metrics.misses},
+        {"evictions", metrics.evictions},
+        {"expirations", metrics.expirations},
+        {"invalidations", metrics.invalidations}
+    };
+}
+
+#endif //TOURNAMENTS_CACHEMETRICS_HPP
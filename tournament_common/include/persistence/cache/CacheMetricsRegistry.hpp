@@ -0,0 +1,32 @@
+#ifndef TOURNAMENTS_CACHEMETRICSREGISTRY_HPP
+#define TOURNAMENTS_CACHEMETRICSREGISTRY_HPP
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "persistence/cache/CacheMetrics.hpp"
+
+// Reúne los contadores de todos los cachés del proceso para exponerlos en /metrics.
+class CacheMetricsRegistry {
+    mutable std::mutex mutex;
+    std::map<std::string, std::function<CacheMetrics()>> sources;
+public:
+    void Register(const std::string& name, std::function<CacheMetrics()> source) {
+        std::lock_guard lock(mutex);
+        sources[name] = std::move(source);
+    }
+
+    std::map<std::string, CacheMetrics> Snapshot() const {
+        std::lock_guard lock(mutex);
+        std::map<std::string, CacheMetrics> snapshot;
+        for (const auto& [name, source] : sources) {
+            snapshot[name] = source();
+        }
+        return snapshot;
+    }
+};
+
+#endif //TOURNAMENTS_CACHEMETRICSREGISTRY_HPP
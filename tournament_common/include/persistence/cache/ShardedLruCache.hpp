@@ -0,0 +1,176 @@
+#ifndef TOURNAMENTS_SHARDEDLRUCACHE_HPP
+#define TOURNAMENTS_SHARDEDLRUCACHE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+// LRU con expiración por entrada, partido en shards con su propio candado para que los
+// hilos de Crow no compitan por un único mutex. Cada shard desaloja por su cuenta.
+//
+// La generación evita guardar un valor leído antes de una escritura: quien carga desde la BD
+// toma Generation(key) antes de leer y usa PutIfUnchanged; Invalidate incrementa la generación
+// del shard de la llave antes de borrar, así una carga que se cruzó con una escritura no se
+// guarda. Es por shard y no global: una invalidación solo cancela las cargas de su shard.
+template<class K, class V, class Hash = std::hash<K>>
+class ShardedLruCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct Entry {
+        K key;
+        V value;
+        Clock::time_point expiresAt;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        // el frente es el usado más recientemente
+        std::list<Entry> entries;
+        std::unordered_map<K, typename std::list<Entry>::iterator, Hash> index;
+        // se lee y se incrementa con el candado del shard tomado
+        uint64_t generation = 0;
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    size_t shardCapacity;
+    Hash hash;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> evictions{0};
+    std::atomic<uint64_t> expirations{0};
+
+    Shard& ShardFor(const K& key) {
+        return *shards[hash(key) % shards.size()];
+    }
+
+public:
+    ShardedLruCache(size_t capacity, size_t shardCount) {
+        shardCount = std::max<size_t>(shardCount, 1);
+        shardCapacity = (capacity + shardCount - 1) / shardCount;
+        shards.reserve(shardCount);
+        for (size_t i = 0; i < shardCount; i++) {
+            shards.push_back(std::make_unique<Shard>());
+        }
+    }
+
+    std::optional<V> Get(const K& key) {
+        auto& shard = ShardFor(key);
+        std::lock_guard lock(shard.mutex);
+        const auto found = shard.index.find(key);
+        if (found == shard.index.end()) {
+            ++misses;
+            return std::nullopt;
+        }
+        if (Clock::now() >= found->second->expiresAt) {
+            shard.entries.erase(found->second);
+            shard.index.erase(found);
+            ++expirations;
+            ++misses;
+            return std::nullopt;
+        }
+        shard.entries.splice(shard.entries.begin(), shard.entries, found->second);
+        ++hits;
+        return found->second->value;
+    }
+
+    void Put(const K& key, V value, std::chrono::milliseconds ttl) {
+        PutIfUnchanged(key, std::move(value), ttl, std::nullopt);
+    }
+
+    // No guarda nada si hubo una invalidación en el shard de la llave después de tomar expectedGeneration
+    void PutIfUnchanged(const K& key, V value, std::chrono::milliseconds ttl, std::optional<uint64_t> expectedGeneration) {
+        if (shardCapacity == 0) {
+            return;
+        }
+        auto& shard = ShardFor(key);
+        std::lock_guard lock(shard.mutex);
+        if (expectedGeneration && shard.generation != *expectedGeneration) {
+            return;
+        }
+        const auto expiresAt = Clock::now() + ttl;
+        if (const auto found = shard.index.find(key); found != shard.index.end()) {
+            found->second->value = std::move(value);
+            found->second->expiresAt = expiresAt;
+            shard.entries.splice(shard.entries.begin(), shard.entries, found->second);
+            return;
+        }
+        shard.entries.push_front(Entry{key, std::move(value), expiresAt});
+        shard.index.emplace(key, shard.entries.begin());
+        if (shard.entries.size() > shardCapacity) {
+            shard.index.erase(shard.entries.back().key);
+            shard.entries.pop_back();
+            ++evictions;
+        }
+    }
+
+    // true si la llave estaba en el caché
+    bool Erase(const K& key) {
+        return Remove(key, false);
+    }
+
+    // Para escrituras: además de borrar, descarta las cargas del mismo shard que estén en curso
+    bool Invalidate(const K& key) {
+        return Remove(key, true);
+    }
+
+private:
+    bool Remove(const K& key, bool invalidate) {
+        auto& shard = ShardFor(key);
+        std::lock_guard lock(shard.mutex);
+        if (invalidate) {
+            ++shard.generation;
+        }
+        const auto found = shard.index.find(key);
+        if (found == shard.index.end()) {
+            return false;
+        }
+        shard.entries.erase(found->second);
+        shard.index.erase(found);
+        return true;
+    }
+
+public:
+    void Clear() {
+        for (auto& shard : shards) {
+            std::lock_guard lock(shard->mutex);
+            ++shard->generation;
+            shard->entries.clear();
+            shard->index.clear();
+        }
+    }
+
+    size_t Size() const {
+        size_t size = 0;
+        for (const auto& shard : shards) {
+            std::lock_guard lock(shard->mutex);
+            size += shard->entries.size();
+        }
+        return size;
+    }
+
+    uint64_t Generation(const K& key) const {
+        auto& shard = *shards[hash(key) % shards.size()];
+        std::lock_guard lock(shard.mutex);
+        return shard.generation;
+    }
+
+    size_t Capacity() const { return shardCapacity * shards.size(); }
+    uint64_t Hits() const { return hits.load(); }
+    uint64_t Misses() const { return misses.load(); }
+    uint64_t Evictions() const { return evictions.load(); }
+    uint64_t Expirations() const { return expirations.load(); }
+};
+
+#endif //TOURNAMENTS_SHARDEDLRUCACHE_HPP
@@ -0,0 +1,131 @@
+#ifndef TOURNAMENTS_ASYNCQUERYEXECUTOR_HPP
+#define TOURNAMENTS_ASYNCQUERYEXECUTOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "persistence/configuration/StatementRegistry.hpp"
+
+// Resultado en texto de una sentencia ejecutada por el AsyncQueryExecutor.
+struct AsyncQueryResult {
+    enum class Status { Ok, Failed, TimedOut };
+
+    Status status = Status::Ok;
+    std::string error;
+    std::vector<std::string> columns;
+    // nullopt = NULL
+    std::vector<std::vector<std::optional<std::string>>> rows;
+
+    bool Ok() const { return status == Status::Ok; }
+
+    const std::optional<std::string>* Value(size_t row, std::string_view column) const {
+        for (size_t i = 0; i < columns.size(); i++) {
+            if (columns[i] == column) {
+                return &rows.at(row).at(i);
+            }
+        }
+        return nullptr;
+    }
+};
+
+// Ejecuta sentencias del StatementRegistry sin bloquear al llamador. Un solo hilo (reactor)
+// atiende N conexiones libpq en modo no bloqueante con epoll: envía la sentencia, vuelve al
+// loop mientras la BD trabaja y entrega el resultado al callback cuando el socket tiene datos.
+// Así unas pocas conexiones sostienen miles de peticiones en vuelo sin ocupar un hilo cada una.
+//
+// Los callbacks corren en el hilo del reactor: deben ser breves y no bloquear (no llamar
+// a la versión síncrona de los repositorios ni esperar un future desde ahí).
+//
+// Las peticiones que no consiguen conexión antes de acquireTimeout terminan con TimedOut;
+// las conexiones rotas se reabren con backoff exponencial sin detener a las demás.
+// La latencia de cada sentencia (desde que sale por el socket) se registra en QueryStatistics.
+class AsyncQueryExecutor {
+public:
+    using Callback = std::function<void(AsyncQueryResult)>;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Request {
+        const char* statement;
+        std::vector<std::string> parameters;
+        Callback callback;
+        Clock::time_point deadline;
+    };
+
+    struct Slot;
+
+    std::string connectionString;
+    std::chrono::milliseconds acquireTimeout;
+    std::chrono::milliseconds reconnectBackoffInitial;
+    std::chrono::milliseconds reconnectBackoffMax;
+
+    int epollFd = -1;
+    int wakeFd = -1;
+    std::vector<std::unique_ptr<Slot>> slots;
+
+    std::deque<Request> pending;
+    std::mutex pendingMutex;
+
+    std::atomic<bool> running{false};
+    std::thread reactor;
+
+    std::atomic<uint64_t> submitted{0};
+    std::atomic<uint64_t> completed{0};
+    std::atomic<uint64_t> failed{0};
+    std::atomic<uint64_t> timedOut{0};
+    std::atomic<uint64_t> reconnects{0};
+
+    void Run();
+    void Wake();
+    void StartConnect(Slot& slot);
+    void ContinueConnect(Slot& slot);
+    void SendNextPrepare(Slot& slot);
+    void Send(Slot& slot, Request request);
+    void OnSocketEvent(Slot& slot, uint32_t events);
+    void ReadResults(Slot& slot);
+    void Finish(Slot& slot);
+    void Break(Slot& slot, const std::string& reason);
+    void Watch(Slot& slot, bool writable);
+    void DispatchPending();
+    void ExpirePending(Clock::time_point now);
+    int NextTimeoutMillis(Clock::time_point now);
+    void Complete(Callback& callback, AsyncQueryResult result);
+
+public:
+    AsyncQueryExecutor(std::string connectionString, size_t connections,
+                       std::chrono::milliseconds acquireTimeout,
+                       std::chrono::milliseconds reconnectBackoffInitial = std::chrono::milliseconds(100),
+                       std::chrono::milliseconds reconnectBackoffMax = std::chrono::milliseconds(5000));
+    ~AsyncQueryExecutor();
+
+    AsyncQueryExecutor(const AsyncQueryExecutor&) = delete;
+    AsyncQueryExecutor& operator=(const AsyncQueryExecutor&) = delete;
+
+    // Encola la sentencia; el callback recibe el resultado en el hilo del reactor
+    void Execute(const PreparedStatement& statement, std::vector<std::string> parameters, Callback callback);
+
+    // Para llamadores que sí pueden esperar (pruebas, tareas en segundo plano)
+    std::future<AsyncQueryResult> Execute(const PreparedStatement& statement, std::vector<std::string> parameters);
+
+    void Stop();
+
+    uint64_t Submitted() const { return submitted.load(); }
+    uint64_t Completed() const { return completed.load(); }
+    uint64_t Failed() const { return failed.load(); }
+    uint64_t TimedOut() const { return timedOut.load(); }
+    uint64_t Reconnects() const { return reconnects.load(); }
+};
+
+#endif //TOURNAMENTS_ASYNCQUERYEXECUTOR_HPP
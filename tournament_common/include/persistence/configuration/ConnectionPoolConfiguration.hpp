@@ -0,0 +1,41 @@
+#ifndef TOURNAMENTS_CONNECTIONPOOLCONFIGURATION_HPP
+#define TOURNAMENTS_CONNECTIONPOOLCONFIGURATION_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <nlohmann/json.hpp>
+
+// Parámetros del pool elástico de conexiones. Se leen de "databaseConfig".
+struct ConnectionPoolConfiguration {
+    std::string connectionString;
+    size_t minSize = 1;
+    size_t maxSize = 1;
+    std::chrono::milliseconds acquireTimeout{2000};
+    std::chrono::milliseconds idleTimeout{60000};
+    // Una conexión ociosa por más de esto se verifica con SELECT 1 antes de entregarla: is_open()
+    // no detecta que el servidor se reinició. 0 verifica en cada checkout.
+    std::chrono::milliseconds validateAfterIdle{5000};
+    std::chrono::milliseconds reconnectBackoffInitial{100};
+    std::chrono::milliseconds reconnectBackoffMax{5000};
+    // Conexiones del AsyncQueryExecutor; 0 lo deshabilita
+    size_t asyncConnections = 0;
+};
+
+inline void from_json(const nlohmann::json& json, ConnectionPoolConfiguration& configuration) {
+    json.at("connectionString").get_to(configuration.connectionString);
+
+    // "poolSize" se mantiene como valor por defecto de ambos límites
+    const auto poolSize = json.value("poolSize", static_cast<size_t>(1));
+    configuration.minSize = json.value("minPoolSize", poolSize);
+    configuration.maxSize = std::max(json.value("maxPoolSize", poolSize), configuration.minSize);
+    configuration.acquireTimeout = std::chrono::milliseconds(json.value("acquireTimeoutMs", 2000));
+    configuration.idleTimeout = std::chrono::milliseconds(json.value("idleTimeoutMs", 60000));
+    configuration.validateAfterIdle = std::chrono::milliseconds(json.value("validateAfterIdleMs", 5000));
+    configuration.reconnectBackoffInitial = std::chrono::milliseconds(json.value("reconnectBackoffMs", 100));
+    configuration.reconnectBackoffMax = std::chrono::milliseconds(json.value("reconnectBackoffMaxMs", 5000));
+    configuration.asyncConnections = json.value("asyncConnections", static_cast<size_t>(0));
+}
+
+#endif //TOURNAMENTS_CONNECTIONPOOLCONFIGURATION_HPP
@@ -0,0 +1,49 @@
+#ifndef TOURNAMENTS_CONNECTIONPOOLMETRICS_HPP
+#define TOURNAMENTS_CONNECTIONPOOLMETRICS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+
+// Fotografía de los contadores del pool en un instante dado.
+struct ConnectionPoolMetrics {
+    size_t minSize = 0;
+    size_t maxSize = 0;
+    size_t open = 0;
+    size_t idle = 0;
+    size_t inUse = 0;
+
+    uint64_t acquisitions = 0;
+    uint64_t exhausted = 0;
+    uint64_t connectionsOpened = 0;
+    uint64_t connectionFailures = 0;
+    uint64_t brokenDiscarded = 0;
+    uint64_t idleClosed = 0;
+
+    uint64_t totalWaitMicros = 0;
+    uint64_t maxWaitMicros = 0;
+    uint64_t totalHoldMicros = 0;
+    uint64_t maxHoldMicros = 0;
+};
+
+inline void to_json(nlohmann::json& json, const ConnectionPoolMetrics& metrics) {
+    json = nlohmann::json{
+        {"minSize", metrics.minSize},
+        {"maxSize", metrics.maxSize},
+        {"open", metrics.open},
+        {"idle", metrics.idle},
+        {"inUse", metrics.inUse},
+        {"acquisitions", metrics.acquisitions},
+        {"exhausted", metrics.exhausted},
+        {"connectionsOpened", metrics.connectionsOpened},
+        {"connectionFailures", metrics.connectionFailures},
+        {"brokenDiscarded", metrics.brokenDiscarded},
+        {"idleClosed", metrics.idleClosed},
+        {"totalWaitMicros", metrics.totalWaitMicros},
+        {"maxWaitMicros", metrics.maxWaitMicros},
+        {"totalHoldMicros", metrics.totalHoldMicros},
+        {"maxHoldMicros", metrics.maxHoldMicros}
+    };
+}
+
+#endif //TOURNAMENTS_CONNECTIONPOOLMETRICS_HPP
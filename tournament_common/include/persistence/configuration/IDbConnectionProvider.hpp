@@ -7,35 +7,94 @@
 
 #include <memory>
 #include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ConnectionPoolMetrics.hpp"
+
+class AsyncQueryExecutor;
 
 class IDbConnection {
 public:
     virtual ~IDbConnection() = default;
+    // Los repositorios lo marcan tras confirmar una escritura; ReplicatedConnectionProvider lo
+    // lee al devolverse la conexión para abrir la ventana de read-your-writes de la sesión
+    bool committedWrite = false;
+};
+
+// Se lanza cuando no se obtiene una conexión antes de que venza el tiempo de espera.
+class ConnectionAcquireTimeout : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
 };
 
 
+// Dueño de las conexiones de un pool. PooledConnection le devuelve la conexión con una llamada
+// virtual: el checkout no asigna memoria para el deleter.
+class IConnectionOwner {
+public:
+    virtual void Return(IDbConnection* connection) noexcept = 0;
+protected:
+    ~IConnectionOwner() = default;
+};
+
 class PooledConnection {
-    std::unique_ptr<IDbConnection, std::function<void(IDbConnection*)>> connection;
+    IDbConnection* connection = nullptr;
+    IConnectionOwner* owner = nullptr;
+    // Solo para envoltorios (p. ej. ReplicatedConnectionProvider) y dobles de prueba
+    std::function<void(IDbConnection*)> deleter;
+
+    void Release() noexcept {
+        if (connection == nullptr) return;
+        if (owner != nullptr) {
+            owner->Return(connection);
+        } else if (deleter) {
+            deleter(connection);
+        }
+        connection = nullptr;
+    }
 public:
+    PooledConnection(IDbConnection* dbc, IConnectionOwner& owner) noexcept : connection(dbc), owner(&owner) {}
+
     explicit PooledConnection(
         IDbConnection* dbc,
-        std::function<void(IDbConnection*)> deleter) : connection(dbc, std::move(deleter)) {}
+        std::function<void(IDbConnection*)> deleter) : connection(dbc), deleter(std::move(deleter)) {}
+
+    ~PooledConnection() { Release(); }
 
-    IDbConnection* operator->() { return connection.get(); }
+    IDbConnection* operator->() { return connection; }
     IDbConnection& operator*() { return *connection; }
        // disable copy
     PooledConnection(const PooledConnection&) = delete;
     PooledConnection& operator=(const PooledConnection&) = delete;
 
     // allow move
-    PooledConnection(PooledConnection&&) noexcept = default;
-    PooledConnection& operator=(PooledConnection&&) noexcept = default;
+    PooledConnection(PooledConnection&& other) noexcept
+        : connection(std::exchange(other.connection, nullptr)), owner(other.owner), deleter(std::move(other.deleter)) {}
+    PooledConnection& operator=(PooledConnection&& other) noexcept {
+        if (this != &other) {
+            Release();
+            connection = std::exchange(other.connection, nullptr);
+            owner = other.owner;
+            deleter = std::move(other.deleter);
+        }
+        return *this;
+    }
 };
 
 
 class IDbConnectionProvider {
 public:
     virtual ~IDbConnectionProvider() = default;
+    // Conexión al primario: escrituras y lecturas que deben ver el último estado
+    // (p. ej. la lectura de un read-modify-write)
     virtual PooledConnection Connection() = 0;
+    // Conexión para lecturas que toleran el retraso de una réplica (listados, búsquedas)
+    virtual PooledConnection ReadConnection() { return Connection(); }
+    virtual ConnectionPoolMetrics Metrics() const { return {}; }
+    virtual std::vector<ConnectionPoolMetrics> ReplicaMetrics() const { return {}; }
+    // Camino no bloqueante (ver AsyncQueryExecutor); nullptr si no está habilitado
+    virtual AsyncQueryExecutor* Async() { return nullptr; }
 };
-#endif //TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
\ No newline at end of file
+#endif //TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
@@ -0,0 +1,80 @@
+#ifndef TOURNAMENTS_LATENCYHISTOGRAM_HPP
+#define TOURNAMENTS_LATENCYHISTOGRAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// Histograma de latencias con error relativo acotado, al estilo de HdrHistogram: cada potencia
+// de dos se divide en 32 cubetas lineales (error < 3.2 %) y los valores por debajo de 32 us son
+// exactos. Cubre hasta 2^27 us (~134 s); lo que pase de ahí cae en la última cubeta.
+// Record no toma candados: solo incrementos atómicos relajados.
+class LatencyHistogram {
+    static constexpr int SubBucketBits = 5;
+    static constexpr uint64_t SubBuckets = uint64_t{1} << SubBucketBits;
+    static constexpr int MaxShift = 22;
+    static constexpr size_t BucketCount = SubBuckets * (MaxShift + 1);
+
+    std::array<std::atomic<uint64_t>, BucketCount> counts{};
+    std::atomic<uint64_t> total{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> max{0};
+
+    static size_t IndexOf(uint64_t micros) {
+        if (micros < SubBuckets) {
+            return static_cast<size_t>(micros);
+        }
+        const int shift = std::bit_width(micros) - 1 - SubBucketBits;
+        if (shift >= MaxShift) {
+            return BucketCount - 1;
+        }
+        return static_cast<size_t>(shift + 1) * SubBuckets + static_cast<size_t>((micros >> shift) - SubBuckets);
+    }
+
+    // Mayor valor que cae en la cubeta (equivalente al "highest equivalent value" de HDR)
+    static uint64_t UpperBoundOf(size_t index) {
+        if (index < SubBuckets) {
+            return index;
+        }
+        const auto shift = static_cast<int>(index / SubBuckets) - 1;
+        const auto base = (SubBuckets + index % SubBuckets) << shift;
+        return base + (uint64_t{1} << shift) - 1;
+    }
+
+public:
+    void Record(uint64_t micros) {
+        counts[IndexOf(micros)].fetch_add(1, std::memory_order_relaxed);
+        total.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(micros, std::memory_order_relaxed);
+        auto current = max.load(std::memory_order_relaxed);
+        while (micros > current && !max.compare_exchange_weak(current, micros, std::memory_order_relaxed)) {}
+    }
+
+    uint64_t Count() const { return total.load(std::memory_order_relaxed); }
+    uint64_t Max() const { return max.load(std::memory_order_relaxed); }
+
+    double Mean() const {
+        const auto count = Count();
+        return count == 0 ? 0.0 : static_cast<double>(sum.load(std::memory_order_relaxed)) / static_cast<double>(count);
+    }
+
+    // percentile en [0, 100]; 0 si no hay muestras
+    uint64_t ValueAtPercentile(double percentile) const {
+        const auto count = Count();
+        if (count == 0) return 0;
+        const auto target = static_cast<uint64_t>(static_cast<double>(count) * percentile / 100.0 + 0.5);
+        uint64_t seen = 0;
+        for (size_t index = 0; index < BucketCount; index++) {
+            seen += counts[index].load(std::memory_order_relaxed);
+            if (seen >= std::max<uint64_t>(target, 1)) {
+                return std::min(UpperBoundOf(index), Max());
+            }
+        }
+        return Max();
+    }
+};
+
+#endif //TOURNAMENTS_LATENCYHISTOGRAM_HPP
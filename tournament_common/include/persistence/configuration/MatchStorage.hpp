@@ -0,0 +1,32 @@
+#ifndef TOURNAMENTS_MATCHSTORAGE_HPP
+#define TOURNAMENTS_MATCHSTORAGE_HPP
+
+#include <stdexcept>
+#include <string>
+#include <nlohmann/json.hpp>
+
+// Tabla de los partidos: MATCHES (documento JSONB) o MATCH_RECORDS (columnas tipadas, V005).
+// La leen de databaseConfig.matchStorage tanto el consumer, que escribe los partidos, como el
+// servicio REST, que los lee en GET /tournaments/<id>/full; los dos deben usar el mismo valor.
+enum class MatchStorage {
+    Document,
+    Typed
+};
+
+struct MatchStorageConfiguration {
+    MatchStorage storage = MatchStorage::Document;
+};
+
+// Un valor desconocido es un error: caer en "document" dejaría a un proceso leyendo la otra tabla
+inline void from_json(const nlohmann::json& json, MatchStorageConfiguration& configuration) {
+    const auto storage = json.value("matchStorage", std::string("document"));
+    if (storage == "document") {
+        configuration.storage = MatchStorage::Document;
+    } else if (storage == "typed") {
+        configuration.storage = MatchStorage::Typed;
+    } else {
+        throw std::invalid_argument("Unknown databaseConfig.matchStorage: " + storage);
+    }
+}
+
+#endif //TOURNAMENTS_MATCHSTORAGE_HPP
@@ -0,0 +1,104 @@
+#ifndef TOURNAMENTS_PIPELINEDTRANSACTION_HPP
+#define TOURNAMENTS_PIPELINEDTRANSACTION_HPP
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <pqxx/pqxx>
+
+#include "persistence/configuration/StatementRegistry.hpp"
+
+// Tipos de libpq (libpq-fe.h solo se incluye en PipelinedTransaction.cpp)
+struct pg_conn;
+struct pg_result;
+
+// Resultado en texto de una sentencia de un PipelinedTransaction; es dueño del PGresult.
+class PipelineResult {
+    std::shared_ptr<pg_result> result;
+
+public:
+    PipelineResult() = default;
+    explicit PipelineResult(pg_result* result);
+
+    [[nodiscard]] bool Empty() const { return Size() == 0; }
+    [[nodiscard]] int Size() const;
+    // Filas escritas por un INSERT/UPDATE/DELETE
+    [[nodiscard]] uint64_t AffectedRows() const;
+    // Posición de la columna en el resultado, -1 si no existe
+    [[nodiscard]] int Column(const char* name) const;
+    [[nodiscard]] bool IsNull(int row, int column) const;
+    // Vista del valor en texto, válida mientras viva el resultado
+    [[nodiscard]] std::string_view View(int row, int column) const;
+};
+
+// Transacción en el modo pipeline de libpq: BEGIN y las sentencias del StatementRegistry se
+// envían con PQsendQueryPrepared (parámetros enlazados, en texto) sin esperar
+// sus resultados, y solo se espera al pedir uno (Retrieve) o al confirmar (Commit), que marcan
+// un punto de sincronización (PQpipelineSync). Así un flujo sin dependencias entre sus
+// sentencias cuesta una sola ida y vuelta y uno con una lectura intermedia cuesta dos.
+//
+// pqxx no expone el PGconn de una conexión: mientras dura la transacción la conexión del pool
+// se suelta (release_raw_connection) y al terminar se vuelve a tomar (seize_raw_connection),
+// con el modo pipeline ya cerrado. Las sentencias preparadas viven en la sesión del servidor,
+// así que siguen disponibles. La conexión no debe tener una transacción de pqxx abierta.
+//
+// El socket queda en modo bloqueante: los lotes son de unas pocas sentencias y caben en los
+// búferes del socket, así el servidor nunca espera a que se lean sus respuestas para seguir.
+//
+// Si una sentencia falla, las siguientes del mismo tramo se descartan y Retrieve o Commit
+// lanzan pqxx::sql_error con el SQLSTATE de la primera. Si se destruye sin Commit (p. ej. por
+// una excepción) se hace ROLLBACK.
+// Cada ida y vuelta (Retrieve o Commit) se registra en QueryStatistics como "pipeline".
+class PipelinedTransaction {
+public:
+    using query_id = size_t;
+
+private:
+    pqxx::connection& owner;
+    pg_conn* connection;
+    // Nombre de la sentencia de cada query_id (para los errores) y su resultado una vez leído
+    std::vector<const char*> statements;
+    std::vector<std::optional<PipelineResult>> results;
+    size_t received = 0;
+    bool finished = false;
+
+    void Send(const char* statement, const std::vector<std::optional<std::string>>& parameters);
+    void SendCommand(const char* command);
+    void Sync();
+    void Release() noexcept;
+
+    template<typename T>
+    static std::optional<std::string> ToParameter(const T& value) {
+        if constexpr (requires { value.has_value(); *value; }) {
+            return value ? ToParameter(*value) : std::nullopt;
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            return std::to_string(value);
+        } else {
+            return std::string(value);
+        }
+    }
+
+public:
+    explicit PipelinedTransaction(pqxx::connection& connection);
+    ~PipelinedTransaction();
+
+    PipelinedTransaction(const PipelinedTransaction&) = delete;
+    PipelinedTransaction& operator=(const PipelinedTransaction&) = delete;
+
+    template<typename... Args>
+    query_id Execute(const PreparedStatement& statement, const Args&... args) {
+        Send(statement.name, {ToParameter(args)...});
+        return statements.size() - 1;
+    }
+
+    // Envía lo encolado hasta esta sentencia y espera su resultado
+    PipelineResult Retrieve(query_id id);
+
+    void Commit();
+};
+
+#endif //TOURNAMENTS_PIPELINEDTRANSACTION_HPP
@@ -11,10 +11,19 @@
 
 struct PostgresConnection final : IDbConnection{
     std::unique_ptr<pqxx::connection> connection;
-    explicit PostgresConnection(std::unique_ptr<pqxx::connection> connection) : connection(std::move(connection)) {
+    // Cuántas de StatementRegistry::MatchRecords ya se prepararon en esta conexión; vuelve a 0
+    // cuando el pool descarta la conexión
+    size_t matchRecordsPrepared = 0;
+    explicit PostgresConnection(std::unique_ptr<pqxx::connection> connection = nullptr) : connection(std::move(connection)) {
     }
 };
 
+// Los providers de Postgres solo entregan PostgresConnection: static_cast en lugar de
+// dynamic_cast, sin RTTI en cada consulta
+inline PostgresConnection* AsPostgres(PooledConnection& pooled) {
+    return static_cast<PostgresConnection*>(&*pooled);
+}
+
 
 
 #endif //TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
\ No newline at end of file
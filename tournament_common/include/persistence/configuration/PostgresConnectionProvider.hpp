@@ -4,59 +4,88 @@
 
 #ifndef TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
 #define TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
-#include <queue>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <pqxx/pqxx>
 
 #include "IDbConnectionProvider.hpp"
 #include "PostgresConnection.hpp"
+#include "ConnectionPoolConfiguration.hpp"
+#include "AsyncQueryExecutor.hpp"
 
-class PostgresConnectionProvider : public IDbConnectionProvider{
-    std::string_view connectionString;
-    size_t poolSize = 1;
-    std::queue<std::unique_ptr<pqxx::connection>> connectionPool;
-    std::mutex connectionPoolMutex;
+// Pool elástico: abre minSize conexiones al iniciar y crece bajo demanda hasta maxSize.
+// Las conexiones rotas se descartan y se reabren con backoff exponencial. Una conexión que
+// estuvo ociosa más de validateAfterIdle se verifica con SELECT 1 antes de entregarla, así la
+// primera consulta después de un reinicio de la BD no recibe una conexión muerta.
+//
+// Los maxSize lugares (PostgresConnection) se reservan al construir y nunca se mueven, así
+// que un checkout no asigna memoria. Las conexiones ociosas se marcan en un bitmap atómico:
+// tomar y devolver una es un fetch_and / fetch_or, sin candado. Cada hilo recuerda el último
+// lugar que usó y lo intenta primero. El mutex y la condition_variable solo se usan al abrir
+// conexiones, al descartarlas y cuando hay que esperar.
+class PostgresConnectionProvider : public IDbConnectionProvider, private IConnectionOwner {
+    using Clock = std::chrono::steady_clock;
+    static constexpr size_t NoSlot = static_cast<size_t>(-1);
+
+    struct alignas(64) SlotState {
+        std::atomic<Clock::rep> idleSince{0};
+        Clock::time_point checkedOutAt{};
+    };
+
+    ConnectionPoolConfiguration configuration;
+
+    std::unique_ptr<PostgresConnection[]> connections;
+    std::unique_ptr<SlotState[]> slots;
+    // bit i encendido = connections[i] abierta y ociosa
+    std::unique_ptr<std::atomic<uint64_t>[]> idleMask;
+    size_t idleMaskWords = 0;
+
+    // Lugares sin conexión, protegidos por connectionPoolMutex (capacidad reservada: no asigna)
+    std::vector<size_t> emptySlots;
+    std::atomic<size_t> openConnections{0};
+    std::atomic<size_t> waiters{0};
+    mutable std::mutex connectionPoolMutex;
     std::condition_variable connectionPoolCondition;
 
+    std::chrono::milliseconds reconnectBackoff;
+    Clock::time_point nextConnectAttempt{};
+    std::atomic<Clock::rep> nextIdleSweep{0};
+
+    std::atomic<uint64_t> acquisitions{0};
+    std::atomic<uint64_t> exhausted{0};
+    std::atomic<uint64_t> connectionsOpened{0};
+    std::atomic<uint64_t> connectionFailures{0};
+    std::atomic<uint64_t> brokenDiscarded{0};
+    std::atomic<uint64_t> idleClosed{0};
+    std::atomic<uint64_t> totalWaitMicros{0};
+    std::atomic<uint64_t> maxWaitMicros{0};
+    std::atomic<uint64_t> totalHoldMicros{0};
+    std::atomic<uint64_t> maxHoldMicros{0};
+
+    std::unique_ptr<AsyncQueryExecutor> asyncExecutor;
+
+    std::unique_ptr<pqxx::connection> OpenConnection();
+    size_t TryOpenConnection(std::unique_lock<std::mutex>& lock);
+    size_t TryAcquireIdle();
+    size_t AcquireSlow(Clock::time_point deadline);
+    bool TryClaim(size_t slot);
+    bool IsAlive(size_t slot, Clock::time_point now);
+    void MarkIdle(size_t slot);
+    void Discard(size_t slot, std::atomic<uint64_t>& reason);
+    void SweepIdle(Clock::time_point now);
+    void Return(IDbConnection* connection) noexcept override;
+
 public:
-    PostgresConnectionProvider(std::string_view connectionString, size_t poolSize) : connectionString(connectionString), poolSize(poolSize) {
-        for (size_t i = 0; i < poolSize; i++) {
-            connectionPool.push(std::make_unique<pqxx::connection>(connectionString.data()));
-            connectionPool.back()->prepare("insert_tournament", "insert into TOURNAMENTS (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("select_tournament_by_id", "select * from TOURNAMENTS where id = $1");
-            connectionPool.back()->prepare("insert_team", "insert into TEAMS (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("insert_group", "insert into GROUPS (document) values($1) RETURNING id");
-        }
-    }
-
-    PooledConnection Connection() override {
-        std::unique_lock lock(connectionPoolMutex);
-
-        // wait until a connection is available
-        connectionPoolCondition.wait(lock, [this] { return !connectionPool.empty(); });
-
-        // take one out
-        auto conn = std::move(connectionPool.front());
-        connectionPool.pop();
-
-        // build PostgresConnection wrapper (adapts pqxx::connection -> IDbConnection)
-        auto dbc = new PostgresConnection(std::move(conn));
-
-        // return a RAII PooledConnection
-        return PooledConnection(
-            dbc,
-            [this](IDbConnection* dbc) {
-                auto pc = dynamic_cast<PostgresConnection*>(dbc);
-
-                {
-                    std::lock_guard<std::mutex> lock(connectionPoolMutex);
-                    connectionPool.push(std::move(pc->connection));
-                }
-
-                delete pc;
-                connectionPoolCondition.notify_one();
-            }
-        );
-    }
+    explicit PostgresConnectionProvider(ConnectionPoolConfiguration configuration);
+    PostgresConnectionProvider(std::string_view connectionString, size_t poolSize);
+
+    PooledConnection Connection() override;
+    ConnectionPoolMetrics Metrics() const override;
+    AsyncQueryExecutor* Async() override { return asyncExecutor.get(); }
 };
-#endif //TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
\ No newline at end of file
+#endif //TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
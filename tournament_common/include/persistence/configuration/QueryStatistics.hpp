@@ -0,0 +1,204 @@
+#ifndef TOURNAMENTS_QUERYSTATISTICS_HPP
+#define TOURNAMENTS_QUERYSTATISTICS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+#include <pqxx/pqxx>
+
+#include "persistence/configuration/LatencyHistogram.hpp"
+#include "persistence/configuration/StatementRegistry.hpp"
+
+// Umbral del registro de consultas lentas. Se lee de "databaseConfig".
+struct QueryStatisticsConfiguration {
+    // 0 deshabilita el registro
+    std::chrono::milliseconds slowQueryThreshold{500};
+    // Agrega al registro el EXPLAIN (ANALYZE, BUFFERS) de las consultas lentas de solo lectura.
+    // ANALYZE vuelve a ejecutar la consulta: solo para diagnóstico.
+    bool explainSlowQueries = false;
+};
+
+inline void from_json(const nlohmann::json& json, QueryStatisticsConfiguration& configuration) {
+    configuration.slowQueryThreshold = std::chrono::milliseconds(json.value("slowQueryThresholdMs", 500));
+    configuration.explainSlowQueries = json.value("explainSlowQueries", false);
+}
+
+// Contadores de una sentencia en un instante dado
+struct StatementMetrics {
+    uint64_t calls = 0;
+    uint64_t rows = 0;
+    uint64_t slow = 0;
+    uint64_t errors = 0;
+    std::map<std::string, uint64_t> errorsBySqlState;
+    double meanMicros = 0;
+    uint64_t p50Micros = 0;
+    uint64_t p90Micros = 0;
+    uint64_t p99Micros = 0;
+    uint64_t maxMicros = 0;
+};
+
+inline void to_json(nlohmann::json& json, const StatementMetrics& metrics) {
+    json = nlohmann::json{
+        {"calls", metrics.calls},
+        {"rows", metrics.rows},
+        {"slow", metrics.slow},
+        {"errors", metrics.errors},
+        {"errorsBySqlState", metrics.errorsBySqlState},
+        {"meanMicros", metrics.meanMicros},
+        {"p50Micros", metrics.p50Micros},
+        {"p90Micros", metrics.p90Micros},
+        {"p99Micros", metrics.p99Micros},
+        {"maxMicros", metrics.maxMicros}
+    };
+}
+
+// Latencia, filas y errores por sentencia (por nombre del StatementRegistry), para todo el
+// proceso: los repositorios no reciben dependencias nuevas, igual que con events::EventBus.
+// Las entradas del registro se crean al inicio, así que registrar una ejecución no toma candados.
+class QueryStatistics {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Statement {
+        LatencyHistogram latency;
+        std::atomic<uint64_t> rows{0};
+        std::atomic<uint64_t> slow{0};
+        std::atomic<uint64_t> errors{0};
+        std::mutex errorsMutex;
+        std::map<std::string, uint64_t> errorsBySqlState;
+    };
+
+    static QueryStatistics& Instance();
+
+    void Configure(const QueryStatisticsConfiguration& configuration);
+    bool IsSlow(Clock::duration elapsed) const;
+    bool ExplainSlowQueries() const { return explainSlowQueries.load(std::memory_order_relaxed); }
+
+    void Record(std::string_view statement, Clock::duration elapsed, uint64_t rows);
+    void RecordError(std::string_view statement, Clock::duration elapsed, std::string_view sqlState);
+    // Los parámetros nunca se escriben: solo cuántos eran
+    void LogSlowQuery(std::string_view statement, Clock::duration elapsed, size_t parameters, const std::optional<std::string>& plan);
+
+    std::map<std::string, StatementMetrics> Snapshot() const;
+
+private:
+    QueryStatistics();
+
+    Statement& For(std::string_view statement);
+
+    std::unordered_map<std::string_view, std::unique_ptr<Statement>> registered;
+    // nombres fuera del StatementRegistry (p. ej. los lotes de PipelinedTransaction)
+    mutable std::mutex othersMutex;
+    std::map<std::string, std::unique_ptr<Statement>, std::less<>> others;
+
+    std::atomic<int64_t> slowQueryThresholdMicros{500000};
+    std::atomic<bool> explainSlowQueries{false};
+};
+
+namespace query_statistics_detail {
+    // Registra la excepción en curso (llamar desde un catch) con su SQLSTATE
+    inline void RecordCurrentError(std::string_view statement, QueryStatistics::Clock::time_point start) {
+        auto& statistics = QueryStatistics::Instance();
+        const auto elapsed = QueryStatistics::Clock::now() - start;
+        try {
+            throw;
+        } catch (const pqxx::sql_error& e) {
+            statistics.RecordError(statement, elapsed, e.sqlstate());
+        } catch (const pqxx::broken_connection&) {
+            statistics.RecordError(statement, elapsed, "08006");
+        } catch (...) {
+            statistics.RecordError(statement, elapsed, "unknown");
+        }
+    }
+
+    // Conservador: cualquier escritura (o FOR UPDATE) queda fuera del EXPLAIN ANALYZE
+    bool IsReadOnly(std::string_view sql);
+
+    // EXPLAIN en un savepoint: si falla, la transacción del llamador sigue utilizable
+    template<typename... Args>
+    std::optional<std::string> Explain(pqxx::dbtransaction& tx, const PreparedStatement& statement, const Args&... args) {
+        std::string sql = std::string("EXPLAIN (ANALYZE, BUFFERS) EXECUTE ") + statement.name;
+        if constexpr (sizeof...(Args) > 0) {
+            sql += "(";
+            bool first = true;
+            ((sql += (first ? "" : ", ") + tx.quote(args), first = false), ...);
+            sql += ")";
+        }
+        try {
+            pqxx::subtransaction explain(tx, "explain_slow_query");
+            std::string plan;
+            for (const auto& row : explain.exec(sql)) {
+                plan += row[0].c_str();
+                plan += '\n';
+            }
+            explain.commit();
+            return plan;
+        } catch (const std::exception& e) {
+            return std::string("EXPLAIN failed: ") + e.what();
+        }
+    }
+}
+
+// exec_prepared con instrumentación: latencia, filas (devueltas o afectadas), errores por
+// SQLSTATE y registro de consultas lentas. Los repositorios ejecutan todas sus sentencias así.
+template<typename Transaction, typename... Args>
+pqxx::result ExecPrepared(Transaction& tx, const PreparedStatement& statement, const Args&... args) {
+    auto& statistics = QueryStatistics::Instance();
+    const auto start = QueryStatistics::Clock::now();
+    pqxx::result result;
+    try {
+        result = tx.exec_prepared(statement.name, args...);
+    } catch (...) {
+        query_statistics_detail::RecordCurrentError(statement.name, start);
+        throw;
+    }
+    const auto elapsed = QueryStatistics::Clock::now() - start;
+    const auto rows = result.empty() ? static_cast<uint64_t>(std::max<int64_t>(result.affected_rows(), 0)) : static_cast<uint64_t>(result.size());
+    statistics.Record(statement.name, elapsed, rows);
+
+    if (statistics.IsSlow(elapsed)) {
+        std::optional<std::string> plan;
+        if constexpr (std::is_base_of_v<pqxx::dbtransaction, Transaction>) {
+            if (statistics.ExplainSlowQueries() && query_statistics_detail::IsReadOnly(statement.sql)) {
+                plan = query_statistics_detail::Explain(tx, statement, args...);
+            }
+        }
+        statistics.LogSlowQuery(statement.name, elapsed, sizeof...(Args), plan);
+    }
+    return result;
+}
+
+// COPY (stream_from / stream_to) con la misma instrumentación que ExecPrepared, bajo un nombre
+// fuera del StatementRegistry (p. ej. "copy_teams_in"). copy hace todo el COPY, complete()
+// incluido (ahí llegan los errores del servidor), y devuelve las filas copiadas. En un COPY de
+// salida la latencia incluye lo que tarda el consumidor de cada fila. Sin EXPLAIN: COPY no se
+// puede volver a ejecutar aparte.
+template<typename Copy>
+uint64_t ExecCopy(std::string_view name, Copy copy) {
+    auto& statistics = QueryStatistics::Instance();
+    const auto start = QueryStatistics::Clock::now();
+    uint64_t rows = 0;
+    try {
+        rows = copy();
+    } catch (...) {
+        query_statistics_detail::RecordCurrentError(name, start);
+        throw;
+    }
+    const auto elapsed = QueryStatistics::Clock::now() - start;
+    statistics.Record(name, elapsed, rows);
+    if (statistics.IsSlow(elapsed)) {
+        statistics.LogSlowQuery(name, elapsed, 0, std::nullopt);
+    }
+    return rows;
+}
+
+#endif //TOURNAMENTS_QUERYSTATISTICS_HPP
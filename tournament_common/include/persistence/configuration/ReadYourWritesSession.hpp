@@ -0,0 +1,86 @@
+#ifndef TOURNAMENTS_READYOURWRITESSESSION_HPP
+#define TOURNAMENTS_READYOURWRITESSESSION_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Read-your-writes de quien hace la petición, no del proceso. ReplicatedConnectionProvider manda
+// las lecturas al primario mientras la sesión en curso esté dentro de su ventana, que se abre al
+// devolverse una conexión del primario con una escritura confirmada. Para que la siguiente
+// petición del mismo cliente también la vea, la sesión viaja como un token: el fin de la ventana
+// en milisegundos desde epoch (reloj del sistema, comparable entre instancias).
+class ReadYourWritesSession {
+public:
+    using Clock = std::chrono::system_clock;
+
+private:
+    Clock::time_point readPrimaryUntil{};
+    bool primaryOnly = false;
+    bool wrote = false;
+
+    static ReadYourWritesSession*& CurrentSlot() {
+        thread_local ReadYourWritesSession* current = nullptr;
+        return current;
+    }
+    friend class ReadYourWritesScope;
+
+public:
+    ReadYourWritesSession() = default;
+
+    // Token de una respuesta anterior; vacío o inválido = sin ventana
+    static ReadYourWritesSession FromToken(std::string_view token) {
+        ReadYourWritesSession session;
+        int64_t millis = 0;
+        const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), millis);
+        if (error == std::errc() && end == token.data() + token.size() && millis > 0) {
+            session.readPrimaryUntil = Clock::time_point(std::chrono::milliseconds(millis));
+        }
+        return session;
+    }
+
+    // Todas las lecturas al primario, p. ej. para recargar una entidad recién invalidada
+    static ReadYourWritesSession PrimaryOnly() {
+        ReadYourWritesSession session;
+        session.primaryOnly = true;
+        return session;
+    }
+
+    // Sesión de la petición en curso en este hilo; nullptr fuera de un ReadYourWritesScope
+    static ReadYourWritesSession* Current() { return CurrentSlot(); }
+
+    // Un token que termina después de now + window no lo emitió este servicio y se ignora
+    bool ReadsPrimary(Clock::time_point now, std::chrono::milliseconds window) const {
+        return primaryOnly || (now < readPrimaryUntil && readPrimaryUntil - now <= window);
+    }
+
+    void OpenWindow(Clock::time_point until) {
+        readPrimaryUntil = std::max(readPrimaryUntil, until);
+        wrote = true;
+    }
+
+    // true si esta petición confirmó una escritura (y hay que devolver el token)
+    bool Wrote() const { return wrote; }
+
+    std::string Token() const {
+        return std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(readPrimaryUntil.time_since_epoch()).count());
+    }
+};
+
+// Instala la sesión para las consultas de este hilo hasta el final del bloque
+class ReadYourWritesScope {
+    ReadYourWritesSession* previous;
+public:
+    explicit ReadYourWritesScope(ReadYourWritesSession& session)
+        : previous(std::exchange(ReadYourWritesSession::CurrentSlot(), &session)) {}
+    ~ReadYourWritesScope() { ReadYourWritesSession::CurrentSlot() = previous; }
+
+    ReadYourWritesScope(const ReadYourWritesScope&) = delete;
+    ReadYourWritesScope& operator=(const ReadYourWritesScope&) = delete;
+};
+
+#endif //TOURNAMENTS_READYOURWRITESSESSION_HPP
@@ -0,0 +1,89 @@
+#ifndef TOURNAMENTS_REPLICATEDCONNECTIONPROVIDER_HPP
+#define TOURNAMENTS_REPLICATEDCONNECTIONPROVIDER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "IDbConnectionProvider.hpp"
+#include "ConnectionPoolConfiguration.hpp"
+#include "ReadYourWritesSession.hpp"
+
+// Réplicas de lectura declaradas en "databaseConfig.replicas". Cada réplica hereda los
+// parámetros del primario que no redefine (tamaño del pool, timeouts, asyncConnections).
+struct ReplicaRoutingConfiguration {
+    std::vector<ConnectionPoolConfiguration> replicas;
+    // Tras confirmar una escritura, las lecturas de esa sesión siguen en el primario durante esta
+    // ventana; 0 la deshabilita
+    std::chrono::milliseconds readYourWritesWindow{0};
+    // Una réplica que no entregó conexión se saltea durante este tiempo
+    std::chrono::milliseconds replicaRetryAfter{1000};
+};
+
+inline void from_json(const nlohmann::json& json, ReplicaRoutingConfiguration& configuration) {
+    nlohmann::json defaults = json;
+    defaults.erase("replicas");
+    for (const auto& replica : json.value("replicas", nlohmann::json::array())) {
+        auto merged = defaults;
+        merged.update(replica);
+        configuration.replicas.push_back(merged.get<ConnectionPoolConfiguration>());
+    }
+    configuration.readYourWritesWindow = std::chrono::milliseconds(json.value("readYourWritesMs", 0));
+    configuration.replicaRetryAfter = std::chrono::milliseconds(json.value("replicaRetryMs", 1000));
+}
+
+// Separa lecturas y escrituras: Connection() va al primario y ReadConnection() reparte entre
+// las réplicas en round-robin. Si ninguna réplica entrega conexión, la lectura cae al primario.
+//
+// Read-your-writes: cuando vuelve al pool una conexión del primario en la que se confirmó una
+// escritura (IDbConnection::committedWrite), se abre la ventana de la ReadYourWritesSession en
+// curso, y mientras dure sus lecturas también van al primario; así quien acaba de escribir no lee
+// un estado anterior por el retraso de la replicación. Las demás sesiones siguen leyendo de las
+// réplicas, y sin sesión instalada (fuera de una petición) no hay ventana.
+class ReplicatedConnectionProvider : public IDbConnectionProvider {
+    using Clock = std::chrono::steady_clock;
+
+    struct Replica {
+        std::shared_ptr<IDbConnectionProvider> provider;
+        std::atomic<Clock::rep> unavailableUntil{0};
+    };
+
+    std::shared_ptr<IDbConnectionProvider> primary;
+    std::vector<std::unique_ptr<Replica>> replicas;
+    std::chrono::milliseconds readYourWritesWindow;
+    std::chrono::milliseconds replicaRetryAfter;
+
+    std::atomic<size_t> nextReplica{0};
+
+    std::atomic<uint64_t> replicaReads{0};
+    std::atomic<uint64_t> primaryReads{0};
+    std::atomic<uint64_t> replicaFailures{0};
+
+    static Clock::rep Now() { return Clock::now().time_since_epoch().count(); }
+    // La sesión en curso está en su ventana (o pide leer solo del primario)
+    bool InReadYourWritesWindow() const;
+    // Réplica disponible siguiente en el round-robin; nullptr si no hay ninguna
+    Replica* NextReplica();
+
+public:
+    ReplicatedConnectionProvider(std::shared_ptr<IDbConnectionProvider> primary,
+                                 std::vector<std::shared_ptr<IDbConnectionProvider>> replicas,
+                                 std::chrono::milliseconds readYourWritesWindow = std::chrono::milliseconds(0),
+                                 std::chrono::milliseconds replicaRetryAfter = std::chrono::milliseconds(1000));
+
+    PooledConnection Connection() override;
+    PooledConnection ReadConnection() override;
+    AsyncQueryExecutor* Async() override;
+
+    ConnectionPoolMetrics Metrics() const override { return primary->Metrics(); }
+    std::vector<ConnectionPoolMetrics> ReplicaMetrics() const override;
+
+    uint64_t ReplicaReads() const { return replicaReads.load(); }
+    uint64_t PrimaryReads() const { return primaryReads.load(); }
+    uint64_t ReplicaFailures() const { return replicaFailures.load(); }
+};
+
+#endif //TOURNAMENTS_REPLICATEDCONNECTIONPROVIDER_HPP
@@ -0,0 +1,318 @@
+#ifndef TOURNAMENTS_STATEMENTREGISTRY_HPP
+#define TOURNAMENTS_STATEMENTREGISTRY_HPP
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <pqxx/pqxx>
+
+// Sentencia preparada del lado del servidor: nombre + SQL.
+struct PreparedStatement {
+    const char* name;
+    const char* sql;
+};
+
+// Todas las sentencias de los repositorios. Cada conexión del pool prepara una sola vez las de
+// StatementRegistry::All al abrirse (las de MATCH_RECORDS, al primer uso) y los repositorios las ejecutan con ExecPrepared (sin parseo ni planeación por request).
+namespace statements {
+    namespace team {
+        inline constexpr PreparedStatement ReadAll{"select_all_teams", "SELECT id, document->>'name' AS name FROM teams"};
+        inline constexpr PreparedStatement ReadPage{"select_teams_page",
+            "SELECT id, document->>'name' AS name FROM teams WHERE id > $1 ORDER BY id LIMIT $2"};
+        inline constexpr PreparedStatement ReadById{"select_team_by_id", "SELECT id, document->>'name' AS name FROM teams WHERE id = $1"};
+        // $1 es un arreglo de ids; se resuelve con la llave primaria, un Index Scan por elemento
+        inline constexpr PreparedStatement ReadByIds{"select_teams_by_ids",
+            "SELECT id, document->>'name' AS name FROM teams WHERE id = ANY($1::uuid[])"};
+        // Los ids los genera la aplicación (UUIDv7, ver IdGenerator.hpp): no hace falta RETURNING
+        inline constexpr PreparedStatement Insert{"insert_team", "INSERT INTO teams (id, document) VALUES ($1, $2::jsonb)"};
+        inline constexpr PreparedStatement Update{"update_team", "UPDATE teams SET document = $1::jsonb WHERE id = $2"};
+        inline constexpr PreparedStatement Delete{"delete_team", "DELETE FROM teams WHERE id = $1"};
+        // COPY (stream_from) no admite sentencias preparadas: se envía el texto de la consulta
+        inline constexpr std::string_view StreamAll = "SELECT id, document->>'name' FROM teams";
+    }
+
+    // Columna groups de los agregados de torneo (tournament::ReadAggregateById y
+    // match_record::ReadTournamentAggregateById): los grupos de t con sus equipos
+#define TOURNAMENT_AGGREGATE_GROUPS \
+    "COALESCE((" \
+    "  SELECT json_agg(g.document || jsonb_build_object('id', g.id::text, 'teams', COALESCE((" \
+    "         SELECT jsonb_agg(COALESCE(tm.document || jsonb_build_object('id', tm.id::text), entry.team)" \
+    "                          ORDER BY entry.position)" \
+    "         FROM jsonb_array_elements(g.document->'teams') WITH ORDINALITY AS entry(team, position)" \
+    "         LEFT JOIN teams tm ON tm.id = CASE" \
+    "             WHEN entry.team->>'id' ~ '^[0-9a-fA-F]{8}(-[0-9a-fA-F]{4}){3}-[0-9a-fA-F]{12}$'" \
+    "             THEN (entry.team->>'id')::uuid END" \
+    "     ), '[]'::jsonb)) ORDER BY g.id)" \
+    "  FROM groups g WHERE g.document->>'tournamentId' = t.id::text" \
+    "), '[]'::json) AS groups"
+    namespace tournament {
+        inline constexpr PreparedStatement ReadAll{"select_all_tournaments", "SELECT id, document FROM tournaments"};
+        inline constexpr PreparedStatement ReadPage{"select_tournaments_page",
+            "SELECT id, document FROM tournaments WHERE id > $1 ORDER BY id LIMIT $2"};
+        inline constexpr PreparedStatement ReadById{"select_tournament_by_id", "SELECT id, document FROM tournaments WHERE id = $1"};
+        inline constexpr PreparedStatement Exists{"exists_tournament", "SELECT 1 FROM tournaments WHERE id = $1"};
+        inline constexpr PreparedStatement ReadByIds{"select_tournaments_by_ids", "SELECT id, document FROM tournaments WHERE id = ANY($1::uuid[])"};
+        inline constexpr PreparedStatement Insert{"insert_tournament", "INSERT INTO tournaments (id, document) VALUES ($1, $2::jsonb)"};
+        inline constexpr PreparedStatement Update{"update_tournament", "UPDATE tournaments SET document = $1::jsonb WHERE id = $2"};
+        inline constexpr PreparedStatement Delete{"delete_tournament", "DELETE FROM tournaments WHERE id = $1"};
+        inline constexpr std::string_view StreamAll = "SELECT id, document FROM tournaments";
+        // Cada documento del arreglo trae su id
+        inline constexpr PreparedStatement InsertMany{"insert_tournaments_batch",
+            "INSERT INTO tournaments (id, document) SELECT (doc->>'id')::uuid, doc FROM jsonb_array_elements($1::jsonb) AS t(doc)"};
+        // Torneo completo en una ida y vuelta: una fila con el documento, sus grupos (con los
+        // equipos leídos de TEAMS, en el orden de inscripción) y sus partidos, cada uno armado con
+        // json_agg en el servidor. Grupos y partidos usan idx_groups_tournament e idx_matches_tournament;
+        // un equipo que no está en TEAMS (o cuyo id no es UUID) se devuelve con la entrada del grupo.
+        // Con "matchStorage": "typed" se usa match_record::ReadTournamentAggregateById.
+        inline constexpr PreparedStatement ReadAggregateById{"select_tournament_aggregate",
+            "SELECT t.id, t.document, " TOURNAMENT_AGGREGATE_GROUPS ","
+            " COALESCE(("
+            "   SELECT json_agg(m.document || jsonb_build_object('id', m.id::text) ORDER BY m.id)"
+            "   FROM matches m WHERE m.document->>'tournamentId' = t.id::text"
+            " ), '[]'::json) AS matches"
+            " FROM tournaments t WHERE t.id = $1"};
+    }
+
+    namespace group {
+        inline constexpr PreparedStatement ReadAll{"select_all_groups", "SELECT id, document FROM groups"};
+        inline constexpr PreparedStatement ReadPage{"select_groups_page",
+            "SELECT id, document FROM groups WHERE id > $1 ORDER BY id LIMIT $2"};
+        inline constexpr PreparedStatement ReadPageByTournamentId{"select_groups_by_tournament_page",
+            "SELECT id, document FROM groups WHERE document->>'tournamentId' = $1 AND id > $2 ORDER BY id LIMIT $3"};
+        inline constexpr PreparedStatement ReadById{"select_group_by_id", "SELECT id, document FROM groups WHERE id = $1"};
+        inline constexpr PreparedStatement ReadByIds{"select_groups_by_ids", "SELECT id, document FROM groups WHERE id = ANY($1::uuid[])"};
+        inline constexpr PreparedStatement ReadTournamentIdById{"select_group_tournament_id",
+            "SELECT document->>'tournamentId' AS tournament_id FROM groups WHERE id = $1"};
+        // Inscripción de un lote: LockForTeams bloquea el grupo hasta el COMMIT, así la foto de
+        // cada AddTeam ya incluye lo que confirmaron las inscripciones concurrentes
+        inline constexpr PreparedStatement LockForTeams{"lock_group_for_teams",
+            "SELECT 1 FROM groups WHERE id = $1 AND document->>'tournamentId' = $2 FOR UPDATE"};
+        // El UPDATE solo aplica si el equipo existe, el grupo tiene cupo ($4) y el equipo no está
+        // ya en él; la consulta exterior (foto previa al UPDATE) explica por qué no se inscribió.
+        inline constexpr PreparedStatement AddTeam{"add_team_to_group", R"(
+            WITH team AS (
+                SELECT jsonb_build_object('id', id::text, 'name', document->>'name') AS entry
+                FROM teams WHERE id = $3::text::uuid
+            ), registered AS (
+                UPDATE groups g
+                SET document = jsonb_set(g.document, '{teams}', COALESCE(g.document->'teams', '[]'::jsonb) || jsonb_build_array(team.entry))
+                FROM team
+                WHERE g.id = $1 AND g.document->>'tournamentId' = $2
+                  AND jsonb_array_length(COALESCE(g.document->'teams', '[]'::jsonb)) < $4
+                  AND NOT COALESCE(g.document->'teams', '[]'::jsonb) @> jsonb_build_array(jsonb_build_object('id', $3::text))
+                RETURNING g.id
+            )
+            SELECT EXISTS (SELECT 1 FROM registered) AS registered,
+                   EXISTS (SELECT 1 FROM team) AS team_exists,
+                   COALESCE(document->'teams', '[]'::jsonb) @> jsonb_build_array(jsonb_build_object('id', $3::text)) AS duplicate
+            FROM groups WHERE id = $1 AND document->>'tournamentId' = $2
+        )"};
+        inline constexpr PreparedStatement Insert{"insert_group", "INSERT INTO groups (id, document) VALUES ($1, $2::jsonb)"};
+        inline constexpr PreparedStatement Update{"update_group", "UPDATE groups SET document = $1::jsonb WHERE id = $2"};
+        inline constexpr PreparedStatement Delete{"delete_group", "DELETE FROM groups WHERE id = $1"};
+        inline constexpr PreparedStatement InsertMany{"insert_groups_batch",
+            "INSERT INTO groups (id, document) SELECT (doc->>'id')::uuid, doc FROM jsonb_array_elements($1::jsonb) AS t(doc)"};
+    }
+
+    namespace match {
+        inline constexpr PreparedStatement ReadAll{"select_all_matches", "SELECT id, document FROM matches"};
+        inline constexpr PreparedStatement ReadPage{"select_matches_page",
+            "SELECT id, document FROM matches WHERE id > $1 ORDER BY id LIMIT $2"};
+        inline constexpr PreparedStatement ReadById{"select_match_by_id", "SELECT id, document FROM matches WHERE id = $1"};
+        // Lectura dentro de un read-modify-write: bloquea la fila hasta el COMMIT
+        inline constexpr PreparedStatement ReadByIdForUpdate{"select_match_by_id_for_update", "SELECT id, document FROM matches WHERE id = $1 FOR UPDATE"};
+        // Id generado en la aplicación: las sentencias siguientes del mismo lote ya lo conocen
+        inline constexpr PreparedStatement Insert{"insert_match", "INSERT INTO matches (id, document) VALUES ($1, $2::jsonb)"};
+        // Save en una sola sentencia: un id nuevo inserta, uno existente se reemplaza.
+        // RETURNING devuelve el documento tal como quedó (incluye lo que escriben los triggers).
+        inline constexpr PreparedStatement Upsert{"upsert_match",
+            "INSERT INTO matches (id, document) VALUES ($1, $2::jsonb)"
+            " ON CONFLICT (id) DO UPDATE SET document = EXCLUDED.document RETURNING id, document"};
+        inline constexpr PreparedStatement Update{"update_match", "UPDATE matches SET document = $1::jsonb WHERE id = $2"};
+        inline constexpr PreparedStatement Delete{"delete_match", "DELETE FROM matches WHERE id = $1"};
+        inline constexpr PreparedStatement InsertMany{"insert_matches_batch",
+            "INSERT INTO matches (id, document) SELECT (doc->>'id')::uuid, doc FROM jsonb_array_elements($1::jsonb) AS t(doc)"};
+        // Upsert en lote: los ids nuevos se insertan, los existentes se reemplazan.
+        inline constexpr PreparedStatement SaveMany{"upsert_matches_batch",
+            "INSERT INTO matches (id, document) SELECT (doc->>'id')::uuid, doc FROM jsonb_array_elements($1::jsonb) AS t(doc)"
+            " ON CONFLICT (id) DO UPDATE SET document = EXCLUDED.document"};
+        // Los finders reciben cursor y límite; LIMIT NULL equivale a sin límite.
+        inline constexpr PreparedStatement FindByTournamentId{"select_matches_by_tournament",
+            "SELECT id, document FROM matches WHERE document->>'tournamentId' = $1 AND id > $2 ORDER BY id LIMIT $3"};
+        inline constexpr PreparedStatement FindByTournamentIdAndPhase{"select_matches_by_tournament_and_phase",
+            "SELECT id, document FROM matches WHERE document->>'tournamentId' = $1 AND document->>'phase' = $2 AND id > $3 ORDER BY id LIMIT $4"};
+        inline constexpr PreparedStatement FindByGroupId{"select_matches_by_group",
+            "SELECT id, document FROM matches WHERE document->>'groupId' = $1 AND id > $2 ORDER BY id LIMIT $3"};
+        // El OR entre team1Id y team2Id no puede recorrer un índice en orden de id: cada rama usa
+        // su propio índice (idx_matches_team1 / idx_matches_team2) y la segunda excluye los
+        // partidos ya devueltos por la primera, así UNION ALL no necesita deduplicar.
+        inline constexpr PreparedStatement FindByTeamId{"select_matches_by_team", R"(
+            (SELECT id, document FROM matches
+             WHERE document->>'team1Id' = $1 AND id > $2 ORDER BY id LIMIT $3)
+            UNION ALL
+            (SELECT id, document FROM matches
+             WHERE document->>'team2Id' = $1 AND document->>'team1Id' IS DISTINCT FROM $1 AND id > $2 ORDER BY id LIMIT $3)
+            ORDER BY id LIMIT $3
+        )"};
+        inline constexpr PreparedStatement IsGroupStageComplete{"count_group_stage_matches", R"(
+            SELECT
+                COUNT(*) as total,
+                COUNT(*) FILTER (WHERE (document->>'status') = 'COMPLETED') as completed
+            FROM matches
+            WHERE (document->>'tournamentId') = $1 AND (document->>'phase') = 'GROUP_STAGE'
+        )"};
+        // Proyecciones: el servidor extrae los campos y el cliente no parsea el documento.
+        // Un grupo aparece en el orden de su primer partido, como al recorrer FindByTournamentIdAndPhase.
+        inline constexpr PreparedStatement FindGroupIdsByTournamentId{"select_group_ids_by_tournament", R"(
+            SELECT group_id FROM (
+                SELECT DISTINCT ON (document->>'groupId') document->>'groupId' AS group_id, id
+                FROM matches
+                WHERE document->>'tournamentId' = $1 AND document->>'phase' = 'GROUP_STAGE' AND document->>'groupId' <> ''
+                ORDER BY document->>'groupId', id
+            ) first_match
+            ORDER BY id
+        )"};
+        inline constexpr PreparedStatement FindCompletedResultsByGroupId{"select_match_results_by_group", R"(
+            SELECT document->>'team1Id' AS team1_id, document->>'team2Id' AS team2_id,
+                   COALESCE((document->>'team1Score')::int, 0) AS team1_score,
+                   COALESCE((document->>'team2Score')::int, 0) AS team2_score
+            FROM matches
+            WHERE document->>'groupId' = $1 AND document->>'status' = 'COMPLETED'
+              AND document->>'team1Id' IS NOT NULL AND document->>'team2Id' IS NOT NULL
+            ORDER BY id
+        )"};
+    }
+
+    // Partidos en columnas tipadas (MATCH_RECORDS, migración V005). Todas las lecturas devuelven
+    // las columnas en el orden de TypedMatchRepository::Decode; las escrituras reciben los
+    // valores en el orden de TypedMatchRepository::BindColumns.
+#define MATCH_RECORD_COLUMNS "id, tournament_id, group_id, phase, match_number, team1_id, team2_id, " \
+                             "team1_score, team2_score, status, next_match_id"
+#define MATCH_RECORD_VALUES "$2, $3, $4::match_phase, $5, $6, $7, $8, $9, $10::match_status, $11"
+    namespace match_record {
+        inline constexpr PreparedStatement ReadAll{"select_all_match_records", "SELECT " MATCH_RECORD_COLUMNS " FROM match_records"};
+        inline constexpr PreparedStatement ReadPage{"select_match_records_page",
+            "SELECT " MATCH_RECORD_COLUMNS " FROM match_records WHERE id > $1 ORDER BY id LIMIT $2"};
+        inline constexpr PreparedStatement ReadById{"select_match_record_by_id",
+            "SELECT " MATCH_RECORD_COLUMNS " FROM match_records WHERE id = $1"};
+        inline constexpr PreparedStatement ReadByIdForUpdate{"select_match_record_by_id_for_update",
+            "SELECT " MATCH_RECORD_COLUMNS " FROM match_records WHERE id = $1 FOR UPDATE"};
+        // $1 es el id, generado en la aplicación
+        inline constexpr PreparedStatement Insert{"insert_match_record",
+            "INSERT INTO match_records (" MATCH_RECORD_COLUMNS ") VALUES ($1, " MATCH_RECORD_VALUES ")"};
+        // Igual que match::Upsert: RETURNING trae la fila guardada
+        inline constexpr PreparedStatement Upsert{"upsert_match_record",
+            "INSERT INTO match_records (" MATCH_RECORD_COLUMNS ") VALUES ($1, " MATCH_RECORD_VALUES ")"
+            " ON CONFLICT (id) DO UPDATE SET tournament_id = EXCLUDED.tournament_id, group_id = EXCLUDED.group_id,"
+            " phase = EXCLUDED.phase, match_number = EXCLUDED.match_number, team1_id = EXCLUDED.team1_id,"
+            " team2_id = EXCLUDED.team2_id, team1_score = EXCLUDED.team1_score, team2_score = EXCLUDED.team2_score,"
+            " status = EXCLUDED.status, next_match_id = EXCLUDED.next_match_id RETURNING " MATCH_RECORD_COLUMNS};
+        inline constexpr PreparedStatement Update{"update_match_record",
+            "UPDATE match_records SET tournament_id = $2, group_id = $3, phase = $4::match_phase, match_number = $5,"
+            " team1_id = $6, team2_id = $7, team1_score = $8, team2_score = $9, status = $10::match_status,"
+            " next_match_id = $11 WHERE id = $1"};
+        inline constexpr PreparedStatement Delete{"delete_match_record", "DELETE FROM match_records WHERE id = $1"};
+        inline constexpr PreparedStatement FindByTournamentId{"select_match_records_by_tournament",
+            "SELECT " MATCH_RECORD_COLUMNS " FROM match_records WHERE tournament_id = $1 AND id > $2 ORDER BY id LIMIT $3"};
+        inline constexpr PreparedStatement FindByTournamentIdAndPhase{"select_match_records_by_tournament_and_phase",
+            "SELECT " MATCH_RECORD_COLUMNS " FROM match_records WHERE tournament_id = $1 AND phase = $2::match_phase AND id > $3 ORDER BY id LIMIT $4"};
+        inline constexpr PreparedStatement FindByGroupId{"select_match_records_by_group",
+            "SELECT " MATCH_RECORD_COLUMNS " FROM match_records WHERE group_id = $1 AND id > $2 ORDER BY id LIMIT $3"};
+        // Mismo esquema que match::FindByTeamId: una rama por índice, sin deduplicar
+        inline constexpr PreparedStatement FindByTeamId{"select_match_records_by_team",
+            "(SELECT " MATCH_RECORD_COLUMNS " FROM match_records WHERE team1_id = $1 AND id > $2 ORDER BY id LIMIT $3)"
+            " UNION ALL"
+            " (SELECT " MATCH_RECORD_COLUMNS " FROM match_records"
+            "  WHERE team2_id = $1 AND team1_id IS DISTINCT FROM $1 AND id > $2 ORDER BY id LIMIT $3)"
+            " ORDER BY id LIMIT $3"};
+        inline constexpr PreparedStatement IsGroupStageComplete{"count_group_stage_match_records",
+            "SELECT COUNT(*) AS total, COUNT(*) FILTER (WHERE status = 'COMPLETED') AS completed"
+            " FROM match_records WHERE tournament_id = $1 AND phase = 'GROUP_STAGE'"};
+        inline constexpr PreparedStatement FindGroupIdsByTournamentId{"select_match_record_group_ids_by_tournament",
+            "SELECT group_id FROM ("
+            "  SELECT DISTINCT ON (group_id) group_id, id FROM match_records"
+            "  WHERE tournament_id = $1 AND phase = 'GROUP_STAGE' AND group_id IS NOT NULL ORDER BY group_id, id"
+            ") first_match ORDER BY id"};
+        inline constexpr PreparedStatement FindCompletedResultsByGroupId{"select_match_record_results_by_group",
+            "SELECT team1_id, team2_id, COALESCE(team1_score, 0), COALESCE(team2_score, 0) FROM match_records"
+            " WHERE group_id = $1 AND status = 'COMPLETED' AND team1_id IS NOT NULL AND team2_id IS NOT NULL ORDER BY id"};
+        // tournament::ReadAggregateById con los partidos de MATCH_RECORDS (idx_match_records_tournament),
+        // cada uno con las llaves y valores de to_json(domain::Match)
+        inline constexpr PreparedStatement ReadTournamentAggregateById{"select_tournament_aggregate_typed",
+            "SELECT t.id, t.document, " TOURNAMENT_AGGREGATE_GROUPS ","
+            " COALESCE(("
+            "   SELECT json_agg(json_build_object("
+            "       'id', r.id::text, 'tournamentId', r.tournament_id::text, 'groupId', COALESCE(r.group_id::text, ''),"
+            "       'phase', r.phase::text, 'matchNumber', r.match_number,"
+            "       'team1Id', r.team1_id::text, 'team2Id', r.team2_id::text,"
+            "       'team1Score', r.team1_score, 'team2Score', r.team2_score,"
+            "       'status', r.status::text, 'nextMatchId', r.next_match_id::text) ORDER BY r.id)"
+            "   FROM match_records r WHERE r.tournament_id = t.id"
+            " ), '[]'::json) AS matches"
+            " FROM tournaments t WHERE t.id = $1"};
+    }
+#undef MATCH_RECORD_VALUES
+#undef MATCH_RECORD_COLUMNS
+#undef TOURNAMENT_AGGREGATE_GROUPS
+}
+
+class StatementRegistry {
+public:
+    static constexpr std::array All{
+        statements::team::ReadAll, statements::team::ReadPage, statements::team::ReadById, statements::team::ReadByIds, statements::team::Insert,
+        statements::team::Update, statements::team::Delete,
+
+        statements::tournament::ReadAll, statements::tournament::ReadPage, statements::tournament::ReadById, statements::tournament::Exists, statements::tournament::ReadByIds, statements::tournament::Insert,
+        statements::tournament::Update, statements::tournament::Delete, statements::tournament::InsertMany, statements::tournament::ReadAggregateById,
+
+        statements::group::ReadAll, statements::group::ReadPage, statements::group::ReadPageByTournamentId,
+        statements::group::ReadById, statements::group::ReadTournamentIdById, statements::group::ReadByIds, statements::group::AddTeam, statements::group::LockForTeams, statements::group::Insert,
+        statements::group::Update, statements::group::Delete, statements::group::InsertMany,
+
+        statements::match::ReadAll, statements::match::ReadPage, statements::match::ReadById,
+        statements::match::ReadByIdForUpdate, statements::match::Insert, statements::match::Upsert,
+        statements::match::Update, statements::match::Delete,
+        statements::match::InsertMany, statements::match::SaveMany,
+        statements::match::FindByTournamentId, statements::match::FindByTournamentIdAndPhase,
+        statements::match::FindByGroupId, statements::match::FindByTeamId,
+        statements::match::IsGroupStageComplete,
+        statements::match::FindGroupIdsByTournamentId, statements::match::FindCompletedResultsByGroupId,
+    };
+
+    // Sentencias de MATCH_RECORDS (V005). No van en All: PrepareAll corre al abrir cada conexión
+    // del pool y fallaría en una base sin esa migración aunque se use el almacenamiento "document".
+    // TypedMatchRepository las prepara en cada conexión la primera vez que la usa.
+    static constexpr std::array MatchRecords{
+        statements::match_record::ReadAll, statements::match_record::ReadPage, statements::match_record::ReadById,
+        statements::match_record::ReadByIdForUpdate, statements::match_record::Insert, statements::match_record::Upsert,
+        statements::match_record::Update, statements::match_record::Delete,
+        statements::match_record::FindByTournamentId, statements::match_record::FindByTournamentIdAndPhase,
+        statements::match_record::FindByGroupId, statements::match_record::FindByTeamId,
+        statements::match_record::IsGroupStageComplete,
+        statements::match_record::FindGroupIdsByTournamentId, statements::match_record::FindCompletedResultsByGroupId,
+        statements::match_record::ReadTournamentAggregateById,
+    };
+
+    static void PrepareAll(pqxx::connection& connection) {
+        Prepare(connection, All);
+    }
+
+    // Prepara las de MatchRecords que falten; prepared cuenta las que ya tiene la conexión
+    // (PostgresConnection::matchRecordsPrepared). Se llama antes de abrir la transacción: si una
+    // falla (p. ej. la base no tiene V005) la excepción llega al catch del repositorio y el
+    // siguiente uso retoma desde esa sentencia.
+    static void PrepareMatchRecords(pqxx::connection& connection, size_t& prepared) {
+        for (; prepared < MatchRecords.size(); prepared++) {
+            connection.prepare(MatchRecords[prepared].name, MatchRecords[prepared].sql);
+        }
+    }
+
+    static void Prepare(pqxx::connection& connection, std::span<const PreparedStatement> statements) {
+        for (const auto& statement : statements) {
+            connection.prepare(statement.name, statement.sql);
+        }
+    }
+};
+
+#endif //TOURNAMENTS_STATEMENTREGISTRY_HPP
@@ -0,0 +1,49 @@
+#ifndef TOURNAMENTS_UUIDTRAITS_HPP
+#define TOURNAMENTS_UUIDTRAITS_HPP
+
+#include <pqxx/pqxx>
+#include <string>
+
+#include "domain/Uuid.hpp"
+
+// Conversión de domain::Uuid para pqxx: se enlaza como parámetro y se lee con field::as<domain::Uuid>()
+// de columnas uuid. Un texto que no es UUID lanza conversion_error, así que las columnas de texto
+// (p. ej. document->>'team1Id') se leen con field::view() y domain::Uuid::Parse.
+namespace pqxx {
+    template<>
+    struct nullness<domain::Uuid> : no_null<domain::Uuid> {};
+
+    template<>
+    struct string_traits<domain::Uuid> {
+        static constexpr bool converts_to_string{true};
+        static constexpr bool converts_from_string{true};
+
+        static std::size_t size_buffer(const domain::Uuid&) noexcept {
+            return domain::Uuid::TextLength + 1;
+        }
+
+        static char* into_buf(char* begin, char* end, const domain::Uuid& value) {
+            if (end - begin < static_cast<std::ptrdiff_t>(size_buffer(value))) {
+                throw conversion_overrun("Buffer too small for a UUID");
+            }
+            char* last = value.FormatTo(begin);
+            *last++ = '\0';
+            return last;
+        }
+
+        static zview to_buf(char* begin, char* end, const domain::Uuid& value) {
+            into_buf(begin, end, value);
+            return zview(begin, domain::Uuid::TextLength);
+        }
+
+        static domain::Uuid from_string(std::string_view text) {
+            const auto parsed = domain::Uuid::Parse(text);
+            if (!parsed) {
+                throw conversion_error("Invalid UUID: " + std::string(text));
+            }
+            return *parsed;
+        }
+    };
+} // namespace pqxx
+
+#endif //TOURNAMENTS_UUIDTRAITS_HPP
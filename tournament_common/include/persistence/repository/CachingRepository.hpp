@@ -0,0 +1,252 @@
+#ifndef TOURNAMENTS_CACHINGREPOSITORY_HPP
+#define TOURNAMENTS_CACHINGREPOSITORY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "persistence/repository/IRepository.hpp"
+#include "persistence/cache/CacheConfiguration.hpp"
+#include "persistence/cache/CacheMetrics.hpp"
+#include "persistence/cache/ShardedLruCache.hpp"
+#include "persistence/configuration/ReadYourWritesSession.hpp"
+
+// Decorador de IRepository que cachea ReadById, ReadByIdAsync y ReadByIds (read-through). Los ids
+// inexistentes también se recuerdan durante negativeTtl (corto: los repositorios también
+// devuelven nullptr cuando la consulta falla). Cada escritura invalida el id afectado después de llegar a la BD;
+// los listados (ReadAll, ReadPage, StreamAll) pasan directo al repositorio decorado.
+//
+// Un id invalidado (escritura local o Evict de otra instancia) se recarga desde el primario
+// durante ttl: una réplica atrasada devolvería la versión anterior y el caché la guardaría.
+//
+// El caché guarda una copia inmutable y ReadById devuelve una copia nueva, así un llamador que
+// modifique la entidad no altera lo que ven los demás.
+template<class T>
+class CachingRepository : public IRepository<T, std::string> {
+    std::shared_ptr<IRepository<T, std::string>> repository;
+    CacheConfiguration configuration;
+    // nullptr = el id no existe (caché negativo). Compartido con los callbacks de
+    // ReadByIdAsync, que pueden llegar cuando el decorador ya se destruyó.
+    using Cache = ShardedLruCache<std::string, std::shared_ptr<const T>>;
+    std::shared_ptr<Cache> cache;
+    // Ids invalidados cuya próxima carga debe leer del primario
+    std::shared_ptr<ShardedLruCache<std::string, bool>> invalidated;
+
+    std::atomic<uint64_t> negativeHits{0};
+    std::atomic<uint64_t> invalidations{0};
+
+    void Invalidate(const std::string& id) {
+        cache->Invalidate(id);
+        invalidated->Put(id, true, configuration.ttl);
+        ++invalidations;
+    }
+
+    bool WasInvalidated(const std::string& id) {
+        return invalidated->Get(id).has_value();
+    }
+
+    // Ejecuta la carga con las lecturas en el primario si primary es true
+    template<typename Load>
+    decltype(auto) LoadFrom(bool primary, Load load) {
+        if (!primary) {
+            return load();
+        }
+        auto session = ReadYourWritesSession::PrimaryOnly();
+        ReadYourWritesScope scope(session);
+        return load();
+    }
+
+public:
+    CachingRepository(std::shared_ptr<IRepository<T, std::string>> repository, CacheConfiguration configuration)
+        : repository(std::move(repository)), configuration(configuration),
+          cache(std::make_shared<Cache>(configuration.capacity, configuration.shards)),
+          invalidated(std::make_shared<ShardedLruCache<std::string, bool>>(configuration.capacity, configuration.shards)) {}
+
+    std::shared_ptr<T> ReadById(std::string id) override {
+        if (auto cached = cache->Get(id)) {
+            if (*cached == nullptr) {
+                ++negativeHits;
+                return nullptr;
+            }
+            return std::make_shared<T>(**cached);
+        }
+
+        const auto generation = cache->Generation(id);
+        auto entity = LoadFrom(WasInvalidated(id), [&] { return repository->ReadById(id); });
+        if (entity) {
+            cache->PutIfUnchanged(id, std::make_shared<const T>(*entity), configuration.ttl, generation);
+        } else {
+            cache->PutIfUnchanged(id, nullptr, configuration.negativeTtl, generation);
+        }
+        return entity;
+    }
+
+    // Un acierto (positivo o negativo) responde sin ir a la BD; un fallo no llena el caché,
+    // ya que Exists no lee la entidad
+    bool Exists(std::string id) override {
+        if (auto cached = cache->Get(id)) {
+            if (*cached == nullptr) {
+                ++negativeHits;
+                return false;
+            }
+            return true;
+        }
+        return repository->Exists(std::move(id));
+    }
+
+    void ReadByIdAsync(std::string id, typename IRepository<T, std::string>::ReadCallback callback) override {
+        if (auto cached = cache->Get(id)) {
+            if (*cached == nullptr) {
+                ++negativeHits;
+                callback(std::shared_ptr<T>());
+                return;
+            }
+            callback(std::make_shared<T>(**cached));
+            return;
+        }
+
+        const auto generation = cache->Generation(id);
+        auto fill = [cache = cache, configuration = configuration, id, generation, callback = std::move(callback)](
+                std::expected<std::shared_ptr<T>, std::exception_ptr> entity) {
+            // los errores (p. ej. pool agotado) no se recuerdan
+            if (entity && *entity) {
+                cache->PutIfUnchanged(id, std::make_shared<const T>(**entity), configuration.ttl, generation);
+            } else if (entity) {
+                cache->PutIfUnchanged(id, nullptr, configuration.negativeTtl, generation);
+            }
+            callback(std::move(entity));
+        };
+        // la sesión solo importa al encolar: ahí el repositorio elige el ejecutor (réplica o primario)
+        LoadFrom(WasInvalidated(id), [&] { repository->ReadByIdAsync(id, std::move(fill)); });
+    }
+
+    // Los aciertos salen del caché y los fallos se piden juntos en un solo ReadByIds. A
+    // diferencia del repositorio decorado, el resultado sigue el orden de la primera aparición
+    // de cada id, así no depende de qué ids estaban cacheados.
+    std::vector<std::shared_ptr<T>> ReadByIds(std::span<const std::string> ids) override {
+        std::vector<std::string> unique;
+        for (const auto& id : ids) {
+            if (std::find(unique.begin(), unique.end(), id) == unique.end()) {
+                unique.push_back(id);
+            }
+        }
+
+        std::vector<std::shared_ptr<T>> slots(unique.size());
+        std::vector<std::string> missing;
+        for (size_t i = 0; i < unique.size(); i++) {
+            if (auto cached = cache->Get(unique[i])) {
+                if (*cached == nullptr) {
+                    ++negativeHits;
+                } else {
+                    slots[i] = std::make_shared<T>(**cached);
+                }
+                continue;
+            }
+            missing.push_back(unique[i]);
+        }
+
+        if (!missing.empty()) {
+            // una generación por llave: cada una solo la cancela una escritura en su shard
+            std::vector<uint64_t> generations;
+            generations.reserve(missing.size());
+            for (const auto& id : missing) {
+                generations.push_back(cache->Generation(id));
+            }
+            const bool primary = std::any_of(missing.begin(), missing.end(), [this](const auto& id) { return WasInvalidated(id); });
+            auto found = LoadFrom(primary, [&] { return repository->ReadByIds(missing); });
+            std::vector<bool> loaded(missing.size(), false);
+            for (auto& entity : found) {
+                const auto position = std::find(missing.begin(), missing.end(), entity->Id());
+                if (position == missing.end()) {
+                    continue;
+                }
+                const auto index = position - missing.begin();
+                loaded[index] = true;
+                cache->PutIfUnchanged(entity->Id(), std::make_shared<const T>(*entity), configuration.ttl, generations[index]);
+                const auto slot = std::find(unique.begin(), unique.end(), entity->Id());
+                if (slot != unique.end()) {
+                    slots[slot - unique.begin()] = std::move(entity);
+                }
+            }
+            for (size_t i = 0; i < missing.size(); i++) {
+                if (!loaded[i]) {
+                    cache->PutIfUnchanged(missing[i], nullptr, configuration.negativeTtl, generations[i]);
+                }
+            }
+        }
+
+        std::erase(slots, nullptr);
+        return slots;
+    }
+
+    std::optional<std::string> Create(const T& entity) override {
+        auto id = repository->Create(entity);
+        if (id) {
+            // puede haber una entrada negativa si alguien consultó el id antes de crearlo
+            Invalidate(*id);
+        }
+        return id;
+    }
+
+    std::vector<std::string> CreateMany(const std::vector<T>& entities) override {
+        auto ids = repository->CreateMany(entities);
+        for (const auto& id : ids) {
+            Invalidate(id);
+        }
+        return ids;
+    }
+
+    std::string Update(const T& entity) override {
+        auto result = repository->Update(entity);
+        Invalidate(entity.Id());
+        return result;
+    }
+
+    void Delete(std::string id) override {
+        repository->Delete(id);
+        Invalidate(id);
+    }
+
+    std::vector<std::shared_ptr<T>> ReadAll() override {
+        return repository->ReadAll();
+    }
+
+    std::vector<std::shared_ptr<T>> ReadPage(const PageRequest& page) override {
+        return repository->ReadPage(page);
+    }
+
+    bool StreamAll(const std::function<void(const T&)>& consumer) override {
+        return repository->StreamAll(consumer);
+    }
+
+    // Invalidación que llega de otra réplica (ver CacheInvalidationListener)
+    void Evict(const std::string& id) {
+        Invalidate(id);
+    }
+
+    void Clear() {
+        cache->Clear();
+    }
+
+    CacheMetrics Metrics() const {
+        CacheMetrics metrics;
+        metrics.size = cache->Size();
+        metrics.capacity = cache->Capacity();
+        metrics.hits = cache->Hits();
+        metrics.negativeHits = negativeHits.load();
+        metrics.misses = cache->Misses();
+        metrics.evictions = cache->Evictions();
+        metrics.expirations = cache->Expirations();
+        metrics.invalidations = invalidations.load();
+        return metrics;
+    }
+};
+
+#endif //TOURNAMENTS_CACHINGREPOSITORY_HPP
@@ -5,24 +5,28 @@
 #include <memory>
 #include <vector>
 #include <optional>
-#include "persistence/repository/IRepository.hpp"
+#include <span>
+#include "persistence/repository/IGroupRepository.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
 
-// Forward declaration para no necesitar el include completo aquí
-namespace domain {
-    class Group;
-}
-
-class GroupRepository : public IRepository<domain::Group, std::string> {
+class GroupRepository : public IGroupRepository {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
 public:
     explicit GroupRepository(std::shared_ptr<IDbConnectionProvider> provider);
 
     std::optional<std::string> Create(const domain::Group & entity) override;
+    std::vector<std::string> CreateMany(const std::vector<domain::Group>& entities) override;
     std::shared_ptr<domain::Group> ReadById(std::string id) override;
+    std::vector<std::shared_ptr<domain::Group>> ReadByIds(std::span<const std::string> ids) override;
     std::string Update(const domain::Group & entity) override;
     void Delete(std::string id) override;
     std::vector<std::shared_ptr<domain::Group>> ReadAll() override;
+    std::vector<std::shared_ptr<domain::Group>> ReadPage(const PageRequest& page) override;
+    std::vector<std::shared_ptr<domain::Group>> FindByTournamentId(const std::string& tournamentId) override;
+    std::vector<std::shared_ptr<domain::Group>> ReadPageByTournamentId(const std::string& tournamentId, const PageRequest& page) override;
+    std::optional<std::string> FindTournamentIdById(const std::string& groupId) override;
+    std::optional<TeamsRegistration> AddTeams(const std::string& tournamentId, const std::string& groupId,
+                                              std::span<const std::string> teamIds, int maxTeams) override;
 };
 
 #endif //TOURNAMENTS_GROUPREPOSITORY_HPP
\ No newline at end of file
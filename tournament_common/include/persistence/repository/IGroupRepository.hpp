@@ -0,0 +1,48 @@
+#ifndef TOURNAMENTS_IGROUPREPOSITORY_HPP
+#define TOURNAMENTS_IGROUPREPOSITORY_HPP
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/PageRequest.hpp"
+#include "domain/Group.hpp"
+
+// Resultado de inscribir un equipo en un grupo
+enum class TeamRegistration { Registered, GroupNotFound, TeamNotFound, AlreadyRegistered, GroupFull };
+
+// Resultado de inscribir un lote: Registered si entraron todos; si no, el motivo y el equipo
+// rechazado (vacío para GroupNotFound)
+struct TeamsRegistration {
+    TeamRegistration status;
+    std::string teamId;
+};
+
+class IGroupRepository : public IRepository<domain::Group, std::string> {
+public:
+    ~IGroupRepository() override = default;
+
+    // Grupos de un torneo resueltos en SQL (idx_groups_tournament), sin leer la tabla completa
+    virtual std::vector<std::shared_ptr<domain::Group>> FindByTournamentId(const std::string& tournamentId) = 0;
+    virtual std::vector<std::shared_ptr<domain::Group>> ReadPageByTournamentId(const std::string& tournamentId, const PageRequest& page) = 0;
+
+    // Torneo al que pertenece el grupo (nullopt si no existe), sin leer el documento completo.
+    // La implementación por defecto se apoya en ReadById.
+    virtual std::optional<std::string> FindTournamentIdById(const std::string& groupId) {
+        auto group = ReadById(groupId);
+        if (group == nullptr) return std::nullopt;
+        return group->TournamentId();
+    }
+
+    // Agrega los equipos al grupo en una sola transacción con la fila del grupo bloqueada: el
+    // cupo (maxTeams) y los repetidos se comprueban sobre la última versión, así que dos
+    // inscripciones concurrentes no pueden pasar el cupo ni perderse. Si un equipo no entra no
+    // se inscribe ninguno. nullopt si la consulta falla.
+    virtual std::optional<TeamsRegistration> AddTeams(const std::string& tournamentId, const std::string& groupId,
+                                                      std::span<const std::string> teamIds, int maxTeams) = 0;
+};
+
+#endif //TOURNAMENTS_IGROUPREPOSITORY_HPP
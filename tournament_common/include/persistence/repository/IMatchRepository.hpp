@@ -3,25 +3,161 @@
 
 #include "persistence/repository/IRepository.hpp"
 #include "domain/Match.hpp" // Incluir Match
+#include "domain/Uuid.hpp"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <optional>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <memory>
 
 
 namespace repository { 
 
+// Id de equipo dentro de la tabla de posiciones. Un UUID en forma canónica (minúsculas, como
+// lo escribe GenerateUuid) se guarda en 16 bytes sin asignar memoria; cualquier otro texto,
+// p. ej. los ids heredados como "team-1", se conserva tal cual y cuenta igual que antes.
+class TeamKey {
+    domain::Uuid uuid;
+    std::string text; // solo si isUuid es false
+    bool isUuid = false;
+
+    // Texto del id sin asignar memoria; buffer solo se usa para un UUID
+    std::string_view View(std::array<char, domain::Uuid::TextLength>& buffer) const {
+        if (!isUuid) return text;
+        uuid.FormatTo(buffer.data());
+        return {buffer.data(), buffer.size()};
+    }
+
+public:
+    TeamKey() = default;
+    TeamKey(const domain::Uuid& uuid) : uuid(uuid), isUuid(true) {}
+
+    static TeamKey FromText(std::string_view text) {
+        if (const auto parsed = domain::Uuid::Parse(text)) {
+            std::array<char, domain::Uuid::TextLength> canonical;
+            parsed->FormatTo(canonical.data());
+            // un UUID en mayúsculas se conserva como texto para devolver el mismo id
+            if (std::string_view(canonical.data(), canonical.size()) == text) {
+                return TeamKey(*parsed);
+            }
+        }
+        TeamKey key;
+        key.text = text;
+        return key;
+    }
+
+    [[nodiscard]] bool IsUuid() const { return isUuid; }
+    [[nodiscard]] std::string ToString() const { return isUuid ? uuid.ToString() : text; }
+
+    bool operator==(const TeamKey& other) const {
+        return isUuid == other.isUuid && (isUuid ? uuid == other.uuid : text == other.text);
+    }
+
+    // Orden del texto del id, como el std::map que ordenaba la tabla antes; entre dos UUID
+    // canónicos el orden de los bytes es el mismo y no hace falta formatearlos
+    bool operator<(const TeamKey& other) const {
+        if (isUuid && other.isUuid) return uuid < other.uuid;
+        std::array<char, domain::Uuid::TextLength> left, right;
+        return View(left) < other.View(right);
+    }
+};
+
+// Proyección de un partido terminado con sus dos equipos: lo único que necesita la tabla de
+// posiciones de un grupo.
+struct MatchResult {
+    TeamKey team1Id;
+    TeamKey team2Id;
+    int team1Score = 0;
+    int team2Score = 0;
+
+    // Los ids de equipo se guardan como texto
+    static MatchResult FromText(std::string_view team1Id, std::string_view team2Id, int team1Score, int team2Score) {
+        return MatchResult{TeamKey::FromText(team1Id), TeamKey::FromText(team2Id), team1Score, team2Score};
+    }
+};
+
 // Usar 'domain::Match' directamente
 class IMatchRepository : public IRepository<domain::Match, std::string> {
 public:
     virtual ~IMatchRepository() = default;
     
-    virtual std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(std::string tournamentId) = 0;
+    // Los finders aceptan una página opcional (keyset por id); sin página devuelven todo
+    virtual std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(std::string tournamentId, const PageRequest& page = {}) = 0;
     // Usar 'domain::MatchPhase'
-    virtual std::vector<std::shared_ptr<domain::Match>> FindByTournamentIdAndPhase(std::string tournamentId, domain::MatchPhase phase) = 0;
-    virtual std::vector<std::shared_ptr<domain::Match>> FindByGroupId(std::string groupId) = 0;
-    virtual std::vector<std::shared_ptr<domain::Match>> FindByTeamId(std::string teamId) = 0;
+    // Variante para una petición: el vector y cada partido (objeto y bloque de control en una
+    // sola asignación) se piden a arena, así que no deben sobrevivirla. La implementación por
+    // defecto mueve a la arena el resultado del finder.
+    using ArenaMatches = std::pmr::vector<std::shared_ptr<domain::Match>>;
+    virtual ArenaMatches FindByTournamentId(std::string tournamentId, const PageRequest& page, std::pmr::memory_resource* arena) {
+        auto matches = FindByTournamentId(std::move(tournamentId), page);
+        return ArenaMatches(std::make_move_iterator(matches.begin()), std::make_move_iterator(matches.end()), arena);
+    }
+    virtual std::vector<std::shared_ptr<domain::Match>> FindByTournamentIdAndPhase(std::string tournamentId, domain::MatchPhase phase, const PageRequest& page = {}) = 0;
+    virtual std::vector<std::shared_ptr<domain::Match>> FindByGroupId(std::string groupId, const PageRequest& page = {}) = 0;
+    virtual std::vector<std::shared_ptr<domain::Match>> FindByTeamId(std::string teamId, const PageRequest& page = {}) = 0;
     virtual bool IsGroupStageComplete(std::string tournamentId) = 0;
+    // Upsert: sin id inserta y con id reemplaza (o inserta con ese id). Devuelve el partido guardado.
     virtual domain::Match Save(const domain::Match& match) = 0;
+
+    // Proyecciones: solo las columnas que usa el llamador, sin convertir el partido completo.
+    // Las implementaciones por defecto se apoyan en los finders.
+
+    // Grupos con partidos de fase de grupos en el torneo, en el orden de su primer partido
+    virtual std::vector<std::string> FindGroupIdsByTournamentId(std::string tournamentId) {
+        std::vector<std::string> groupIds;
+        for (const auto& match : FindByTournamentIdAndPhase(std::move(tournamentId), domain::MatchPhase::GROUP_STAGE)) {
+            if (!match->GroupId().empty() && std::find(groupIds.begin(), groupIds.end(), match->GroupId()) == groupIds.end()) {
+                groupIds.push_back(match->GroupId());
+            }
+        }
+        return groupIds;
+    }
+
+    // Partidos terminados del grupo con ambos equipos asignados; un marcador ausente cuenta como 0
+    virtual std::vector<MatchResult> FindCompletedResultsByGroupId(std::string groupId) {
+        std::vector<MatchResult> results;
+        for (const auto& match : FindByGroupId(std::move(groupId))) {
+            if (!match->IsComplete() || !match->HasBothTeams()) continue;
+            results.push_back(MatchResult::FromText(*match->Team1Id(), *match->Team2Id(),
+                                                    match->Team1Score().value_or(0), match->Team2Score().value_or(0)));
+        }
+        return results;
+    }
+
+    // Guarda (inserta o actualiza) todos los partidos; devuelve los partidos con su id asignado.
+    virtual std::vector<domain::Match> SaveAll(const std::vector<domain::Match>& matches) {
+        std::vector<domain::Match> saved;
+        saved.reserve(matches.size());
+        for (const auto& match : matches) {
+            saved.push_back(Save(match));
+        }
+        return saved;
+    }
+
+    // Lee el partido, aplica modify y lo guarda en una sola transacción. Devuelve nullptr si no
+    // existe; si modify lanza, no se guarda nada y la excepción se propaga.
+    virtual std::shared_ptr<domain::Match> UpdateById(const std::string& id, const std::function<void(domain::Match&)>& modify) {
+        auto match = ReadById(id);
+        if (!match) return nullptr;
+        modify(*match);
+        Update(*match);
+        return match;
+    }
+
+    // Crea nextMatch y enlaza completedMatch con él (nextMatchId) en una sola transacción.
+    // Devuelve nextMatch con su id asignado.
+    virtual domain::Match CreateLinked(const domain::Match& nextMatch, const domain::Match& completedMatch) {
+        auto saved = Save(nextMatch);
+        auto linked = completedMatch;
+        linked.SetNextMatchId(saved.Id());
+        Update(linked);
+        return saved;
+    }
 };
 }
 #endif
\ No newline at end of file
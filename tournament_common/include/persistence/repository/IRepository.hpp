@@ -1,10 +1,17 @@
 #ifndef RESTAPI_IREPOSITORY_HPP
 #define RESTAPI_IREPOSITORY_HPP
 
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <string>
 #include <optional> // CAMBIO: Incluir para std::optional
+#include <functional>
+#include <exception>
+#include <expected>
+#include <span>
+
+#include "persistence/repository/PageRequest.hpp"
 
 template<class T, class Y>
 class IRepository {
@@ -13,9 +20,72 @@ public:
     
 
     virtual std::optional<std::string> Create(const T& entity) = 0;
+
+    // Inserta todas las entidades o ninguna (una sola transacción); devuelve los ids en el mismo
+    // orden o un vector vacío si falla. Sin implementación por defecto: un Create por entidad
+    // dejaría guardadas las anteriores a la que falle.
+    virtual std::vector<std::string> CreateMany(const std::vector<T>& entities) = 0;
     
     virtual std::shared_ptr<T> ReadById(Y id) = 0;
+
+    // Lo que lanzaría ReadById (p. ej. ConnectionAcquireTimeout) llega al callback como error.
+    using ReadCallback = std::function<void(std::expected<std::shared_ptr<T>, std::exception_ptr>)>;
+
+    // ReadById sin bloquear al llamador: el callback puede correr en otro hilo (el reactor de
+    // AsyncQueryExecutor). La implementación por defecto llama a ReadById y responde en el acto.
+    virtual void ReadByIdAsync(Y id, ReadCallback callback) {
+        std::expected<std::shared_ptr<T>, std::exception_ptr> result;
+        try {
+            result = ReadById(std::move(id));
+        } catch (...) {
+            result = std::unexpected(std::current_exception());
+        }
+        callback(std::move(result));
+    }
+    // Varias entidades en una sola consulta. Devuelve las que existen, sin repetidos y sin
+    // orden garantizado; los ids inexistentes se omiten. La implementación por defecto hace un
+    // ReadById por id.
+    virtual std::vector<std::shared_ptr<T>> ReadByIds(std::span<const Y> ids) {
+        std::vector<std::shared_ptr<T>> entities;
+        entities.reserve(ids.size());
+        for (size_t i = 0; i < ids.size(); i++) {
+            if (std::find(ids.begin(), ids.begin() + i, ids[i]) != ids.begin() + i) continue;
+            if (auto entity = ReadById(ids[i])) {
+                entities.push_back(std::move(entity));
+            }
+        }
+        return entities;
+    }
+
     virtual std::vector<std::shared_ptr<T>> ReadAll() = 0;
+
+    // Solo comprueba que el id exista, sin leer ni convertir la entidad. La implementación por
+    // defecto se apoya en ReadById.
+    virtual bool Exists(Y id) {
+        return ReadById(std::move(id)) != nullptr;
+    }
+
+    // Recorre la tabla fila por fila sin materializarla; devuelve false si la lectura falló.
+    // La implementación por defecto se apoya en ReadAll.
+    virtual bool StreamAll(const std::function<void(const T&)>& consumer) {
+        for (const auto& entity : ReadAll()) {
+            consumer(*entity);
+        }
+        return true;
+    }
+
+    // Una página ordenada por id (ver PageRequest). La implementación por defecto filtra ReadAll.
+    virtual std::vector<std::shared_ptr<T>> ReadPage(const PageRequest& page) {
+        auto entities = ReadAll();
+        std::sort(entities.begin(), entities.end(), [](const auto& a, const auto& b) { return a->Id() < b->Id(); });
+        if (page.after) {
+            std::erase_if(entities, [&page](const auto& entity) { return entity->Id() <= *page.after; });
+        }
+        if (page.limit && entities.size() > *page.limit) {
+            entities.resize(*page.limit);
+        }
+        return entities;
+    }
     
 
     virtual std::string Update(const T& entity) = 0;
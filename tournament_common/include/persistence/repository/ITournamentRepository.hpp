@@ -0,0 +1,19 @@
+#ifndef TOURNAMENTS_ITOURNAMENTREPOSITORY_HPP
+#define TOURNAMENTS_ITOURNAMENTREPOSITORY_HPP
+
+#include <memory>
+#include <string>
+
+#include "persistence/repository/IRepository.hpp"
+#include "domain/Tournament.hpp"
+
+class ITournamentRepository : public IRepository<domain::Tournament, std::string> {
+public:
+    ~ITournamentRepository() override = default;
+
+    // Torneo con sus grupos (con los equipos de cada uno) y sus partidos, leído con una sola
+    // consulta; nullptr si no existe o si la lectura falla.
+    virtual std::shared_ptr<domain::Tournament> ReadAggregateById(const std::string& id) = 0;
+};
+
+#endif //TOURNAMENTS_ITOURNAMENTREPOSITORY_HPP
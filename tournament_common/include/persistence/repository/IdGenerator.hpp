@@ -0,0 +1,67 @@
+#ifndef TOURNAMENTS_IDGENERATOR_HPP
+#define TOURNAMENTS_IDGENERATOR_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "domain/Uuid.hpp"
+
+// Genera un UUIDv7 (RFC 9562) en la aplicación: 48 bits de milisegundos Unix, 12 bits de
+// contador y 62 aleatorios. Los repositorios asignan así todos los ids antes de escribir, de modo
+// que el llamador los conoce sin esperar un RETURNING y las inserciones caen al final del índice
+// de la llave primaria en lugar de repartirse por todas sus páginas.
+//
+// Dentro de un hilo los ids son estrictamente crecientes: en el mismo milisegundo avanza el
+// contador y, si se agota o el reloj retrocede, se sigue desde el último milisegundo usado.
+inline domain::Uuid GenerateUuidValue() {
+    thread_local std::mt19937_64 engine{std::random_device{}()};
+    thread_local uint64_t lastMillis = 0;
+    thread_local uint16_t counter = 0;
+
+    const auto now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    if (now > lastMillis) {
+        lastMillis = now;
+        counter = static_cast<uint16_t>(engine() & 0x1FF); // inicio aleatorio con margen para el contador
+    } else if (++counter > 0xFFF) {
+        ++lastMillis;
+        counter = 0;
+    }
+
+    std::array<uint8_t, 16> bytes{};
+    for (size_t i = 0; i < 6; i++) {
+        bytes[i] = static_cast<uint8_t>(lastMillis >> (40 - i * 8));
+    }
+    bytes[6] = static_cast<uint8_t>(0x70 | (counter >> 8)); // versión 7
+    bytes[7] = static_cast<uint8_t>(counter);
+    const uint64_t random = engine();
+    for (size_t i = 8; i < 16; i++) {
+        bytes[i] = static_cast<uint8_t>(random >> ((15 - i) * 8));
+    }
+    bytes[8] = static_cast<uint8_t>((bytes[8] & 0x3F) | 0x80); // variante RFC 9562
+    return domain::Uuid(bytes);
+}
+
+inline std::string GenerateUuid() {
+    return GenerateUuidValue().ToString();
+}
+
+// Solo los ids con forma de UUID, para enlazarlos como $1::uuid[]: uno mal formado haría fallar
+// la consulta de todo el lote, y de todos modos no puede existir en una columna uuid
+inline std::vector<std::string> WellFormedIds(std::span<const std::string> ids) {
+    std::vector<std::string> wellFormed;
+    wellFormed.reserve(ids.size());
+    for (const auto& id : ids) {
+        if (domain::Uuid::Parse(id)) {
+            wellFormed.push_back(id);
+        }
+    }
+    return wellFormed;
+}
+
+#endif //TOURNAMENTS_IDGENERATOR_HPP
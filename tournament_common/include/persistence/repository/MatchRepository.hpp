@@ -13,18 +13,26 @@ namespace repository {
 
 
         std::optional<std::string> Create(const domain::Match& entity) override;
+        std::vector<std::string> CreateMany(const std::vector<domain::Match>& entities) override;
         std::shared_ptr<domain::Match> ReadById(std::string id) override;
         std::string Update(const domain::Match& entity) override;
         void Delete(std::string id) override;
         std::vector<std::shared_ptr<domain::Match>> ReadAll() override;
+        std::vector<std::shared_ptr<domain::Match>> ReadPage(const PageRequest& page) override;
 
         // Métodos de IMatchRepository
-        std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(std::string tournamentId) override;
-        std::vector<std::shared_ptr<domain::Match>> FindByTournamentIdAndPhase(std::string tournamentId, domain::MatchPhase phase) override;
-        std::vector<std::shared_ptr<domain::Match>> FindByGroupId(std::string groupId) override;
-        std::vector<std::shared_ptr<domain::Match>> FindByTeamId(std::string teamId) override;
+        std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(std::string tournamentId, const PageRequest& page = {}) override;
+        ArenaMatches FindByTournamentId(std::string tournamentId, const PageRequest& page, std::pmr::memory_resource* arena) override;
+        std::vector<std::shared_ptr<domain::Match>> FindByTournamentIdAndPhase(std::string tournamentId, domain::MatchPhase phase, const PageRequest& page = {}) override;
+        std::vector<std::shared_ptr<domain::Match>> FindByGroupId(std::string groupId, const PageRequest& page = {}) override;
+        std::vector<std::shared_ptr<domain::Match>> FindByTeamId(std::string teamId, const PageRequest& page = {}) override;
         bool IsGroupStageComplete(std::string tournamentId) override;
         domain::Match Save(const domain::Match& match) override;
+        std::vector<std::string> FindGroupIdsByTournamentId(std::string tournamentId) override;
+        std::vector<MatchResult> FindCompletedResultsByGroupId(std::string groupId) override;
+        std::vector<domain::Match> SaveAll(const std::vector<domain::Match>& matches) override;
+        std::shared_ptr<domain::Match> UpdateById(const std::string& id, const std::function<void(domain::Match&)>& modify) override;
+        domain::Match CreateLinked(const domain::Match& nextMatch, const domain::Match& completedMatch) override;
     };
 } // namespace repository
 
@@ -0,0 +1,20 @@
+#ifndef TOURNAMENTS_PAGEREQUEST_HPP
+#define TOURNAMENTS_PAGEREQUEST_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+// Paginación keyset: filas con id > after, ordenadas por id. Cada página cuesta lo mismo
+// que la primera (un range scan sobre la llave primaria), a diferencia de OFFSET.
+struct PageRequest {
+    std::optional<std::string> after;
+    std::optional<size_t> limit; // sin límite = todas las filas restantes
+
+    // Cursor de la primera página: ningún UUID es menor que éste
+    [[nodiscard]] std::string AfterOrFirst() const {
+        return after.value_or("00000000-0000-0000-0000-000000000000");
+    }
+};
+
+#endif //TOURNAMENTS_PAGEREQUEST_HPP
@@ -4,12 +4,18 @@
 #include <string>
 #include <memory>
 #include <optional>
+#include <span>
+#include <vector>
 #include <nlohmann/json.hpp>
 #include <pqxx/pqxx>
 #include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/IdGenerator.hpp"
 #include "domain/Team.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/StatementRegistry.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
+#include "persistence/configuration/AsyncQueryExecutor.hpp"
 
 class TeamRepository : public IRepository<domain::Team, std::string> {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
@@ -18,12 +24,12 @@ public:
 
     std::vector<std::shared_ptr<domain::Team>> ReadAll() override {
         std::vector<std::shared_ptr<domain::Team>> teams;
-        auto pooled = connectionProvider->Connection();
-        auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+        auto pooled = connectionProvider->ReadConnection();
+        auto connection = AsPostgres(pooled);
 
         try {
             pqxx::work tx(*(connection->connection));
-            pqxx::result result{tx.exec("select id, document->>'name' as name from teams")};
+            pqxx::result result{ExecPrepared(tx, statements::team::ReadAll)};
             tx.commit();
 
             for(auto row : result){
@@ -33,13 +39,51 @@ public:
         return teams;
     }
 
+    std::vector<std::shared_ptr<domain::Team>> ReadPage(const PageRequest& page) override {
+        std::vector<std::shared_ptr<domain::Team>> teams;
+        auto pooled = connectionProvider->ReadConnection();
+        auto connection = AsPostgres(pooled);
+
+        try {
+            pqxx::work tx(*(connection->connection));
+            pqxx::result result{ExecPrepared(tx, statements::team::ReadPage, page.AfterOrFirst(), page.limit)};
+            tx.commit();
+
+            for(auto row : result){
+                teams.push_back(std::make_shared<domain::Team>(domain::Team{row["id"].as<std::string>(), row["name"].as<std::string>()}));
+            }
+        } catch (const std::exception& e) { /* handle error */ }
+        return teams;
+    }
+
+    bool StreamAll(const std::function<void(const domain::Team&)>& consumer) override {
+        auto pooled = connectionProvider->ReadConnection();
+        auto connection = AsPostgres(pooled);
+
+        try {
+            pqxx::work tx(*(connection->connection));
+            ExecCopy("copy_teams_out", [&] {
+                uint64_t rows = 0;
+                auto stream = pqxx::stream_from::query(tx, statements::team::StreamAll);
+                for (auto [id, name] : stream.iter<std::string_view, std::string_view>()) {
+                    consumer(domain::Team{std::string(id), std::string(name)});
+                    ++rows;
+                }
+                stream.complete();
+                return rows;
+            });
+            tx.commit();
+            return true;
+        } catch (const std::exception& e) { return false; }
+    }
+
     std::shared_ptr<domain::Team> ReadById(std::string id) override {
-        auto pooled = connectionProvider->Connection();
-        auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+        auto pooled = connectionProvider->ReadConnection();
+        auto connection = AsPostgres(pooled);
 
         try {
             pqxx::work tx(*(connection->connection));
-            pqxx::result result{tx.exec_params("SELECT id, document->>'name' as name FROM teams WHERE id = $1", id)};
+            pqxx::result result{ExecPrepared(tx, statements::team::ReadById, id)};
             tx.commit();
 
             if (result.empty()) return nullptr;
@@ -49,16 +93,63 @@ public:
         } catch (const std::exception& e) { return nullptr; }
     }
 
+    std::vector<std::shared_ptr<domain::Team>> ReadByIds(std::span<const std::string> ids) override {
+        std::vector<std::shared_ptr<domain::Team>> teams;
+        const auto uuids = WellFormedIds(ids);
+        if (uuids.empty()) return teams;
+        auto pooled = connectionProvider->ReadConnection();
+        auto connection = AsPostgres(pooled);
+
+        try {
+            pqxx::work tx(*(connection->connection));
+            pqxx::result result{ExecPrepared(tx, statements::team::ReadByIds, uuids)};
+            tx.commit();
+
+            teams.reserve(result.size());
+            for (auto row : result) {
+                teams.push_back(std::make_shared<domain::Team>(domain::Team{row["id"].as<std::string>(), row["name"].as<std::string>()}));
+            }
+        } catch (const std::exception& e) { /* handle error */ }
+        return teams;
+    }
+
+    void ReadByIdAsync(std::string id, ReadCallback callback) override {
+        auto executor = connectionProvider->Async();
+        if (executor == nullptr) {
+            IRepository::ReadByIdAsync(std::move(id), std::move(callback));
+            return;
+        }
+
+        executor->Execute(statements::team::ReadById, {std::move(id)}, [callback = std::move(callback)](AsyncQueryResult result) {
+            if (result.status == AsyncQueryResult::Status::TimedOut) {
+                callback(std::unexpected(std::make_exception_ptr(ConnectionAcquireTimeout(result.error))));
+                return;
+            }
+            // mismo criterio que ReadById: un error de la consulta o un nombre NULL (as<std::string>
+            // lanzaría) se reporta como inexistente
+            const auto id = result.Ok() && !result.rows.empty() ? result.Value(0, "id") : nullptr;
+            const auto name = result.Ok() && !result.rows.empty() ? result.Value(0, "name") : nullptr;
+            if (id == nullptr || name == nullptr || !id->has_value() || !name->has_value()) {
+                callback(nullptr);
+                return;
+            }
+            callback(std::make_shared<domain::Team>(domain::Team{**id, **name}));
+        });
+    }
+
     std::optional<std::string> Create(const domain::Team &entity) override {
         auto pooled = connectionProvider->Connection();
-        auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+        auto connection = AsPostgres(pooled);
+        const auto id = GenerateUuid();
         nlohmann::json teamBody = entity;
+        teamBody["id"] = id;
 
         try {
             pqxx::work tx(*(connection->connection));
-            pqxx::result result = tx.exec_params("INSERT INTO teams (document) VALUES ($1::jsonb) RETURNING id;", teamBody.dump());
+            ExecPrepared(tx, statements::team::Insert, id, teamBody.dump());
             tx.commit();
-            return result[0]["id"].as<std::string>();
+            connection->committedWrite = true;
+            return id;
         } catch (const pqxx::unique_violation& e) {
             return std::nullopt;
         } catch (const std::exception& e) {
@@ -66,27 +157,57 @@ public:
         }
     }
 
+    // COPY en lugar de INSERT: todas las filas viajan en un solo stream dentro de una transacción.
+    // Como COPY no tiene RETURNING, los ids se generan aquí y se devuelven en el mismo orden.
+    std::vector<std::string> CreateMany(const std::vector<domain::Team>& entities) override {
+        if (entities.empty()) return {};
+        auto pooled = connectionProvider->Connection();
+        auto connection = AsPostgres(pooled);
+
+        std::vector<std::string> ids;
+        ids.reserve(entities.size());
+        try {
+            pqxx::work tx(*(connection->connection));
+            ExecCopy("copy_teams_in", [&] {
+                auto stream = pqxx::stream_to::table(tx, {"teams"}, {"id", "document"});
+                for (const auto& entity : entities) {
+                    ids.push_back(GenerateUuid());
+                    nlohmann::json teamBody = entity;
+                    teamBody["id"] = ids.back();
+                    stream.write_values(ids.back(), teamBody.dump());
+                }
+                stream.complete();
+                return static_cast<uint64_t>(ids.size());
+            });
+            tx.commit();
+            connection->committedWrite = true;
+            return ids;
+        } catch (const std::exception& e) { return {}; }
+    }
+
     std::string Update(const domain::Team &entity) override {
         auto pooled = connectionProvider->Connection();
-        auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+        auto connection = AsPostgres(pooled);
         nlohmann::json teamBody = entity;
 
         try {
             pqxx::work tx(*(connection->connection));
-            tx.exec_params("UPDATE teams SET document = $1::jsonb WHERE id = $2", teamBody.dump(), entity.Id());
+            ExecPrepared(tx, statements::team::Update, teamBody.dump(), entity.Id());
             tx.commit();
+            connection->committedWrite = true;
             return entity.Id();
         } catch (const std::exception& e) { return ""; }
     }
 
     void Delete(std::string id) override {
         auto pooled = connectionProvider->Connection();
-        auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+        auto connection = AsPostgres(pooled);
 
         try {
             pqxx::work tx(*(connection->connection));
-            tx.exec_params("DELETE FROM teams WHERE id = $1", id);
+            ExecPrepared(tx, statements::team::Delete, id);
             tx.commit();
+            connection->committedWrite = true;
         } catch (const std::exception& e) { /* handle error */ }
     }
 };
@@ -9,25 +9,37 @@
 #include <vector>
 #include <memory>
 #include <optional> // CAMBIO: Incluir para std::optional
+#include <span>
 
-#include "IRepository.hpp"
+#include "ITournamentRepository.hpp"
 #include "domain/Tournament.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/MatchStorage.hpp"
 
 
-class TournamentRepository : public IRepository<domain::Tournament, std::string> {
+class TournamentRepository : public ITournamentRepository {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    // Tabla de la que ReadAggregateById toma los partidos (databaseConfig.matchStorage)
+    MatchStorage matchStorage;
 public:
-    explicit TournamentRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider);
+    explicit TournamentRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider,
+                                  MatchStorage matchStorage = MatchStorage::Document);
     
     std::shared_ptr<domain::Tournament> ReadById(std::string id) override;
+    void ReadByIdAsync(std::string id, ReadCallback callback) override;
+    std::vector<std::shared_ptr<domain::Tournament>> ReadByIds(std::span<const std::string> ids) override;
+    bool Exists(std::string id) override;
     
     // CAMBIO: La firma ahora devuelve std::optional<std::string> para coincidir con la interfaz
     std::optional<std::string> Create(const domain::Tournament & entity) override;
+    std::vector<std::string> CreateMany(const std::vector<domain::Tournament>& entities) override;
     
     std::string Update(const domain::Tournament & entity) override;
     void Delete(std::string id) override;
     std::vector<std::shared_ptr<domain::Tournament>> ReadAll() override;
+    std::vector<std::shared_ptr<domain::Tournament>> ReadPage(const PageRequest& page) override;
+    bool StreamAll(const std::function<void(const domain::Tournament&)>& consumer) override;
+    std::shared_ptr<domain::Tournament> ReadAggregateById(const std::string& id) override;
 };
 
 #endif //TOURNAMENTS_TOURNAMENTREPOSITORY_HPP
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef TOURNAMENTS_TYPEDMATCHREPOSITORY_HPP
+#define TOURNAMENTS_TYPEDMATCHREPOSITORY_HPP
+
+#include <pqxx/pqxx>
+
+#include "persistence/repository/IMatchRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+
+namespace repository {
+    // IMatchRepository sobre MATCH_RECORDS (una columna tipada por campo) en lugar del documento
+    // JSONB de MATCHES. Los valores se enlazan y se leen columna por columna: no hay json::dump
+    // al escribir ni json::parse al leer. Los ids de equipos y partidos deben ser UUID.
+    class TypedMatchRepository : public IMatchRepository {
+        std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    public:
+        explicit TypedMatchRepository(std::shared_ptr<IDbConnectionProvider> provider);
+
+        // Convierte una fila de match_record::* (columnas en el orden de MATCH_RECORD_COLUMNS)
+        static domain::Match Decode(const pqxx::row& row);
+
+        std::optional<std::string> Create(const domain::Match& entity) override;
+        std::vector<std::string> CreateMany(const std::vector<domain::Match>& entities) override;
+        std::shared_ptr<domain::Match> ReadById(std::string id) override;
+        std::string Update(const domain::Match& entity) override;
+        void Delete(std::string id) override;
+        std::vector<std::shared_ptr<domain::Match>> ReadAll() override;
+        std::vector<std::shared_ptr<domain::Match>> ReadPage(const PageRequest& page) override;
+
+        std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(std::string tournamentId, const PageRequest& page = {}) override;
+        ArenaMatches FindByTournamentId(std::string tournamentId, const PageRequest& page, std::pmr::memory_resource* arena) override;
+        std::vector<std::shared_ptr<domain::Match>> FindByTournamentIdAndPhase(std::string tournamentId, domain::MatchPhase phase, const PageRequest& page = {}) override;
+        std::vector<std::shared_ptr<domain::Match>> FindByGroupId(std::string groupId, const PageRequest& page = {}) override;
+        std::vector<std::shared_ptr<domain::Match>> FindByTeamId(std::string teamId, const PageRequest& page = {}) override;
+        bool IsGroupStageComplete(std::string tournamentId) override;
+        domain::Match Save(const domain::Match& match) override;
+        std::vector<std::string> FindGroupIdsByTournamentId(std::string tournamentId) override;
+        std::vector<MatchResult> FindCompletedResultsByGroupId(std::string groupId) override;
+        std::vector<domain::Match> SaveAll(const std::vector<domain::Match>& matches) override;
+        std::shared_ptr<domain::Match> UpdateById(const std::string& id, const std::function<void(domain::Match&)>& modify) override;
+        domain::Match CreateLinked(const domain::Match& nextMatch, const domain::Match& completedMatch) override;
+    };
+} // namespace repository
+
+#endif //TOURNAMENTS_TYPEDMATCHREPOSITORY_HPP
@@ -0,0 +1,229 @@
+#include "domain/JsonReader.hpp"
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string>
+#include <simdjson.h>
+
+namespace domain::json_reader {
+
+namespace {
+    using simdjson::error_code;
+    using simdjson::SUCCESS;
+    namespace ondemand = simdjson::ondemand;
+
+    // Parser y búfer con relleno del hilo: se reutilizan de una lectura a otra
+    struct ThreadReader {
+        ondemand::parser parser;
+        std::string buffer;
+    };
+
+    ThreadReader& Reader() {
+        thread_local ThreadReader reader;
+        return reader;
+    }
+
+    simdjson::padded_string_view Pad(std::string& buffer, std::string_view json) {
+        if (buffer.size() < json.size() + simdjson::SIMDJSON_PADDING) {
+            buffer.resize(json.size() + simdjson::SIMDJSON_PADDING);
+        }
+        std::memcpy(buffer.data(), json.data(), json.size());
+        return simdjson::padded_string_view(buffer.data(), json.size(), buffer.size());
+    }
+
+    // Tipo incorrecto o campo faltante: el texto era JSON pero la entidad no se puede formar
+    ReadError ToReadError(error_code error) {
+        switch (error) {
+            case simdjson::INCORRECT_TYPE:
+            case simdjson::NO_SUCH_FIELD:
+            case simdjson::NUMBER_OUT_OF_RANGE:
+                return ReadError::InvalidDocument;
+            default:
+                return ReadError::InvalidJson;
+        }
+    }
+
+    error_code ReadString(ondemand::value value, std::string& out) {
+        std::string_view text;
+        if (auto error = value.get_string().get(text)) return error;
+        out.assign(text);
+        return SUCCESS;
+    }
+
+    error_code ReadInt(ondemand::value value, int& out) {
+        int64_t number;
+        if (auto error = value.get_int64().get(number)) return error;
+        if (number < std::numeric_limits<int>::min() || number > std::numeric_limits<int>::max()) {
+            return simdjson::NUMBER_OUT_OF_RANGE;
+        }
+        out = static_cast<int>(number);
+        return SUCCESS;
+    }
+
+    error_code ReadOptional(ondemand::value value, std::optional<std::string>& out) {
+        bool isNull;
+        if (auto error = value.is_null().get(isNull)) return error;
+        if (isNull) {
+            out.reset();
+            return SUCCESS;
+        }
+        return ReadString(value, out.emplace());
+    }
+
+    error_code ReadOptional(ondemand::value value, std::optional<int>& out) {
+        bool isNull;
+        if (auto error = value.is_null().get(isNull)) return error;
+        if (isNull) {
+            out.reset();
+            return SUCCESS;
+        }
+        return ReadInt(value, out.emplace());
+    }
+
+    // Como NLOHMANN_JSON_SERIALIZE_ENUM: un valor que no es uno de los nombres da el primero del enum
+    std::string EnumName(ondemand::value value) {
+        std::string_view text;
+        return value.get_string().get(text) == SUCCESS ? std::string(text) : std::string();
+    }
+
+    // Recorre todos los campos del objeto; read(key, value) decodifica los que conoce
+    template<typename ReadField>
+    error_code ForEachField(ondemand::object object, ReadField&& read) {
+        for (auto result : object) {
+            ondemand::field field;
+            if (auto error = std::move(result).get(field)) return error;
+            std::string_view key;
+            if (auto error = field.unescaped_key().get(key)) return error;
+            if (auto error = read(key, field.value())) return error;
+        }
+        return SUCCESS;
+    }
+
+    error_code Decode(ondemand::object object, Group& group);
+
+    // Mismos campos y valores por defecto que from_json(const nlohmann::json&, Match&)
+    error_code Decode(ondemand::object object, Match& match) {
+        match = Match();
+        match.Phase() = MatchPhase::GROUP_STAGE;
+        match.MatchNumber() = 0;
+        return ForEachField(object, [&match](std::string_view key, ondemand::value value) -> error_code {
+            if (key == "id") return ReadString(value, match.Id());
+            if (key == "tournamentId") return ReadString(value, match.TournamentId());
+            if (key == "groupId") return ReadString(value, match.GroupId());
+            if (key == "phase") { match.Phase() = Match::StringToPhase(EnumName(value)); return SUCCESS; }
+            if (key == "matchNumber") return ReadInt(value, match.MatchNumber());
+            if (key == "team1Id") return ReadOptional(value, match.Team1Id());
+            if (key == "team2Id") return ReadOptional(value, match.Team2Id());
+            if (key == "team1Score") return ReadOptional(value, match.Team1Score());
+            if (key == "team2Score") return ReadOptional(value, match.Team2Score());
+            if (key == "status") { match.Status() = Match::StringToStatus(EnumName(value)); return SUCCESS; }
+            if (key == "nextMatchId") return ReadOptional(value, match.NextMatchId());
+            return SUCCESS;
+        });
+    }
+
+    // Como from_json(const nlohmann::json&, Team&): "name" es obligatorio y "id" solo se toma si viene
+    error_code Decode(ondemand::object object, Team& team) {
+        bool hasName = false;
+        std::string text;
+        const auto result = ForEachField(object, [&](std::string_view key, ondemand::value value) -> error_code {
+            if (key == "id") {
+                if (auto error = ReadString(value, text)) return error;
+                team.SetId(text);
+            } else if (key == "name") {
+                if (auto error = ReadString(value, text)) return error;
+                team.SetName(text);
+                hasName = true;
+            }
+            return SUCCESS;
+        });
+        if (result) return result;
+        return hasName ? SUCCESS : simdjson::NO_SUCH_FIELD;
+    }
+
+    template<typename T>
+    error_code DecodeArray(ondemand::array array, std::vector<T>& items) {
+        items.clear();
+        size_t count;
+        if (auto error = array.count_elements().get(count)) return error;
+        items.reserve(count);
+        for (auto result : array) {
+            ondemand::value value;
+            if (auto error = std::move(result).get(value)) return error;
+            ondemand::object object;
+            if (auto error = value.get_object().get(object)) return error;
+            if (auto error = Decode(object, items.emplace_back())) return error;
+        }
+        return SUCCESS;
+    }
+
+    // Como from_json(const nlohmann::json&, Group&): "teams" solo reemplaza la lista si viene
+    error_code Decode(ondemand::object object, Group& group) {
+        group.Id().clear();
+        group.Name().clear();
+        group.TournamentId().clear();
+        return ForEachField(object, [&group](std::string_view key, ondemand::value value) -> error_code {
+            if (key == "id") return ReadString(value, group.Id());
+            if (key == "name") return ReadString(value, group.Name());
+            if (key == "tournamentId") return ReadString(value, group.TournamentId());
+            if (key == "teams") {
+                ondemand::array teams;
+                if (auto error = value.get_array().get(teams)) return error;
+                return DecodeArray(teams, group.Teams());
+            }
+            return SUCCESS;
+        });
+    }
+
+    // Como from_json(const nlohmann::json&, Tournament&); "format" no tiene representación JSON
+    error_code Decode(ondemand::object object, Tournament& tournament) {
+        tournament.Id().clear();
+        tournament.Name().clear();
+        return ForEachField(object, [&tournament](std::string_view key, ondemand::value value) -> error_code {
+            if (key == "id") return ReadString(value, tournament.Id());
+            if (key == "name") return ReadString(value, tournament.Name());
+            return SUCCESS;
+        });
+    }
+
+    // Documento raíz: decode(document) y después nada más que espacios
+    template<typename Decoder>
+    ReadResult ReadRoot(std::string_view json, Decoder&& decode) {
+        auto& reader = Reader();
+        ondemand::document document;
+        error_code error = reader.parser.iterate(Pad(reader.buffer, json)).get(document);
+        if (!error) error = decode(document);
+        if (!error && !document.at_end()) error = simdjson::TRAILING_CONTENT;
+        if (error) return std::unexpected(ToReadError(error));
+        return {};
+    }
+
+    template<typename T>
+    ReadResult ReadObject(std::string_view json, T& entity) {
+        return ReadRoot(json, [&entity](ondemand::document& document) -> error_code {
+            ondemand::object object;
+            if (auto error = document.get_object().get(object)) return error;
+            return Decode(object, entity);
+        });
+    }
+
+    template<typename T>
+    ReadResult ReadArray(std::string_view json, std::vector<T>& items) {
+        return ReadRoot(json, [&items](ondemand::document& document) -> error_code {
+            ondemand::array array;
+            if (auto error = document.get_array().get(array)) return error;
+            return DecodeArray(array, items);
+        });
+    }
+}
+
+ReadResult Read(std::string_view json, Match& match) { return ReadObject(json, match); }
+ReadResult Read(std::string_view json, Group& group) { return ReadObject(json, group); }
+ReadResult Read(std::string_view json, Team& team) { return ReadObject(json, team); }
+ReadResult Read(std::string_view json, Tournament& tournament) { return ReadObject(json, tournament); }
+
+ReadResult Read(std::string_view json, std::vector<Match>& matches) { return ReadArray(json, matches); }
+ReadResult Read(std::string_view json, std::vector<Group>& groups) { return ReadArray(json, groups); }
+ReadResult Read(std::string_view json, std::vector<Team>& teams) { return ReadArray(json, teams); }
+
+} // namespace domain::json_reader
@@ -0,0 +1,104 @@
+#include "persistence/cache/CacheInvalidationListener.hpp"
+#include <pqxx/pqxx>
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+namespace {
+    constexpr std::chrono::milliseconds ReconnectBackoffInitial{100};
+    constexpr std::chrono::milliseconds ReconnectBackoffMax{5000};
+
+    // Emite LISTEN al construirse y recibe cada NOTIFY del canal durante await_notification
+    class InvalidationReceiver : public pqxx::notification_receiver {
+        CacheInvalidationListener& listener;
+    public:
+        InvalidationReceiver(pqxx::connection& connection, CacheInvalidationListener& listener)
+            : pqxx::notification_receiver(connection, CacheInvalidationListener::Channel), listener(listener) {}
+
+        void operator()(const std::string& payload, int) override {
+            listener.Dispatch(payload);
+        }
+    };
+}
+
+CacheInvalidationListener::CacheInvalidationListener(std::string connectionString)
+    : connectionString(std::move(connectionString)) {}
+
+CacheInvalidationListener::~CacheInvalidationListener() {
+    Stop();
+}
+
+void CacheInvalidationListener::Subscribe(const std::string& entity, Subscription subscription) {
+    std::lock_guard lock(subscriptionsMutex);
+    subscriptions[entity] = std::move(subscription);
+}
+
+void CacheInvalidationListener::Dispatch(std::string_view payload) {
+    ++received;
+    const auto separator = payload.find(':');
+    if (separator == std::string_view::npos) {
+        return;
+    }
+
+    std::lock_guard lock(subscriptionsMutex);
+    const auto subscription = subscriptions.find(payload.substr(0, separator));
+    if (subscription != subscriptions.end()) {
+        subscription->second.evict(std::string(payload.substr(separator + 1)));
+    }
+}
+
+void CacheInvalidationListener::ClearAll() {
+    std::lock_guard lock(subscriptionsMutex);
+    for (const auto& [entity, subscription] : subscriptions) {
+        subscription.clear();
+    }
+}
+
+void CacheInvalidationListener::Start() {
+    if (running.exchange(true)) {
+        return;
+    }
+    worker = std::thread(&CacheInvalidationListener::Run, this);
+}
+
+void CacheInvalidationListener::Stop() {
+    {
+        std::lock_guard lock(stopMutex);
+        running = false;
+    }
+    stopCondition.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void CacheInvalidationListener::Run() {
+    auto backoff = ReconnectBackoffInitial;
+    bool connectedBefore = false;
+
+    while (running) {
+        try {
+            pqxx::connection connection(connectionString);
+            InvalidationReceiver receiver(connection, *this);
+
+            // lo escrito mientras no escuchábamos no llegará nunca: empezar con los cachés vacíos
+            if (connectedBefore) {
+                ++reconnects;
+            }
+            connectedBefore = true;
+            ClearAll();
+            backoff = ReconnectBackoffInitial;
+
+            while (running) {
+                // espera acotada para revisar running con regularidad
+                connection.await_notification(1, 0);
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "[CacheInvalidationListener] Listener connection failed: " << e.what() << std::endl;
+        }
+
+        std::unique_lock lock(stopMutex);
+        stopCondition.wait_for(lock, backoff, [this] { return !running; });
+        backoff = std::min(backoff * 2, ReconnectBackoffMax);
+    }
+}
@@ -0,0 +1,473 @@
+#include "persistence/configuration/AsyncQueryExecutor.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
+#include <libpq-fe.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
+#include <system_error>
+#include <utility>
+
+namespace {
+    constexpr int MaxEvents = 64;
+    constexpr auto TimedOutMessage = "Timed out waiting for a database connection";
+}
+
+struct AsyncQueryExecutor::Slot {
+    enum class State { Disconnected, Connecting, Preparing, Idle, Busy };
+
+    PGconn* connection = nullptr;
+    int socket = -1; // socket registrado en epoll
+    State state = State::Disconnected;
+    size_t prepared = 0;
+    bool connectedBefore = false;
+    std::optional<Request> request;
+    Clock::time_point sentAt{};
+    std::string sqlState; // del primer resultado con error de la sentencia en curso
+    AsyncQueryResult result;
+    std::chrono::milliseconds backoff{0};
+    Clock::time_point nextAttempt{};
+};
+
+AsyncQueryExecutor::AsyncQueryExecutor(std::string connectionString, size_t connections,
+                                       std::chrono::milliseconds acquireTimeout,
+                                       std::chrono::milliseconds reconnectBackoffInitial,
+                                       std::chrono::milliseconds reconnectBackoffMax)
+    : connectionString(std::move(connectionString)), acquireTimeout(acquireTimeout),
+      reconnectBackoffInitial(reconnectBackoffInitial), reconnectBackoffMax(reconnectBackoffMax) {
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFd < 0 || wakeFd < 0) {
+        const auto error = errno;
+        if (epollFd >= 0) close(epollFd);
+        if (wakeFd >= 0) close(wakeFd);
+        throw std::system_error(error, std::generic_category(), "AsyncQueryExecutor");
+    }
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.ptr = nullptr; // nullptr identifica al eventfd
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+
+    for (size_t i = 0; i < std::max<size_t>(connections, 1); i++) {
+        auto slot = std::make_unique<Slot>();
+        slot->backoff = reconnectBackoffInitial;
+        slots.push_back(std::move(slot));
+    }
+
+    running = true;
+    reactor = std::thread(&AsyncQueryExecutor::Run, this);
+}
+
+AsyncQueryExecutor::~AsyncQueryExecutor() {
+    Stop();
+    close(wakeFd);
+    close(epollFd);
+}
+
+void AsyncQueryExecutor::Execute(const PreparedStatement& statement, std::vector<std::string> parameters, Callback callback) {
+    {
+        std::lock_guard lock(pendingMutex);
+        if (running) {
+            pending.push_back({statement.name, std::move(parameters), std::move(callback), Clock::now() + acquireTimeout});
+            ++submitted;
+            Wake();
+            return;
+        }
+    }
+    AsyncQueryResult result;
+    result.status = AsyncQueryResult::Status::Failed;
+    result.error = "AsyncQueryExecutor is stopped";
+    Complete(callback, std::move(result));
+}
+
+std::future<AsyncQueryResult> AsyncQueryExecutor::Execute(const PreparedStatement& statement, std::vector<std::string> parameters) {
+    auto promise = std::make_shared<std::promise<AsyncQueryResult>>();
+    auto future = promise->get_future();
+    Execute(statement, std::move(parameters), [promise](AsyncQueryResult result) {
+        promise->set_value(std::move(result));
+    });
+    return future;
+}
+
+void AsyncQueryExecutor::Stop() {
+    {
+        std::lock_guard lock(pendingMutex);
+        if (!running) return;
+        running = false;
+    }
+    Wake();
+    if (reactor.joinable()) {
+        reactor.join();
+    }
+
+    // lo que quedó en cola ya no tendrá conexión
+    std::deque<Request> abandoned;
+    {
+        std::lock_guard lock(pendingMutex);
+        abandoned.swap(pending);
+    }
+    for (auto& request : abandoned) {
+        AsyncQueryResult result;
+        result.status = AsyncQueryResult::Status::Failed;
+        result.error = "AsyncQueryExecutor is stopped";
+        Complete(request.callback, std::move(result));
+    }
+}
+
+void AsyncQueryExecutor::Wake() {
+    const uint64_t one = 1;
+    if (write(wakeFd, &one, sizeof(one)) < 0) {
+        // el contador ya está marcado: el reactor despertará igual
+    }
+}
+
+void AsyncQueryExecutor::Run() {
+    for (auto& slot : slots) {
+        StartConnect(*slot);
+    }
+
+    epoll_event events[MaxEvents];
+    while (running) {
+        const int ready = epoll_wait(epollFd, events, MaxEvents, NextTimeoutMillis(Clock::now()));
+        if (ready < 0 && errno != EINTR) {
+            std::cerr << "[AsyncQueryExecutor] epoll_wait failed: " << std::system_category().message(errno) << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < ready; i++) {
+            if (events[i].data.ptr == nullptr) {
+                uint64_t value;
+                if (read(wakeFd, &value, sizeof(value)) < 0) {
+                    // otro despertar ya lo consumió
+                }
+                continue;
+            }
+            OnSocketEvent(*static_cast<Slot*>(events[i].data.ptr), events[i].events);
+        }
+
+        const auto now = Clock::now();
+        for (auto& slot : slots) {
+            if (slot->state == Slot::State::Disconnected && now >= slot->nextAttempt) {
+                StartConnect(*slot);
+            }
+        }
+        DispatchPending();
+        ExpirePending(now);
+    }
+
+    for (auto& slot : slots) {
+        Break(*slot, "AsyncQueryExecutor is stopped");
+    }
+}
+
+int AsyncQueryExecutor::NextTimeoutMillis(Clock::time_point now) {
+    std::optional<Clock::time_point> next;
+    for (const auto& slot : slots) {
+        if (slot->state == Slot::State::Disconnected) {
+            next = next ? std::min(*next, slot->nextAttempt) : slot->nextAttempt;
+        }
+    }
+    {
+        // la cola es FIFO con el mismo timeout para todos: el frente vence primero
+        std::lock_guard lock(pendingMutex);
+        if (!pending.empty()) {
+            next = next ? std::min(*next, pending.front().deadline) : pending.front().deadline;
+        }
+    }
+    if (!next) {
+        return -1;
+    }
+    const auto wait = std::chrono::ceil<std::chrono::milliseconds>(*next - now).count();
+    return static_cast<int>(std::max<decltype(wait)>(wait, 0));
+}
+
+void AsyncQueryExecutor::StartConnect(Slot& slot) {
+    slot.connection = PQconnectStart(connectionString.c_str());
+    if (slot.connection == nullptr || PQstatus(slot.connection) == CONNECTION_BAD) {
+        Break(slot, slot.connection ? PQerrorMessage(slot.connection) : "out of memory");
+        return;
+    }
+    slot.state = Slot::State::Connecting;
+    Watch(slot, true);
+}
+
+void AsyncQueryExecutor::ContinueConnect(Slot& slot) {
+    switch (PQconnectPoll(slot.connection)) {
+        case PGRES_POLLING_READING:
+            Watch(slot, false);
+            return;
+        case PGRES_POLLING_WRITING:
+            Watch(slot, true);
+            return;
+        case PGRES_POLLING_OK:
+            if (PQsetnonblocking(slot.connection, 1) != 0) {
+                Break(slot, PQerrorMessage(slot.connection));
+                return;
+            }
+            slot.state = Slot::State::Preparing;
+            slot.prepared = 0;
+            SendNextPrepare(slot);
+            return;
+        default:
+            Break(slot, PQerrorMessage(slot.connection));
+    }
+}
+
+// Las sentencias se preparan una por una con el socket ya no bloqueante; la conexión queda
+// disponible cuando están todas, igual que las del pool síncrono.
+void AsyncQueryExecutor::SendNextPrepare(Slot& slot) {
+    if (slot.prepared == StatementRegistry::All.size()) {
+        slot.state = Slot::State::Idle;
+        slot.backoff = reconnectBackoffInitial;
+        if (slot.connectedBefore) {
+            ++reconnects;
+        }
+        slot.connectedBefore = true;
+        Watch(slot, false);
+        return;
+    }
+
+    const auto& statement = StatementRegistry::All[slot.prepared];
+    if (!PQsendPrepare(slot.connection, statement.name, statement.sql, 0, nullptr)) {
+        Break(slot, PQerrorMessage(slot.connection));
+        return;
+    }
+    Watch(slot, PQflush(slot.connection) == 1);
+}
+
+void AsyncQueryExecutor::Send(Slot& slot, Request request) {
+    std::vector<const char*> values;
+    values.reserve(request.parameters.size());
+    for (const auto& parameter : request.parameters) {
+        values.push_back(parameter.c_str());
+    }
+
+    slot.request = std::move(request);
+    slot.sentAt = Clock::now();
+    slot.sqlState.clear();
+    if (!PQsendQueryPrepared(slot.connection, slot.request->statement, static_cast<int>(values.size()),
+                             values.data(), nullptr, nullptr, 0)) {
+        Break(slot, PQerrorMessage(slot.connection));
+        return;
+    }
+    slot.state = Slot::State::Busy;
+
+    const int flushed = PQflush(slot.connection);
+    if (flushed < 0) {
+        Break(slot, PQerrorMessage(slot.connection));
+        return;
+    }
+    Watch(slot, flushed == 1);
+}
+
+void AsyncQueryExecutor::OnSocketEvent(Slot& slot, uint32_t events) {
+    switch (slot.state) {
+        case Slot::State::Disconnected:
+            return;
+        case Slot::State::Connecting:
+            ContinueConnect(slot);
+            return;
+        default:
+            break;
+    }
+
+    if (events & EPOLLOUT) {
+        const int flushed = PQflush(slot.connection);
+        if (flushed < 0) {
+            Break(slot, PQerrorMessage(slot.connection));
+            return;
+        }
+        Watch(slot, flushed == 1);
+    }
+    if (events & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+        if (!PQconsumeInput(slot.connection)) {
+            Break(slot, PQerrorMessage(slot.connection));
+            return;
+        }
+        ReadResults(slot);
+    }
+}
+
+void AsyncQueryExecutor::ReadResults(Slot& slot) {
+    if (slot.state == Slot::State::Idle) {
+        // sin sentencia en curso solo llegan avisos del servidor (p. ej. que va a cerrar)
+        if (PQstatus(slot.connection) == CONNECTION_BAD) {
+            Break(slot, PQerrorMessage(slot.connection));
+        }
+        return;
+    }
+
+    while (!PQisBusy(slot.connection)) {
+        PGresult* result = PQgetResult(slot.connection);
+        if (result == nullptr) {
+            Finish(slot);
+            return;
+        }
+
+        const auto status = PQresultStatus(result);
+        if (status == PGRES_TUPLES_OK) {
+            auto& rows = slot.result.rows;
+            const int columnCount = PQnfields(result);
+            for (int column = 0; column < columnCount; column++) {
+                slot.result.columns.emplace_back(PQfname(result, column));
+            }
+            rows.reserve(static_cast<size_t>(PQntuples(result)));
+            for (int row = 0; row < PQntuples(result); row++) {
+                auto& values = rows.emplace_back();
+                values.reserve(static_cast<size_t>(columnCount));
+                for (int column = 0; column < columnCount; column++) {
+                    if (PQgetisnull(result, row, column)) {
+                        values.emplace_back(std::nullopt);
+                    } else {
+                        values.emplace_back(std::in_place, PQgetvalue(result, row, column),
+                                            static_cast<size_t>(PQgetlength(result, row, column)));
+                    }
+                }
+            }
+        } else if (status != PGRES_COMMAND_OK) {
+            slot.result.status = AsyncQueryResult::Status::Failed;
+            slot.result.error = PQresultErrorMessage(result);
+            if (const char* sqlState = PQresultErrorField(result, PG_DIAG_SQLSTATE); sqlState != nullptr && slot.sqlState.empty()) {
+                slot.sqlState = sqlState;
+            }
+        }
+        PQclear(result);
+    }
+
+    if (PQstatus(slot.connection) == CONNECTION_BAD) {
+        Break(slot, PQerrorMessage(slot.connection));
+    }
+}
+
+void AsyncQueryExecutor::Finish(Slot& slot) {
+    auto result = std::move(slot.result);
+    slot.result = {};
+
+    if (slot.state == Slot::State::Preparing) {
+        if (!result.Ok()) {
+            Break(slot, result.error);
+            return;
+        }
+        ++slot.prepared;
+        SendNextPrepare(slot);
+        return;
+    }
+
+    auto request = std::move(*slot.request);
+    slot.request.reset();
+    slot.state = Slot::State::Idle;
+
+    auto& statistics = QueryStatistics::Instance();
+    const auto elapsed = Clock::now() - slot.sentAt;
+    if (result.Ok()) {
+        statistics.Record(request.statement, elapsed, result.rows.size());
+        if (statistics.IsSlow(elapsed)) {
+            statistics.LogSlowQuery(request.statement, elapsed, request.parameters.size(), std::nullopt);
+        }
+    } else {
+        statistics.RecordError(request.statement, elapsed, slot.sqlState);
+    }
+    Complete(request.callback, std::move(result));
+}
+
+// Una sentencia en curso no se reintenta en otra conexión: pudo haberse aplicado.
+void AsyncQueryExecutor::Break(Slot& slot, const std::string& reason) {
+    if (running) {
+        std::cerr << "[AsyncQueryExecutor] Connection failed: " << reason << std::endl;
+    }
+    if (slot.socket >= 0) {
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, slot.socket, nullptr);
+        slot.socket = -1;
+    }
+    if (slot.connection != nullptr) {
+        PQfinish(slot.connection);
+        slot.connection = nullptr;
+    }
+    slot.state = Slot::State::Disconnected;
+    slot.result = {};
+    slot.nextAttempt = Clock::now() + slot.backoff;
+    slot.backoff = std::min(slot.backoff * 2, reconnectBackoffMax);
+
+    if (slot.request) {
+        auto request = std::move(*slot.request);
+        slot.request.reset();
+        QueryStatistics::Instance().RecordError(request.statement, Clock::now() - slot.sentAt, "08006");
+        AsyncQueryResult result;
+        result.status = AsyncQueryResult::Status::Failed;
+        result.error = reason;
+        Complete(request.callback, std::move(result));
+    }
+}
+
+// El socket puede cambiar durante la conexión (p. ej. varios hosts): se vuelve a registrar.
+void AsyncQueryExecutor::Watch(Slot& slot, bool writable) {
+    const int socket = PQsocket(slot.connection);
+    epoll_event event{};
+    event.events = EPOLLIN | (writable ? EPOLLOUT : 0u);
+    event.data.ptr = &slot;
+
+    if (socket == slot.socket) {
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, socket, &event);
+        return;
+    }
+    if (slot.socket >= 0) {
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, slot.socket, nullptr);
+        slot.socket = -1;
+    }
+    if (socket >= 0 && epoll_ctl(epollFd, EPOLL_CTL_ADD, socket, &event) == 0) {
+        slot.socket = socket;
+    }
+}
+
+void AsyncQueryExecutor::DispatchPending() {
+    for (auto& slot : slots) {
+        if (slot->state != Slot::State::Idle) {
+            continue;
+        }
+        Request request;
+        {
+            std::lock_guard lock(pendingMutex);
+            if (pending.empty()) {
+                return;
+            }
+            request = std::move(pending.front());
+            pending.pop_front();
+        }
+        Send(*slot, std::move(request));
+    }
+}
+
+void AsyncQueryExecutor::ExpirePending(Clock::time_point now) {
+    std::vector<Request> expired;
+    {
+        std::lock_guard lock(pendingMutex);
+        while (!pending.empty() && pending.front().deadline <= now) {
+            expired.push_back(std::move(pending.front()));
+            pending.pop_front();
+        }
+    }
+    for (auto& request : expired) {
+        AsyncQueryResult result;
+        result.status = AsyncQueryResult::Status::TimedOut;
+        result.error = TimedOutMessage;
+        Complete(request.callback, std::move(result));
+    }
+}
+
+void AsyncQueryExecutor::Complete(Callback& callback, AsyncQueryResult result) {
+    switch (result.status) {
+        case AsyncQueryResult::Status::Ok: ++completed; break;
+        case AsyncQueryResult::Status::Failed: ++failed; break;
+        case AsyncQueryResult::Status::TimedOut: ++timedOut; break;
+    }
+    try {
+        callback(std::move(result));
+    } catch (const std::exception& e) {
+        // una excepción aquí tumbaría el reactor y todas las peticiones en vuelo
+        std::cerr << "[AsyncQueryExecutor] Callback threw: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "[AsyncQueryExecutor] Callback threw a non-standard exception" << std::endl;
+    }
+}
@@ -0,0 +1,182 @@
+#include "persistence/configuration/PipelinedTransaction.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
+#include <libpq-fe.h>
+#include <utility>
+
+namespace {
+    constexpr std::string_view StatisticsName = "pipeline";
+
+    // El primer error de un tramo; las sentencias que le siguen llegan como PGRES_PIPELINE_ABORTED
+    struct PipelineError {
+        std::string message;
+        std::string statement;
+        std::string sqlState;
+    };
+}
+
+PipelineResult::PipelineResult(pg_result* result) : result(result, PQclear) {}
+
+int PipelineResult::Size() const {
+    return result ? PQntuples(result.get()) : 0;
+}
+
+uint64_t PipelineResult::AffectedRows() const {
+    const char* rows = result ? PQcmdTuples(result.get()) : "";
+    return *rows == '\0' ? 0 : std::stoull(rows);
+}
+
+int PipelineResult::Column(const char* name) const {
+    return PQfnumber(result.get(), name);
+}
+
+bool PipelineResult::IsNull(int row, int column) const {
+    return PQgetisnull(result.get(), row, column) != 0;
+}
+
+std::string_view PipelineResult::View(int row, int column) const {
+    return {PQgetvalue(result.get(), row, column), static_cast<size_t>(PQgetlength(result.get(), row, column))};
+}
+
+PipelinedTransaction::PipelinedTransaction(pqxx::connection& source)
+    : owner(source), connection(std::move(source).release_raw_connection()) {
+    if (PQenterPipelineMode(connection) != 1) {
+        const std::string error = PQerrorMessage(connection);
+        Release();
+        throw pqxx::broken_connection(error);
+    }
+    SendCommand("BEGIN");
+}
+
+PipelinedTransaction::~PipelinedTransaction() {
+    if (!finished && PQstatus(connection) == CONNECTION_OK) {
+        try {
+            // lo enviado y no leído va en su propio tramo: si falló, el ROLLBACK no se descarta con ello
+            if (received < statements.size()) {
+                try {
+                    Sync();
+                } catch (const pqxx::sql_error&) {
+                }
+            }
+            SendCommand("ROLLBACK");
+            Sync();
+        } catch (const std::exception&) {
+            // la conexión quedó inutilizable; Release la cierra y el pool la descarta al devolverla
+        }
+    }
+    Release();
+}
+
+void PipelinedTransaction::Send(const char* statement, const std::vector<std::optional<std::string>>& parameters) {
+    std::vector<const char*> values;
+    values.reserve(parameters.size());
+    for (const auto& parameter : parameters) {
+        values.push_back(parameter ? parameter->c_str() : nullptr);
+    }
+    if (PQsendQueryPrepared(connection, statement, static_cast<int>(values.size()), values.data(), nullptr, nullptr, 0) != 1) {
+        throw pqxx::broken_connection(PQerrorMessage(connection));
+    }
+    statements.push_back(statement);
+    results.emplace_back();
+}
+
+// BEGIN, COMMIT y ROLLBACK: sin parámetros, pero por el protocolo extendido (PQsendQuery no
+// está permitido en modo pipeline)
+void PipelinedTransaction::SendCommand(const char* command) {
+    if (PQsendQueryParams(connection, command, 0, nullptr, nullptr, nullptr, nullptr, 0) != 1) {
+        throw pqxx::broken_connection(PQerrorMessage(connection));
+    }
+    statements.push_back(command);
+    results.emplace_back();
+}
+
+// Una ida y vuelta: PQpipelineSync envía lo encolado y aquí se leen, en orden, los resultados
+// de todas las sentencias enviadas desde el tramo anterior y el del punto de sincronización.
+void PipelinedTransaction::Sync() {
+    auto& statistics = QueryStatistics::Instance();
+    const auto start = QueryStatistics::Clock::now();
+    try {
+        if (PQpipelineSync(connection) != 1) {
+            throw pqxx::broken_connection(PQerrorMessage(connection));
+        }
+
+        std::optional<PipelineError> error;
+        uint64_t rows = 0;
+        for (; received < statements.size(); received++) {
+            PGresult* last = nullptr;
+            while (PGresult* result = PQgetResult(connection)) {
+                PQclear(last);
+                last = result;
+            }
+            if (last == nullptr) {
+                throw pqxx::broken_connection(PQerrorMessage(connection));
+            }
+            PipelineResult owned(last);
+            switch (PQresultStatus(last)) {
+                case PGRES_TUPLES_OK:
+                case PGRES_COMMAND_OK:
+                    rows += static_cast<uint64_t>(owned.Size());
+                    results[received] = std::move(owned);
+                    break;
+                case PGRES_PIPELINE_ABORTED:
+                    break;
+                default:
+                    if (!error) {
+                        const char* sqlState = PQresultErrorField(last, PG_DIAG_SQLSTATE);
+                        error = PipelineError{PQresultErrorMessage(last), statements[received], sqlState ? sqlState : ""};
+                    }
+            }
+        }
+
+        PGresult* sync = PQgetResult(connection);
+        const bool synced = sync != nullptr && PQresultStatus(sync) == PGRES_PIPELINE_SYNC;
+        PQclear(sync);
+        if (!synced || PQstatus(connection) != CONNECTION_OK) {
+            throw pqxx::broken_connection(PQerrorMessage(connection));
+        }
+        if (error) {
+            throw pqxx::sql_error(error->message, error->statement, error->sqlState.empty() ? nullptr : error->sqlState.c_str());
+        }
+        statistics.Record(StatisticsName, QueryStatistics::Clock::now() - start, rows);
+    } catch (...) {
+        query_statistics_detail::RecordCurrentError(StatisticsName, start);
+        throw;
+    }
+}
+
+PipelineResult PipelinedTransaction::Retrieve(query_id id) {
+    if (id >= statements.size()) {
+        throw pqxx::usage_error("PipelinedTransaction::Retrieve: unknown query id");
+    }
+    if (id >= received) {
+        Sync();
+    }
+    return results[id].value();
+}
+
+void PipelinedTransaction::Commit() {
+    SendCommand("COMMIT");
+    Sync();
+    finished = true;
+}
+
+// Devuelve el PGconn a la conexión de pqxx fuera del modo pipeline. Si no puede salir (quedaron
+// resultados sin leer porque la conexión se rompió) se cierra: pqxx la ve cerrada y el pool la
+// descarta al devolverla.
+void PipelinedTransaction::Release() noexcept {
+    if (PQexitPipelineMode(connection) != 1) {
+        PQfinish(connection);
+        return;
+    }
+    std::optional<pqxx::connection> seized;
+    try {
+        seized.emplace(pqxx::connection::seize_raw_connection(connection));
+    } catch (const std::exception&) {
+        PQfinish(connection);
+        return;
+    }
+    try {
+        owner = std::move(*seized);
+    } catch (const std::exception&) {
+        // seized sigue siendo dueña del PGconn y lo cierra al salir
+    }
+}
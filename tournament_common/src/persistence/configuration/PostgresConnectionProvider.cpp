@@ -0,0 +1,304 @@
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/StatementRegistry.hpp"
+#include <algorithm>
+#include <bit>
+#include <iostream>
+#include <utility>
+
+namespace {
+    uint64_t ElapsedMicros(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count());
+    }
+
+    void UpdateMax(std::atomic<uint64_t>& target, uint64_t value) {
+        auto current = target.load(std::memory_order_relaxed);
+        while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    // Último lugar que usó el hilo; se intenta primero en el siguiente checkout
+    struct SlotAffinity {
+        const void* pool = nullptr;
+        size_t slot = 0;
+    };
+    thread_local SlotAffinity affinity;
+}
+
+PostgresConnectionProvider::PostgresConnectionProvider(ConnectionPoolConfiguration configuration)
+    : configuration(std::move(configuration)), reconnectBackoff(this->configuration.reconnectBackoffInitial) {
+    const auto maxSize = this->configuration.maxSize;
+    connections = std::make_unique<PostgresConnection[]>(maxSize);
+    slots = std::make_unique<SlotState[]>(maxSize);
+    idleMaskWords = (maxSize + 63) / 64;
+    idleMask = std::make_unique<std::atomic<uint64_t>[]>(idleMaskWords);
+    emptySlots.reserve(maxSize);
+    for (size_t slot = maxSize; slot > 0; slot--) {
+        emptySlots.push_back(slot - 1); // pop_back entrega primero los lugares bajos
+    }
+
+    for (size_t i = 0; i < this->configuration.minSize && !emptySlots.empty(); i++) {
+        try {
+            const auto slot = emptySlots.back();
+            connections[slot].connection = OpenConnection();
+            emptySlots.pop_back();
+            ++openConnections;
+            slots[slot].idleSince.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+            MarkIdle(slot);
+        } catch (const std::exception& e) {
+            // El pool se recupera solo: las conexiones faltantes se abren bajo demanda
+            ++connectionFailures;
+            std::cerr << "[PostgresConnectionProvider] Could not open connection: " << e.what() << std::endl;
+            nextConnectAttempt = Clock::now() + reconnectBackoff;
+            break;
+        }
+    }
+
+    if (this->configuration.asyncConnections > 0) {
+        asyncExecutor = std::make_unique<AsyncQueryExecutor>(
+            this->configuration.connectionString, this->configuration.asyncConnections, this->configuration.acquireTimeout,
+            this->configuration.reconnectBackoffInitial, this->configuration.reconnectBackoffMax);
+    }
+}
+
+PostgresConnectionProvider::PostgresConnectionProvider(std::string_view connectionString, size_t poolSize)
+    : PostgresConnectionProvider(ConnectionPoolConfiguration{
+        .connectionString = std::string(connectionString),
+        .minSize = poolSize,
+        .maxSize = poolSize}) {}
+
+std::unique_ptr<pqxx::connection> PostgresConnectionProvider::OpenConnection() {
+    auto connection = std::make_unique<pqxx::connection>(configuration.connectionString);
+    StatementRegistry::PrepareAll(*connection);
+    ++connectionsOpened;
+    return connection;
+}
+
+// Se llama con el candado tomado; lo libera mientras se abre la conexión.
+// Devuelve el lugar con la conexión nueva, ya tomada por quien llama, o NoSlot.
+size_t PostgresConnectionProvider::TryOpenConnection(std::unique_lock<std::mutex>& lock) {
+    const auto slot = emptySlots.back(); // reservar el lugar antes de soltar el candado
+    emptySlots.pop_back();
+    ++openConnections;
+    lock.unlock();
+
+    std::unique_ptr<pqxx::connection> connection;
+    try {
+        connection = OpenConnection();
+    } catch (const std::exception& e) {
+        std::cerr << "[PostgresConnectionProvider] Could not open connection: " << e.what() << std::endl;
+    }
+
+    lock.lock();
+    if (connection) {
+        connections[slot].connection = std::move(connection);
+        slots[slot].idleSince.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        reconnectBackoff = configuration.reconnectBackoffInitial;
+        return slot;
+    }
+
+    emptySlots.push_back(slot);
+    --openConnections;
+    ++connectionFailures;
+    nextConnectAttempt = Clock::now() + reconnectBackoff;
+    reconnectBackoff = std::min(reconnectBackoff * 2, configuration.reconnectBackoffMax);
+    return NoSlot;
+}
+
+bool PostgresConnectionProvider::TryClaim(size_t slot) {
+    const uint64_t bit = uint64_t{1} << (slot % 64);
+    return (idleMask[slot / 64].fetch_and(~bit, std::memory_order_acq_rel) & bit) != 0;
+}
+
+// is_open() solo refleja lo que libpq ya sabe: si el servidor se reinició mientras la conexión
+// estaba ociosa, el socket sigue "abierto" hasta la siguiente consulta. Pasado validateAfterIdle
+// se hace esa consulta aquí (SELECT 1, una ida y vuelta) en lugar de en el repositorio.
+bool PostgresConnectionProvider::IsAlive(size_t slot, Clock::time_point now) {
+    auto& connection = connections[slot].connection;
+    if (!connection->is_open()) {
+        return false;
+    }
+    const Clock::time_point idleSince{Clock::duration{slots[slot].idleSince.load(std::memory_order_relaxed)}};
+    if (now - idleSince < configuration.validateAfterIdle) {
+        return true;
+    }
+    try {
+        pqxx::nontransaction tx(*connection);
+        tx.exec("SELECT 1");
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "[PostgresConnectionProvider] Discarding dead connection: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+// Toma una conexión ociosa sin candado: primero la del hilo, después la más baja libre.
+size_t PostgresConnectionProvider::TryAcquireIdle() {
+    size_t firstWord = 0;
+    if (affinity.pool == this && affinity.slot < configuration.maxSize) {
+        if (TryClaim(affinity.slot)) {
+            return affinity.slot;
+        }
+        firstWord = affinity.slot / 64;
+    }
+    for (size_t i = 0; i < idleMaskWords; i++) {
+        const size_t word = (firstWord + i) % idleMaskWords;
+        auto bits = idleMask[word].load(std::memory_order_acquire);
+        while (bits != 0) {
+            const auto bit = static_cast<size_t>(std::countr_zero(bits));
+            if (idleMask[word].compare_exchange_weak(bits, bits & ~(uint64_t{1} << bit), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return word * 64 + bit;
+            }
+        }
+    }
+    return NoSlot;
+}
+
+// Sin conexiones ociosas: abrir una si hay lugar o esperar a que alguien devuelva la suya.
+size_t PostgresConnectionProvider::AcquireSlow(Clock::time_point deadline) {
+    std::unique_lock lock(connectionPoolMutex);
+    // se anuncia antes de volver a mirar el bitmap: quien devuelva una conexión después de
+    // esta última mirada ve waiters > 0 y despierta a alguien
+    ++waiters;
+    std::atomic_thread_fence(std::memory_order_seq_cst); // pareja del fetch_or + load de MarkIdle
+    struct Leave {
+        std::atomic<size_t>& waiters;
+        ~Leave() { --waiters; }
+    } leave{waiters};
+
+    while (true) {
+        if (const auto slot = TryAcquireIdle(); slot != NoSlot) {
+            return slot;
+        }
+
+        const auto now = Clock::now();
+        const bool canGrow = !emptySlots.empty();
+        if (canGrow && now >= nextConnectAttempt) {
+            if (const auto slot = TryOpenConnection(lock); slot != NoSlot) {
+                return slot;
+            }
+            continue;
+        }
+
+        if (now >= deadline) {
+            ++exhausted;
+            throw ConnectionAcquireTimeout("Timed out waiting for a database connection");
+        }
+
+        // wait until a connection is returned or the backoff window closes
+        connectionPoolCondition.wait_until(lock, canGrow ? std::min(deadline, nextConnectAttempt) : deadline);
+    }
+}
+
+void PostgresConnectionProvider::MarkIdle(size_t slot) {
+    idleMask[slot / 64].fetch_or(uint64_t{1} << (slot % 64));
+    if (waiters.load() > 0) {
+        { std::lock_guard lock(connectionPoolMutex); }
+        connectionPoolCondition.notify_one();
+    }
+}
+
+// El lugar debe estar tomado por quien llama; la conexión se destruye fuera del candado.
+void PostgresConnectionProvider::Discard(size_t slot, std::atomic<uint64_t>& reason) {
+    auto closing = std::move(connections[slot].connection);
+    connections[slot].matchRecordsPrepared = 0;
+    {
+        std::lock_guard lock(connectionPoolMutex);
+        emptySlots.push_back(slot);
+        --openConnections;
+        ++reason;
+    }
+    // el lugar libre permite abrir otra conexión a quien esté esperando
+    connectionPoolCondition.notify_one();
+}
+
+// Cierra las conexiones ociosas por más de idleTimeout mientras haya más de minSize abiertas.
+// Las conexiones de lugares altos son las que menos se reutilizan y las que primero vencen.
+void PostgresConnectionProvider::SweepIdle(Clock::time_point now) {
+    const auto idleTimeout = std::chrono::duration_cast<Clock::duration>(configuration.idleTimeout);
+    for (size_t slot = configuration.maxSize; slot > 0 && openConnections.load() > configuration.minSize; slot--) {
+        if (!TryClaim(slot - 1)) {
+            continue;
+        }
+        const Clock::time_point idleSince{Clock::duration{slots[slot - 1].idleSince.load(std::memory_order_relaxed)}};
+        if (now - idleSince > idleTimeout) {
+            Discard(slot - 1, idleClosed);
+        } else {
+            MarkIdle(slot - 1);
+        }
+    }
+}
+
+PooledConnection PostgresConnectionProvider::Connection() {
+    const auto requestedAt = Clock::now();
+
+    size_t slot;
+    while (true) {
+        slot = TryAcquireIdle();
+        if (slot == NoSlot) {
+            slot = AcquireSlow(requestedAt + configuration.acquireTimeout);
+        }
+        if (IsAlive(slot, Clock::now())) {
+            break;
+        }
+        // la conexión se rompió mientras estaba ociosa (p. ej. reinicio de la BD)
+        Discard(slot, brokenDiscarded);
+    }
+    affinity = {this, slot};
+
+    const auto checkedOutAt = Clock::now();
+    const auto waited = ElapsedMicros(requestedAt, checkedOutAt);
+    acquisitions.fetch_add(1, std::memory_order_relaxed);
+    totalWaitMicros.fetch_add(waited, std::memory_order_relaxed);
+    UpdateMax(maxWaitMicros, waited);
+    slots[slot].checkedOutAt = checkedOutAt;
+
+    return PooledConnection(&connections[slot], *this);
+}
+
+void PostgresConnectionProvider::Return(IDbConnection* connection) noexcept {
+    const auto slot = static_cast<size_t>(static_cast<PostgresConnection*>(connection) - connections.get());
+    const auto now = Clock::now();
+    const auto held = ElapsedMicros(slots[slot].checkedOutAt, now);
+    totalHoldMicros.fetch_add(held, std::memory_order_relaxed);
+    UpdateMax(maxHoldMicros, held);
+
+    const auto& pqxxConnection = connections[slot].connection;
+    if (!pqxxConnection || !pqxxConnection->is_open()) {
+        // no se devuelve al pool: el siguiente Connection() abrirá una nueva
+        Discard(slot, brokenDiscarded);
+        return;
+    }
+    slots[slot].idleSince.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+    MarkIdle(slot);
+
+    // un solo hilo barre a la vez, como mucho cuatro veces por idleTimeout
+    if (openConnections.load(std::memory_order_relaxed) > configuration.minSize) {
+        auto nextSweep = nextIdleSweep.load(std::memory_order_relaxed);
+        const auto interval = std::chrono::duration_cast<Clock::duration>(configuration.idleTimeout) / 4;
+        if (now.time_since_epoch().count() >= nextSweep
+            && nextIdleSweep.compare_exchange_strong(nextSweep, (now + interval).time_since_epoch().count())) {
+            SweepIdle(now);
+        }
+    }
+}
+
+ConnectionPoolMetrics PostgresConnectionProvider::Metrics() const {
+    ConnectionPoolMetrics metrics;
+    metrics.open = openConnections.load();
+    for (size_t word = 0; word < idleMaskWords; word++) {
+        metrics.idle += static_cast<size_t>(std::popcount(idleMask[word].load(std::memory_order_relaxed)));
+    }
+    metrics.minSize = configuration.minSize;
+    metrics.maxSize = configuration.maxSize;
+    metrics.inUse = metrics.open - std::min(metrics.open, metrics.idle);
+    metrics.acquisitions = acquisitions.load();
+    metrics.exhausted = exhausted.load();
+    metrics.connectionsOpened = connectionsOpened.load();
+    metrics.connectionFailures = connectionFailures.load();
+    metrics.brokenDiscarded = brokenDiscarded.load();
+    metrics.idleClosed = idleClosed.load();
+    metrics.totalWaitMicros = totalWaitMicros.load();
+    metrics.maxWaitMicros = maxWaitMicros.load();
+    metrics.totalHoldMicros = totalHoldMicros.load();
+    metrics.maxHoldMicros = maxHoldMicros.load();
+    return metrics;
+}
@@ -0,0 +1,120 @@
+#include "persistence/configuration/QueryStatistics.hpp"
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+
+namespace {
+    uint64_t Micros(QueryStatistics::Clock::duration elapsed) {
+        return static_cast<uint64_t>(std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(), 0));
+    }
+
+    // Las de MATCH_RECORDS se preparan aparte, pero se registran igual que las demás
+    constexpr std::array<std::span<const PreparedStatement>, 2> Registered{StatementRegistry::All, StatementRegistry::MatchRecords};
+}
+
+QueryStatistics& QueryStatistics::Instance() {
+    static QueryStatistics instance;
+    return instance;
+}
+
+QueryStatistics::QueryStatistics() {
+    registered.reserve(StatementRegistry::All.size() + StatementRegistry::MatchRecords.size());
+    for (const auto statements : Registered) {
+        for (const auto& statement : statements) {
+            registered.emplace(statement.name, std::make_unique<Statement>());
+        }
+    }
+}
+
+void QueryStatistics::Configure(const QueryStatisticsConfiguration& configuration) {
+    slowQueryThresholdMicros = std::chrono::duration_cast<std::chrono::microseconds>(configuration.slowQueryThreshold).count();
+    explainSlowQueries = configuration.explainSlowQueries;
+}
+
+bool QueryStatistics::IsSlow(Clock::duration elapsed) const {
+    const auto threshold = slowQueryThresholdMicros.load(std::memory_order_relaxed);
+    return threshold > 0 && static_cast<int64_t>(Micros(elapsed)) >= threshold;
+}
+
+QueryStatistics::Statement& QueryStatistics::For(std::string_view statement) {
+    if (const auto found = registered.find(statement); found != registered.end()) {
+        return *found->second;
+    }
+    std::lock_guard lock(othersMutex);
+    auto found = others.find(statement);
+    if (found == others.end()) {
+        found = others.emplace(std::string(statement), std::make_unique<Statement>()).first;
+    }
+    return *found->second;
+}
+
+void QueryStatistics::Record(std::string_view statement, Clock::duration elapsed, uint64_t rows) {
+    auto& entry = For(statement);
+    entry.latency.Record(Micros(elapsed));
+    entry.rows.fetch_add(rows, std::memory_order_relaxed);
+    if (IsSlow(elapsed)) {
+        entry.slow.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void QueryStatistics::RecordError(std::string_view statement, Clock::duration elapsed, std::string_view sqlState) {
+    auto& entry = For(statement);
+    entry.latency.Record(Micros(elapsed));
+    entry.errors.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard lock(entry.errorsMutex);
+    ++entry.errorsBySqlState[std::string(sqlState.empty() ? "unknown" : sqlState)];
+}
+
+void QueryStatistics::LogSlowQuery(std::string_view statement, Clock::duration elapsed, size_t parameters, const std::optional<std::string>& plan) {
+    // el texto de la sentencia lleva $1..$n, nunca los valores
+    std::string_view sql = "(not in StatementRegistry)";
+    for (const auto statements : Registered) {
+        for (const auto& registeredStatement : statements) {
+            if (statement == registeredStatement.name) {
+                sql = registeredStatement.sql;
+            }
+        }
+    }
+    std::cerr << "[QueryStatistics] Slow query " << statement << " took "
+              << static_cast<double>(Micros(elapsed)) / 1000.0 << " ms (" << parameters << " parameters redacted): "
+              << sql << std::endl;
+    if (plan) {
+        std::cerr << *plan << std::flush;
+    }
+}
+
+std::map<std::string, StatementMetrics> QueryStatistics::Snapshot() const {
+    std::map<std::string, StatementMetrics> snapshot;
+    const auto add = [&snapshot](std::string_view name, Statement& entry) {
+        if (entry.latency.Count() == 0) return; // solo las sentencias que se han ejecutado
+        auto& metrics = snapshot[std::string(name)];
+        metrics.calls = entry.latency.Count();
+        metrics.rows = entry.rows.load(std::memory_order_relaxed);
+        metrics.slow = entry.slow.load(std::memory_order_relaxed);
+        metrics.errors = entry.errors.load(std::memory_order_relaxed);
+        metrics.meanMicros = entry.latency.Mean();
+        metrics.p50Micros = entry.latency.ValueAtPercentile(50);
+        metrics.p90Micros = entry.latency.ValueAtPercentile(90);
+        metrics.p99Micros = entry.latency.ValueAtPercentile(99);
+        metrics.maxMicros = entry.latency.Max();
+        std::lock_guard lock(entry.errorsMutex);
+        metrics.errorsBySqlState = entry.errorsBySqlState;
+    };
+    for (const auto& [name, entry] : registered) {
+        add(name, *entry);
+    }
+    std::lock_guard lock(othersMutex);
+    for (const auto& [name, entry] : others) {
+        add(name, *entry);
+    }
+    return snapshot;
+}
+
+bool query_statistics_detail::IsReadOnly(std::string_view sql) {
+    std::string upper(sql);
+    std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    for (const auto keyword : {"INSERT", "UPDATE", "DELETE", "NEXTVAL", "SETVAL"}) {
+        if (upper.find(keyword) != std::string::npos) return false;
+    }
+    return upper.find("SELECT") != std::string::npos;
+}
@@ -0,0 +1,102 @@
+#include "persistence/configuration/ReplicatedConnectionProvider.hpp"
+#include <utility>
+
+ReplicatedConnectionProvider::ReplicatedConnectionProvider(std::shared_ptr<IDbConnectionProvider> primary,
+                                                           std::vector<std::shared_ptr<IDbConnectionProvider>> replicas,
+                                                           std::chrono::milliseconds readYourWritesWindow,
+                                                           std::chrono::milliseconds replicaRetryAfter)
+    : primary(std::move(primary)), readYourWritesWindow(readYourWritesWindow), replicaRetryAfter(replicaRetryAfter) {
+    for (auto& provider : replicas) {
+        auto replica = std::make_unique<Replica>();
+        replica->provider = std::move(provider);
+        this->replicas.push_back(std::move(replica));
+    }
+}
+
+bool ReplicatedConnectionProvider::InReadYourWritesWindow() const {
+    const auto session = ReadYourWritesSession::Current();
+    return session != nullptr && session->ReadsPrimary(ReadYourWritesSession::Clock::now(), readYourWritesWindow);
+}
+
+ReplicatedConnectionProvider::Replica* ReplicatedConnectionProvider::NextReplica() {
+    const auto now = Now();
+    for (size_t attempt = 0; attempt < replicas.size(); attempt++) {
+        auto& replica = replicas[nextReplica++ % replicas.size()];
+        if (replica->unavailableUntil.load(std::memory_order_relaxed) <= now) {
+            return replica.get();
+        }
+    }
+    return nullptr;
+}
+
+PooledConnection ReplicatedConnectionProvider::Connection() {
+    const auto session = ReadYourWritesSession::Current();
+    if (readYourWritesWindow.count() == 0 || session == nullptr) {
+        return primary->Connection();
+    }
+
+    // La ventana de la sesión se abre cuando la conexión vuelve al pool y solo si el repositorio
+    // confirmó una escritura: las lecturas en el primario (p. ej. la de un read-modify-write) no la abren
+    auto connection = std::make_shared<PooledConnection>(primary->Connection());
+    IDbConnection* dbc = &**connection;
+    dbc->committedWrite = false;
+    return PooledConnection(
+        dbc,
+        [this, session, connection](IDbConnection* dbc) mutable {
+            const bool wrote = std::exchange(dbc->committedWrite, false);
+            connection.reset();
+            if (wrote) {
+                session->OpenWindow(ReadYourWritesSession::Clock::now() + readYourWritesWindow);
+            }
+        }
+    );
+}
+
+PooledConnection ReplicatedConnectionProvider::ReadConnection() {
+    if (!InReadYourWritesWindow()) {
+        for (size_t attempt = 0; attempt < replicas.size(); attempt++) {
+            auto replica = NextReplica();
+            if (replica == nullptr) {
+                break;
+            }
+            try {
+                auto connection = replica->provider->Connection();
+                ++replicaReads;
+                return connection;
+            } catch (const ConnectionAcquireTimeout&) {
+                // réplica caída o saturada: no volver a esperarla en cada lectura
+                ++replicaFailures;
+                const auto retryAt = Clock::now() + std::chrono::duration_cast<Clock::duration>(replicaRetryAfter);
+                replica->unavailableUntil.store(retryAt.time_since_epoch().count(), std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // una lectura en el primario no abre la ventana
+    ++primaryReads;
+    return primary->Connection();
+}
+
+AsyncQueryExecutor* ReplicatedConnectionProvider::Async() {
+    if (!InReadYourWritesWindow()) {
+        for (size_t attempt = 0; attempt < replicas.size(); attempt++) {
+            auto replica = NextReplica();
+            if (replica == nullptr) {
+                break;
+            }
+            if (auto executor = replica->provider->Async()) {
+                return executor;
+            }
+        }
+    }
+    return primary->Async();
+}
+
+std::vector<ConnectionPoolMetrics> ReplicatedConnectionProvider::ReplicaMetrics() const {
+    std::vector<ConnectionPoolMetrics> metrics;
+    metrics.reserve(replicas.size());
+    for (const auto& replica : replicas) {
+        metrics.push_back(replica->provider->Metrics());
+    }
+    return metrics;
+}
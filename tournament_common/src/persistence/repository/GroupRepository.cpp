@@ -1,6 +1,10 @@
 #include "persistence/repository/GroupRepository.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/StatementRegistry.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
+#include "persistence/repository/IdGenerator.hpp"
 #include "domain/Group.hpp"
+#include "domain/JsonReader.hpp"
 #include <nlohmann/json.hpp>
 #include <pqxx/pqxx>
 #include <utility>
@@ -8,36 +12,62 @@
 GroupRepository::GroupRepository(std::shared_ptr<IDbConnectionProvider> provider) : connectionProvider(std::move(provider)) {}
 
 std::optional<std::string> GroupRepository::Create(const domain::Group& entity) {
-    const nlohmann::json groupDoc = entity; 
+    const auto id = GenerateUuid();
+    nlohmann::json groupDoc = entity;
+    groupDoc["id"] = id;
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
 
     try {
         pqxx::work tx(*(connection->connection));
-        const pqxx::result result = tx.exec_params("INSERT INTO groups (document) VALUES ($1::jsonb) RETURNING id;", groupDoc.dump());
+        ExecPrepared(tx, statements::group::Insert, id, groupDoc.dump());
         tx.commit();
-        return result[0]["id"].as<std::string>();
+        connection->committedWrite = true;
+        return id;
     } catch (const std::exception& e) {
         return std::nullopt;
     }
 }
 
+std::vector<std::string> GroupRepository::CreateMany(const std::vector<domain::Group>& entities) {
+    if (entities.empty()) return {};
+    std::vector<std::string> ids;
+    ids.reserve(entities.size());
+    nlohmann::json groupDocs = nlohmann::json::array();
+    for (const auto& entity : entities) {
+        ids.push_back(GenerateUuid());
+        nlohmann::json& doc = groupDocs.emplace_back(entity);
+        doc["id"] = ids.back();
+    }
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        ExecPrepared(tx, statements::group::InsertMany, groupDocs.dump());
+        tx.commit();
+        connection->committedWrite = true;
+        return ids;
+    } catch (const std::exception& e) {
+        return {};
+    }
+}
+
 std::shared_ptr<domain::Group> GroupRepository::ReadById(std::string id) {
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
 
     try {
         pqxx::work tx(*(connection->connection));
-        const pqxx::result result = tx.exec_params("SELECT document FROM groups WHERE id = $1", id);
+        const pqxx::result result = ExecPrepared(tx, statements::group::ReadById, id);
         tx.commit();
 
         if (result.empty()) {
             return nullptr;
         }
 
-        nlohmann::json groupDoc = nlohmann::json::parse(result[0]["document"].c_str());
         auto group = std::make_shared<domain::Group>();
-        from_json(groupDoc, *group);
+        domain::json_reader::ReadDocument(result[0]["document"].view(), *group);
         group->Id() = id;
         return group;
 
@@ -48,13 +78,14 @@ std::shared_ptr<domain::Group> GroupRepository::ReadById(std::string id) {
 
 std::string GroupRepository::Update(const domain::Group & entity) {
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
     nlohmann::json groupDoc = entity;
 
     try {
         pqxx::work tx(*(connection->connection));
-        tx.exec_params("UPDATE groups SET document = $1::jsonb WHERE id = $2", groupDoc.dump(), entity.Id());
+        ExecPrepared(tx, statements::group::Update, groupDoc.dump(), entity.Id());
         tx.commit();
+        connection->committedWrite = true;
         return entity.Id();
     } catch (const std::exception& e) {
         return "";
@@ -63,12 +94,13 @@ std::string GroupRepository::Update(const domain::Group & entity) {
 
 void GroupRepository::Delete(std::string id) {
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
 
     try {
         pqxx::work tx(*(connection->connection));
-        tx.exec_params("DELETE FROM groups WHERE id = $1", id);
+        ExecPrepared(tx, statements::group::Delete, id);
         tx.commit();
+        connection->committedWrite = true;
     } catch (const std::exception& e) {
         // Manejar error si es necesario
     }
@@ -76,18 +108,17 @@ void GroupRepository::Delete(std::string id) {
 
 std::vector<std::shared_ptr<domain::Group>> GroupRepository::ReadAll() {
     std::vector<std::shared_ptr<domain::Group>> groups;
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
 
     try {
         pqxx::work tx(*(connection->connection));
-        const pqxx::result result{tx.exec("SELECT id, document FROM groups")};
+        const pqxx::result result{ExecPrepared(tx, statements::group::ReadAll)};
         tx.commit();
 
         for (auto row : result) {
-            nlohmann::json groupDoc = nlohmann::json::parse(row["document"].c_str());
             auto group = std::make_shared<domain::Group>();
-            from_json(groupDoc, *group);
+            domain::json_reader::ReadDocument(row["document"].view(), *group);
             group->Id() = row["id"].as<std::string>();
             groups.push_back(group);
         }
@@ -95,4 +126,129 @@ std::vector<std::shared_ptr<domain::Group>> GroupRepository::ReadAll() {
         // Manejar error si es necesario
     }
     return groups;
-}
\ No newline at end of file
+}
+
+std::vector<std::shared_ptr<domain::Group>> GroupRepository::ReadPage(const PageRequest& page) {
+    std::vector<std::shared_ptr<domain::Group>> groups;
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result{ExecPrepared(tx, statements::group::ReadPage, page.AfterOrFirst(), page.limit)};
+        tx.commit();
+
+        for (auto row : result) {
+            auto group = std::make_shared<domain::Group>();
+            domain::json_reader::ReadDocument(row["document"].view(), *group);
+            group->Id() = row["id"].as<std::string>();
+            groups.push_back(group);
+        }
+    } catch (const std::exception& e) {
+        // Manejar error si es necesario
+    }
+    return groups;
+}
+
+std::vector<std::shared_ptr<domain::Group>> GroupRepository::ReadByIds(std::span<const std::string> ids) {
+    std::vector<std::shared_ptr<domain::Group>> groups;
+    const auto uuids = WellFormedIds(ids);
+    if (uuids.empty()) return groups;
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result{ExecPrepared(tx, statements::group::ReadByIds, uuids)};
+        tx.commit();
+
+        groups.reserve(result.size());
+        for (auto row : result) {
+            auto group = std::make_shared<domain::Group>();
+            domain::json_reader::ReadDocument(row["document"].view(), *group);
+            group->Id() = row["id"].as<std::string>();
+            groups.push_back(group);
+        }
+    } catch (const std::exception& e) {
+        // Manejar error si es necesario
+    }
+    return groups;
+}
+
+std::vector<std::shared_ptr<domain::Group>> GroupRepository::FindByTournamentId(const std::string& tournamentId) {
+    // Sin cursor ni límite: misma sentencia que la paginada con LIMIT NULL
+    return ReadPageByTournamentId(tournamentId, PageRequest{});
+}
+
+std::vector<std::shared_ptr<domain::Group>> GroupRepository::ReadPageByTournamentId(const std::string& tournamentId, const PageRequest& page) {
+    std::vector<std::shared_ptr<domain::Group>> groups;
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result{ExecPrepared(tx, statements::group::ReadPageByTournamentId, tournamentId, page.AfterOrFirst(), page.limit)};
+        tx.commit();
+
+        for (auto row : result) {
+            auto group = std::make_shared<domain::Group>();
+            domain::json_reader::ReadDocument(row["document"].view(), *group);
+            group->Id() = row["id"].as<std::string>();
+            groups.push_back(group);
+        }
+    } catch (const std::exception& e) {
+        // Manejar error si es necesario
+    }
+    return groups;
+}
+
+// Validación antes de una escritura: va al primario y trae un solo campo del documento
+std::optional<std::string> GroupRepository::FindTournamentIdById(const std::string& groupId) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::group::ReadTournamentIdById, groupId);
+        tx.commit();
+
+        if (result.empty()) {
+            return std::nullopt;
+        }
+        return result[0]["tournament_id"].as<std::string>(std::string());
+    } catch (const std::exception& e) {
+        return std::nullopt;
+    }
+}
+
+std::optional<TeamsRegistration> GroupRepository::AddTeams(const std::string& tournamentId, const std::string& groupId,
+                                                           std::span<const std::string> teamIds, int maxTeams) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        if (ExecPrepared(tx, statements::group::LockForTeams, groupId, tournamentId).empty()) {
+            return TeamsRegistration{TeamRegistration::GroupNotFound, {}};
+        }
+
+        for (const auto& teamId : teamIds) {
+            const pqxx::result result = ExecPrepared(tx, statements::group::AddTeam, groupId, tournamentId, teamId, maxTeams);
+            const auto row = result[0];
+            if (row["registered"].as<bool>()) {
+                continue;
+            }
+            // sin commit: el destructor de tx deshace las inscripciones anteriores del lote
+            if (!row["team_exists"].as<bool>()) {
+                return TeamsRegistration{TeamRegistration::TeamNotFound, teamId};
+            }
+            return TeamsRegistration{row["duplicate"].as<bool>() ? TeamRegistration::AlreadyRegistered : TeamRegistration::GroupFull, teamId};
+        }
+
+        tx.commit();
+        connection->committedWrite = true;
+        return TeamsRegistration{TeamRegistration::Registered, {}};
+    } catch (const std::exception& e) {
+        return std::nullopt;
+    }
+}
@@ -1,7 +1,13 @@
 #include "persistence/repository/MatchRepository.hpp"
+#include "domain/JsonReader.hpp"
 #include "persistence/configuration/PostgresConnection.hpp" // Incluir para la conexión
+#include "persistence/configuration/StatementRegistry.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
+#include "persistence/configuration/PipelinedTransaction.hpp"
+#include "persistence/repository/IdGenerator.hpp"
 #include <nlohmann/json.hpp>
 #include <pqxx/pqxx>
+#include <stdexcept>
 #include <utility>
 
 // ✅ CAMBIO: Añadir la apertura del namespace
@@ -12,29 +18,56 @@ MatchRepository::MatchRepository(std::shared_ptr<IDbConnectionProvider> provider
 
 // Implementaciones de IRepository
 std::optional<std::string> MatchRepository::Create(const domain::Match& entity) {
-    const nlohmann::json matchDoc = entity; 
+    const auto id = entity.Id().empty() ? GenerateUuid() : entity.Id();
+    nlohmann::json matchDoc = entity;
+    matchDoc["id"] = id;
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
     try {
         pqxx::work tx(*(connection->connection));
-        const pqxx::result result = tx.exec_params("INSERT INTO matches (document) VALUES ($1::jsonb) RETURNING id;", matchDoc.dump());
+        ExecPrepared(tx, statements::match::Insert, id, matchDoc.dump());
         tx.commit();
-        return result[0]["id"].as<std::string>();
+        connection->committedWrite = true;
+        return id;
     } catch (const std::exception& e) { return std::nullopt; }
 }
 
+std::vector<std::string> MatchRepository::CreateMany(const std::vector<domain::Match>& entities) {
+    if (entities.empty()) return {};
+    std::vector<std::string> ids;
+    ids.reserve(entities.size());
+    nlohmann::json matchDocs = nlohmann::json::array();
+    for (const auto& entity : entities) {
+        // como Create, respeta el id que ya trae el partido
+        ids.push_back(entity.Id().empty() ? GenerateUuid() : entity.Id());
+        nlohmann::json& doc = matchDocs.emplace_back(entity);
+        doc["id"] = ids.back();
+    }
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        ExecPrepared(tx, statements::match::InsertMany, matchDocs.dump());
+        tx.commit();
+        connection->committedWrite = true;
+        return ids;
+    } catch (const std::exception& e) {
+        return {};
+    }
+}
+
 std::shared_ptr<domain::Match> MatchRepository::ReadById(std::string id) {
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
     try {
         pqxx::work tx(*(connection->connection));
-        const pqxx::result result = tx.exec_params("SELECT document FROM matches WHERE id = $1", id);
+        const pqxx::result result = ExecPrepared(tx, statements::match::ReadById, id);
         tx.commit();
         if (result.empty()) return nullptr;
 
-        nlohmann::json matchDoc = nlohmann::json::parse(result[0]["document"].c_str());
         auto match = std::make_shared<domain::Match>();
-        from_json(matchDoc, *match);
+        domain::json_reader::ReadDocument(result[0]["document"].view(), *match);
         match->Id() = id;
         return match;
     } catch (const std::exception& e) { return nullptr; }
@@ -42,38 +75,57 @@ std::shared_ptr<domain::Match> MatchRepository::ReadById(std::string id) {
 
 std::string MatchRepository::Update(const domain::Match & entity) {
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
     nlohmann::json matchDoc = entity;
     try {
         pqxx::work tx(*(connection->connection));
-        tx.exec_params("UPDATE matches SET document = $1::jsonb WHERE id = $2", matchDoc.dump(), entity.Id());
+        ExecPrepared(tx, statements::match::Update, matchDoc.dump(), entity.Id());
         tx.commit();
+        connection->committedWrite = true;
         return entity.Id();
     } catch (const std::exception& e) { return ""; }
 }
 
 void MatchRepository::Delete(std::string id) {
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
     try {
         pqxx::work tx(*(connection->connection));
-        tx.exec_params("DELETE FROM matches WHERE id = $1", id);
+        ExecPrepared(tx, statements::match::Delete, id);
         tx.commit();
+        connection->committedWrite = true;
     } catch (const std::exception& e) { /* Manejar error */ }
 }
 
 std::vector<std::shared_ptr<domain::Match>> MatchRepository::ReadAll() {
     std::vector<std::shared_ptr<domain::Match>> matches;
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result{ExecPrepared(tx, statements::match::ReadAll)};
+        tx.commit();
+        for (auto row : result) {
+            auto match = std::make_shared<domain::Match>();
+            domain::json_reader::ReadDocument(row["document"].view(), *match);
+            match->Id() = row["id"].as<std::string>();
+            matches.push_back(match);
+        }
+    } catch (const std::exception& e) { /* Manejar error */ }
+    return matches;
+}
+
+std::vector<std::shared_ptr<domain::Match>> MatchRepository::ReadPage(const PageRequest& page) {
+    std::vector<std::shared_ptr<domain::Match>> matches;
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
     try {
         pqxx::work tx(*(connection->connection));
-        const pqxx::result result{tx.exec("SELECT id, document FROM matches")};
+        const pqxx::result result{ExecPrepared(tx, statements::match::ReadPage, page.AfterOrFirst(), page.limit)};
         tx.commit();
         for (auto row : result) {
-            nlohmann::json matchDoc = nlohmann::json::parse(row["document"].c_str());
             auto match = std::make_shared<domain::Match>();
-            from_json(matchDoc, *match);
+            domain::json_reader::ReadDocument(row["document"].view(), *match);
             match->Id() = row["id"].as<std::string>();
             matches.push_back(match);
         }
@@ -82,18 +134,17 @@ std::vector<std::shared_ptr<domain::Match>> MatchRepository::ReadAll() {
 }
 
 // Implementaciones de IMatchRepository
-std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTournamentId(std::string tournamentId) {
+std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTournamentId(std::string tournamentId, const PageRequest& page) {
     std::vector<std::shared_ptr<domain::Match>> matches;
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
     try {
         pqxx::work tx(*(connection->connection));
-        pqxx::result result = tx.exec_params("SELECT id, document FROM matches WHERE document->>'tournamentId' = $1", tournamentId);
+        pqxx::result result = ExecPrepared(tx, statements::match::FindByTournamentId, tournamentId, page.AfterOrFirst(), page.limit);
         tx.commit();
         for (auto row : result) {
-            nlohmann::json matchDoc = nlohmann::json::parse(row["document"].c_str());
             auto match = std::make_shared<domain::Match>();
-            from_json(matchDoc, *match);
+            domain::json_reader::ReadDocument(row["document"].view(), *match);
             match->Id() = row["id"].as<std::string>();
             matches.push_back(match);
         }
@@ -101,22 +152,44 @@ std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTournamentId(
     return matches;
 }
 
-std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTournamentIdAndPhase(std::string tournamentId, domain::MatchPhase phase) {
+IMatchRepository::ArenaMatches MatchRepository::FindByTournamentId(std::string tournamentId, const PageRequest& page, std::pmr::memory_resource* arena) {
+    ArenaMatches matches(arena);
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        pqxx::work tx(*(connection->connection));
+        pqxx::result result = ExecPrepared(tx, statements::match::FindByTournamentId, tournamentId, page.AfterOrFirst(), page.limit);
+        tx.commit();
+        matches.reserve(result.size());
+        const std::pmr::polymorphic_allocator<domain::Match> allocator(arena);
+        for (auto row : result) {
+            auto match = std::allocate_shared<domain::Match>(allocator);
+            domain::json_reader::ReadDocument(row["document"].view(), *match);
+            match->Id() = row["id"].as<std::string>();
+            matches.push_back(std::move(match));
+        }
+    } catch (const std::exception& e) { /* Manejar error */ }
+    return matches;
+}
+
+std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTournamentIdAndPhase(std::string tournamentId, domain::MatchPhase phase, const PageRequest& page) {
     std::vector<std::shared_ptr<domain::Match>> matches;
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
     try {
         pqxx::work tx(*(connection->connection));
-        pqxx::result result = tx.exec_params(
-            "SELECT id, document FROM matches WHERE document->>'tournamentId' = $1 AND document->>'phase' = $2", 
-            tournamentId, 
-            domain::Match::PhaseToString(phase) // Usa la función estática
+        pqxx::result result = ExecPrepared(
+            tx,
+            statements::match::FindByTournamentIdAndPhase,
+            tournamentId,
+            domain::Match::PhaseToString(phase), // Usa la función estática
+            page.AfterOrFirst(),
+            page.limit
         );
         tx.commit();
         for (auto row : result) {
-            nlohmann::json matchDoc = nlohmann::json::parse(row["document"].c_str());
             auto match = std::make_shared<domain::Match>();
-            from_json(matchDoc, *match);
+            domain::json_reader::ReadDocument(row["document"].view(), *match);
             match->Id() = row["id"].as<std::string>();
             matches.push_back(match);
         }
@@ -124,21 +197,17 @@ std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTournamentIdA
     return matches;
 }
 
-std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByGroupId(std::string groupId) {
+std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByGroupId(std::string groupId, const PageRequest& page) {
     std::vector<std::shared_ptr<domain::Match>> matches;
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
     try {
         pqxx::work tx(*(connection->connection));
-        pqxx::result result = tx.exec_params(
-            "SELECT id, document FROM matches WHERE document->>'groupId' = $1", 
-            groupId
-        );
+        pqxx::result result = ExecPrepared(tx, statements::match::FindByGroupId, groupId, page.AfterOrFirst(), page.limit);
         tx.commit();
         for (auto row : result) {
-            nlohmann::json matchDoc = nlohmann::json::parse(row["document"].c_str());
             auto match = std::make_shared<domain::Match>();
-            from_json(matchDoc, *match);
+            domain::json_reader::ReadDocument(row["document"].view(), *match);
             match->Id() = row["id"].as<std::string>();
             matches.push_back(match);
         }
@@ -146,21 +215,17 @@ std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByGroupId(std::
     return matches;
 }
 
-std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTeamId(std::string teamId) {
+std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTeamId(std::string teamId, const PageRequest& page) {
     std::vector<std::shared_ptr<domain::Match>> matches;
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
     try {
         pqxx::work tx(*(connection->connection));
-        pqxx::result result = tx.exec_params(
-            "SELECT id, document FROM matches WHERE document->>'team1Id' = $1 OR document->>'team2Id' = $1", 
-            teamId
-        );
+        pqxx::result result = ExecPrepared(tx, statements::match::FindByTeamId, teamId, page.AfterOrFirst(), page.limit);
         tx.commit();
         for (auto row : result) {
-            nlohmann::json matchDoc = nlohmann::json::parse(row["document"].c_str());
             auto match = std::make_shared<domain::Match>();
-            from_json(matchDoc, *match);
+            domain::json_reader::ReadDocument(row["document"].view(), *match);
             match->Id() = row["id"].as<std::string>();
             matches.push_back(match);
         }
@@ -170,16 +235,10 @@ std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTeamId(std::s
 
 bool MatchRepository::IsGroupStageComplete(std::string tournamentId) {
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
     try {
         pqxx::work tx(*(connection->connection));
-        const pqxx::result result = tx.exec_params(R"(
-            SELECT 
-                COUNT(*) as total,
-                COUNT(*) FILTER (WHERE (document->>'status') = 'COMPLETED') as completed
-            FROM matches
-            WHERE (document->>'tournamentId') = $1 AND (document->>'phase') = 'GROUP_STAGE'
-        )", tournamentId);
+        const pqxx::result result = ExecPrepared(tx, statements::match::IsGroupStageComplete, tournamentId);
         tx.commit();
 
         if (result.empty()) return false;
@@ -189,18 +248,139 @@ bool MatchRepository::IsGroupStageComplete(std::string tournamentId) {
     } catch (const std::exception& e) { return false; }
 }
 
+std::vector<std::string> MatchRepository::FindGroupIdsByTournamentId(std::string tournamentId) {
+    std::vector<std::string> groupIds;
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match::FindGroupIdsByTournamentId, tournamentId);
+        tx.commit();
+        groupIds.reserve(result.size());
+        for (const auto& row : result) {
+            groupIds.emplace_back(row[0].c_str());
+        }
+    } catch (const std::exception& e) { /* Manejar error */ }
+    return groupIds;
+}
+
+std::vector<MatchResult> MatchRepository::FindCompletedResultsByGroupId(std::string groupId) {
+    std::vector<MatchResult> results;
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match::FindCompletedResultsByGroupId, groupId);
+        tx.commit();
+        results.reserve(result.size());
+        for (const auto& row : result) {
+            results.push_back(MatchResult::FromText(row[0].view(), row[1].view(), row[2].as<int>(), row[3].as<int>()));
+        }
+    } catch (const std::exception& e) { /* Manejar error */ }
+    return results;
+}
+
+// Un solo upsert con RETURNING: un checkout y una transacción, sin releer el partido con ReadById
 domain::Match MatchRepository::Save(const domain::Match& match) {
-    if (match.Id().empty()) {
-        auto newId = Create(match);
-        if (newId) {
-            auto newMatch = ReadById(*newId);
-            if (newMatch) return *newMatch;
+    const auto id = match.Id().empty() ? GenerateUuid() : match.Id();
+    nlohmann::json matchDoc = match;
+    matchDoc["id"] = id;
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match::Upsert, id, matchDoc.dump());
+        tx.commit();
+        connection->committedWrite = true;
+
+        domain::Match saved;
+        domain::json_reader::ReadDocument(result[0]["document"].view(), saved);
+        saved.Id() = result[0]["id"].as<std::string>();
+        return saved;
+    } catch (const std::exception& e) {
+        throw std::runtime_error(std::string("No se pudo guardar el partido (MatchRepository::Save): ") + e.what());
+    }
+}
+
+// Un solo upsert para todo el lote: los partidos nuevos reciben su id aquí y los existentes se reemplazan.
+std::vector<domain::Match> MatchRepository::SaveAll(const std::vector<domain::Match>& matches) {
+    if (matches.empty()) return {};
+    std::vector<domain::Match> saved = matches;
+    nlohmann::json matchDocs = nlohmann::json::array();
+    for (auto& match : saved) {
+        if (match.Id().empty()) {
+            match.Id() = GenerateUuid();
         }
-    } else {
-        Update(match);
+        matchDocs.push_back(match);
+    }
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        ExecPrepared(tx, statements::match::SaveMany, matchDocs.dump());
+        tx.commit();
+        connection->committedWrite = true;
+    } catch (const std::exception& e) {
+        throw std::runtime_error(std::string("No se pudieron guardar los partidos (MatchRepository::SaveAll): ") + e.what());
+    }
+    return saved;
+}
+
+// Dos idas y vueltas en lugar de seis: [BEGIN + SELECT ... FOR UPDATE] y [UPDATE + COMMIT],
+// con un solo checkout del pool. El bloqueo de la fila evita perder una escritura concurrente.
+std::shared_ptr<domain::Match> MatchRepository::UpdateById(const std::string& id, const std::function<void(domain::Match&)>& modify) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        PipelinedTransaction tx(*(connection->connection));
+        const auto result = tx.Retrieve(tx.Execute(statements::match::ReadByIdForUpdate, id));
+        if (result.Empty()) return nullptr;
+
+        auto match = std::make_shared<domain::Match>();
+        domain::json_reader::ReadDocument(result.View(0, result.Column("document")), *match);
+        match->Id() = id;
+
+        modify(*match); // si lanza, el destructor de tx hace ROLLBACK y la excepción sigue su curso
+
+        const nlohmann::json matchDoc = *match;
+        tx.Execute(statements::match::Update, matchDoc.dump(), id);
+        tx.Commit();
+        connection->committedWrite = true;
         return match;
+    } catch (const pqxx::failure& e) {
+        throw std::runtime_error(std::string("No se pudo actualizar el partido (MatchRepository::UpdateById): ") + e.what());
+    }
+}
+
+// Dos idas y vueltas: [BEGIN + INSERT + UPDATE] y [COMMIT]. El id del partido nuevo se genera
+// aquí, así el INSERT y el UPDATE no dependen uno del otro; el resultado del UPDATE se lee antes
+// de confirmar para no dejar creado un partido al que nada enlaza si el terminado ya no existe.
+domain::Match MatchRepository::CreateLinked(const domain::Match& nextMatch, const domain::Match& completedMatch) {
+    auto created = nextMatch;
+    created.Id() = GenerateUuid();
+    auto linked = completedMatch;
+    linked.SetNextMatchId(created.Id());
+    const nlohmann::json createdDoc = created;
+    const nlohmann::json linkedDoc = linked;
+
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PipelinedTransaction tx(*(connection->connection));
+        tx.Execute(statements::match::Insert, created.Id(), createdDoc.dump());
+        const auto update = tx.Execute(statements::match::Update, linkedDoc.dump(), linked.Id());
+        if (tx.Retrieve(update).AffectedRows() != 1) {
+            throw std::runtime_error("el partido " + linked.Id() + " no existe"); // el destructor de tx hace ROLLBACK
+        }
+        tx.Commit();
+        connection->committedWrite = true;
+    } catch (const std::exception& e) {
+        throw std::runtime_error(std::string("No se pudo crear el siguiente partido (MatchRepository::CreateLinked): ") + e.what());
     }
-    throw std::runtime_error("No se pudo guardar el partido (MatchRepository::Save)");
+    return created;
 }
 
 } // ✅ CAMBIO: Añadir el cierre del namespace
@@ -1,27 +1,31 @@
 #include "persistence/repository/TournamentRepository.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/StatementRegistry.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include "persistence/configuration/AsyncQueryExecutor.hpp"
+#include "domain/JsonReader.hpp"
 #include "domain/Tournament.hpp"
 #include <nlohmann/json.hpp>
 #include <pqxx/pqxx>
 
-TournamentRepository::TournamentRepository(std::shared_ptr<IDbConnectionProvider> connection) : connectionProvider(std::move(connection)) {}
+TournamentRepository::TournamentRepository(std::shared_ptr<IDbConnectionProvider> connection, MatchStorage matchStorage)
+    : connectionProvider(std::move(connection)), matchStorage(matchStorage) {}
 
 std::shared_ptr<domain::Tournament> TournamentRepository::ReadById(std::string id) {
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
 
     try {
         pqxx::work tx(*(connection->connection));
-        // ✅ CAMBIO: Volvemos a usar exec_params
-        const pqxx::result result = tx.exec_params("SELECT id, document FROM tournaments WHERE id = $1", id);
+        const pqxx::result result = ExecPrepared(tx, statements::tournament::ReadById, id);
         tx.commit();
 
         if (result.empty()) {
             return nullptr;
         }
-        nlohmann::json rowTournament = nlohmann::json::parse(result.at(0)["document"].c_str());
         auto tournament = std::make_shared<domain::Tournament>();
-        from_json(rowTournament, *tournament);
+        domain::json_reader::ReadDocument(result.at(0)["document"].view(), *tournament);
         tournament->Id() = result.at(0)["id"].as<std::string>();
         return tournament;
     } catch (const std::exception& e) {
@@ -29,17 +33,123 @@ std::shared_ptr<domain::Tournament> TournamentRepository::ReadById(std::string i
     }
 }
 
+// Grupos, equipos y partidos llegan ya agregados en la misma fila; cada vector se reserva con el
+// tamaño del arreglo antes de decodificarlo, así el agregado se llena sin realojarse.
+std::shared_ptr<domain::Tournament> TournamentRepository::ReadAggregateById(const std::string& id) {
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        // la variante tipada vive con las sentencias de MATCH_RECORDS, que se preparan al primer uso
+        if (matchStorage == MatchStorage::Typed) {
+            StatementRegistry::PrepareMatchRecords(*connection->connection, connection->matchRecordsPrepared);
+        }
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, matchStorage == MatchStorage::Typed
+            ? statements::match_record::ReadTournamentAggregateById
+            : statements::tournament::ReadAggregateById, id);
+        tx.commit();
+
+        if (result.empty()) {
+            return nullptr;
+        }
+        const auto row = result.at(0);
+        auto tournament = std::make_shared<domain::Tournament>();
+        domain::json_reader::ReadDocument(row["document"].view(), *tournament);
+        tournament->Id() = row["id"].as<std::string>();
+
+        domain::json_reader::ReadDocument(row["groups"].view(), tournament->Groups());
+        domain::json_reader::ReadDocument(row["matches"].view(), tournament->Matches());
+        return tournament;
+    } catch (const std::exception& e) {
+        return nullptr;
+    }
+}
+
+std::vector<std::shared_ptr<domain::Tournament>> TournamentRepository::ReadByIds(std::span<const std::string> ids) {
+    std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+    const auto uuids = WellFormedIds(ids);
+    if (uuids.empty()) return tournaments;
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::tournament::ReadByIds, uuids);
+        tx.commit();
+
+        tournaments.reserve(result.size());
+        for (auto row : result) {
+            auto tournament = std::make_shared<domain::Tournament>();
+            domain::json_reader::ReadDocument(row["document"].view(), *tournament);
+            tournament->Id() = row["id"].as<std::string>();
+            tournaments.push_back(tournament);
+        }
+    } catch (const std::exception& e) {
+        // Manejar error si es necesario
+    }
+    return tournaments;
+}
+
+// Validación antes de una escritura: va al primario y no parsea el documento
+bool TournamentRepository::Exists(std::string id) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::tournament::Exists, id);
+        tx.commit();
+        return !result.empty();
+    } catch (const std::exception& e) {
+        return false;
+    }
+}
+
+void TournamentRepository::ReadByIdAsync(std::string id, ReadCallback callback) {
+    const auto executor = connectionProvider->Async();
+    if (executor == nullptr) {
+        IRepository::ReadByIdAsync(std::move(id), std::move(callback));
+        return;
+    }
+
+    executor->Execute(statements::tournament::ReadById, {std::move(id)}, [callback = std::move(callback)](AsyncQueryResult result) {
+        if (result.status == AsyncQueryResult::Status::TimedOut) {
+            callback(std::unexpected(std::make_exception_ptr(ConnectionAcquireTimeout(result.error))));
+            return;
+        }
+        const auto id = result.Ok() && !result.rows.empty() ? result.Value(0, "id") : nullptr;
+        const auto document = result.Ok() && !result.rows.empty() ? result.Value(0, "document") : nullptr;
+        if (id == nullptr || document == nullptr || !id->has_value() || !document->has_value()) {
+            callback(nullptr);
+            return;
+        }
+
+        std::shared_ptr<domain::Tournament> tournament;
+        try {
+            tournament = std::make_shared<domain::Tournament>();
+            domain::json_reader::ReadDocument(**document, *tournament);
+            tournament->Id() = **id;
+        } catch (const std::exception& e) {
+            tournament = nullptr;
+        }
+        callback(std::move(tournament));
+    });
+}
+
 std::optional<std::string> TournamentRepository::Create(const domain::Tournament& entity) {
-    const nlohmann::json tournamentDoc = entity;
+    const auto id = GenerateUuid();
+    nlohmann::json tournamentDoc = entity;
+    tournamentDoc["id"] = id;
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
 
     try {
         pqxx::work tx(*(connection->connection));
-        // ✅ CAMBIO: Volvemos a usar exec_params
-        const pqxx::result result = tx.exec_params("INSERT INTO tournaments (document) VALUES ($1::jsonb) RETURNING id;", tournamentDoc.dump());
+        ExecPrepared(tx, statements::tournament::Insert, id, tournamentDoc.dump());
         tx.commit();
-        return result[0]["id"].as<std::string>();
+        connection->committedWrite = true;
+        return id;
     } catch (const pqxx::unique_violation& e) {
         return std::nullopt;
     } catch (const std::exception& e) {
@@ -47,16 +157,40 @@ std::optional<std::string> TournamentRepository::Create(const domain::Tournament
     }
 }
 
+std::vector<std::string> TournamentRepository::CreateMany(const std::vector<domain::Tournament>& entities) {
+    if (entities.empty()) return {};
+    std::vector<std::string> ids;
+    ids.reserve(entities.size());
+    nlohmann::json tournamentDocs = nlohmann::json::array();
+    for (const auto& entity : entities) {
+        ids.push_back(GenerateUuid());
+        nlohmann::json& doc = tournamentDocs.emplace_back(entity);
+        doc["id"] = ids.back();
+    }
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        ExecPrepared(tx, statements::tournament::InsertMany, tournamentDocs.dump());
+        tx.commit();
+        connection->committedWrite = true;
+        return ids;
+    } catch (const std::exception& e) {
+        return {};
+    }
+}
+
 std::string TournamentRepository::Update(const domain::Tournament& entity) {
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
     nlohmann::json tournamentDoc = entity;
 
     try {
         pqxx::work tx(*(connection->connection));
-        // ✅ CAMBIO: Volvemos a usar exec_params
-        tx.exec_params("UPDATE tournaments SET document = $1::jsonb WHERE id = $2", tournamentDoc.dump(), entity.Id());
+        ExecPrepared(tx, statements::tournament::Update, tournamentDoc.dump(), entity.Id());
         tx.commit();
+        connection->committedWrite = true;
         return entity.Id();
     } catch (const std::exception& e) {
         return "";
@@ -65,12 +199,12 @@ std::string TournamentRepository::Update(const domain::Tournament& entity) {
 
 void TournamentRepository::Delete(std::string id) {
     auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto connection = AsPostgres(pooled);
     try {
         pqxx::work tx(*(connection->connection));
-        // ✅ CAMBIO: Volvemos a usar exec_params
-        tx.exec_params("DELETE FROM tournaments WHERE id = $1", id);
+        ExecPrepared(tx, statements::tournament::Delete, id);
         tx.commit();
+        connection->committedWrite = true;
     } catch (const std::exception& e) {
         // Manejar error si es necesario
     }
@@ -78,19 +212,39 @@ void TournamentRepository::Delete(std::string id) {
 
 std::vector<std::shared_ptr<domain::Tournament>> TournamentRepository::ReadAll() {
     std::vector<std::shared_ptr<domain::Tournament>> tournaments;
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result{ExecPrepared(tx, statements::tournament::ReadAll)};
+        tx.commit();
+
+        for (auto row : result) {
+            auto tournament = std::make_shared<domain::Tournament>();
+            domain::json_reader::ReadDocument(row["document"].view(), *tournament);
+            tournament->Id() = row["id"].as<std::string>();
+            tournaments.push_back(tournament);
+        }
+    } catch (const std::exception& e) {
+        // Manejar error
+    }
+    return tournaments;
+}
+
+std::vector<std::shared_ptr<domain::Tournament>> TournamentRepository::ReadPage(const PageRequest& page) {
+    std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
 
     try {
         pqxx::work tx(*(connection->connection));
-        // Este no necesita parámetros, así que `exec` es correcto aquí
-        const pqxx::result result{tx.exec_params("SELECT id, document FROM tournaments")};
+        const pqxx::result result{ExecPrepared(tx, statements::tournament::ReadPage, page.AfterOrFirst(), page.limit)};
         tx.commit();
 
         for (auto row : result) {
-            nlohmann::json rowTournament = nlohmann::json::parse(row["document"].c_str());
             auto tournament = std::make_shared<domain::Tournament>();
-            from_json(rowTournament, *tournament);
+            domain::json_reader::ReadDocument(row["document"].view(), *tournament);
             tournament->Id() = row["id"].as<std::string>();
             tournaments.push_back(tournament);
         }
@@ -98,4 +252,30 @@ std::vector<std::shared_ptr<domain::Tournament>> TournamentRepository::ReadAll()
         // Manejar error
     }
     return tournaments;
-}
\ No newline at end of file
+}
+
+bool TournamentRepository::StreamAll(const std::function<void(const domain::Tournament&)>& consumer) {
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        ExecCopy("copy_tournaments_out", [&] {
+            uint64_t rows = 0;
+            auto stream = pqxx::stream_from::query(tx, statements::tournament::StreamAll);
+            for (auto [id, document] : stream.iter<std::string_view, std::string_view>()) {
+                domain::Tournament tournament;
+                domain::json_reader::ReadDocument(document, tournament);
+                tournament.Id() = std::string(id);
+                consumer(tournament);
+                ++rows;
+            }
+            stream.complete();
+            return rows;
+        });
+        tx.commit();
+        return true;
+    } catch (const std::exception& e) {
+        return false;
+    }
+}
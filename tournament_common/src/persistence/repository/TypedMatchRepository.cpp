@@ -0,0 +1,440 @@
+#include "persistence/repository/TypedMatchRepository.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/StatementRegistry.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
+#include "persistence/configuration/PipelinedTransaction.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include <charconv>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace repository {
+
+namespace {
+    // Posición de cada columna en MATCH_RECORD_COLUMNS
+    namespace column {
+        enum : int { Id, TournamentId, GroupId, Phase, MatchNumber, Team1Id, Team2Id, Team1Score, Team2Score, Status, NextMatchId };
+    }
+
+    // groupId vacío en el dominio = sin grupo (NULL)
+    std::optional<std::string> NullIfEmpty(const std::string& value) {
+        return value.empty() ? std::nullopt : std::optional<std::string>(value);
+    }
+
+    // Llama a bind con el id y los valores de las columnas restantes en el orden de los
+    // parámetros $1..$11 de match_record::Insert, Upsert y Update
+    template<typename Bind>
+    decltype(auto) BindColumns(const std::optional<std::string>& id, const domain::Match& match, Bind&& bind) {
+        return bind(id, match.TournamentId(), NullIfEmpty(match.GroupId()),
+                    domain::Match::PhaseToString(match.Phase()), match.MatchNumber(),
+                    match.Team1Id(), match.Team2Id(), match.Team1Score(), match.Team2Score(),
+                    domain::Match::StatusToString(match.Status()), match.NextMatchId());
+    }
+
+    int ParseInt(std::string_view text) {
+        int value = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc() || end != text.data() + text.size()) {
+            throw std::invalid_argument("Entero inválido en match_records: " + std::string(text));
+        }
+        return value;
+    }
+
+    // Arma el partido con value(columna), que da el texto de la columna o nullopt si es NULL.
+    // Lo comparten las filas de pqxx y las de PipelinedTransaction.
+    template<typename Value>
+    domain::Match DecodeColumns(Value value) {
+        const auto text = [&](int column) { return std::string(value(column).value_or(std::string_view())); };
+        const auto optionalText = [&](int column) {
+            const auto field = value(column);
+            return field ? std::optional<std::string>(*field) : std::nullopt;
+        };
+        const auto optionalInt = [&](int column) {
+            const auto field = value(column);
+            return field ? std::optional<int>(ParseInt(*field)) : std::nullopt;
+        };
+
+        domain::Match match;
+        match.Id() = text(column::Id);
+        match.TournamentId() = text(column::TournamentId);
+        match.GroupId() = text(column::GroupId);
+        match.Phase() = domain::Match::StringToPhase(text(column::Phase));
+        match.MatchNumber() = ParseInt(value(column::MatchNumber).value_or(std::string_view()));
+        match.Team1Id() = optionalText(column::Team1Id);
+        match.Team2Id() = optionalText(column::Team2Id);
+        match.Team1Score() = optionalInt(column::Team1Score);
+        match.Team2Score() = optionalInt(column::Team2Score);
+        match.Status() = domain::Match::StringToStatus(text(column::Status));
+        match.NextMatchId() = optionalText(column::NextMatchId);
+        return match;
+    }
+
+    domain::Match DecodeRow(const PipelineResult& result, int row) {
+        return DecodeColumns([&](int column) {
+            return result.IsNull(row, column) ? std::nullopt : std::optional<std::string_view>(result.View(row, column));
+        });
+    }
+
+    void PrepareMatchRecords(PostgresConnection& connection) {
+        StatementRegistry::PrepareMatchRecords(*connection.connection, connection.matchRecordsPrepared);
+    }
+
+    std::vector<std::shared_ptr<domain::Match>> DecodeAll(const pqxx::result& result) {
+        std::vector<std::shared_ptr<domain::Match>> matches;
+        matches.reserve(result.size());
+        for (const auto& row : result) {
+            matches.push_back(std::make_shared<domain::Match>(TypedMatchRepository::Decode(row)));
+        }
+        return matches;
+    }
+
+    // Igual que DecodeAll, con el vector y los partidos en la arena de la petición
+    IMatchRepository::ArenaMatches DecodeAll(const pqxx::result& result, std::pmr::memory_resource* arena) {
+        IMatchRepository::ArenaMatches matches(arena);
+        matches.reserve(result.size());
+        const std::pmr::polymorphic_allocator<domain::Match> allocator(arena);
+        for (const auto& row : result) {
+            matches.push_back(std::allocate_shared<domain::Match>(allocator, TypedMatchRepository::Decode(row)));
+        }
+        return matches;
+    }
+}
+
+TypedMatchRepository::TypedMatchRepository(std::shared_ptr<IDbConnectionProvider> provider) : connectionProvider(std::move(provider)) {}
+
+domain::Match TypedMatchRepository::Decode(const pqxx::row& row) {
+    return DecodeColumns([&](int column) {
+        const auto field = row[column];
+        return field.is_null() ? std::nullopt : std::optional<std::string_view>(field.view());
+    });
+}
+
+std::optional<std::string> TypedMatchRepository::Create(const domain::Match& entity) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+    const auto id = entity.Id().empty() ? GenerateUuid() : entity.Id();
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        BindColumns(id, entity, [&](const auto&... values) {
+            return ExecPrepared(tx, statements::match_record::Insert, values...);
+        });
+        tx.commit();
+        connection->committedWrite = true;
+        return id;
+    } catch (const std::exception& e) { return std::nullopt; }
+}
+
+// COPY de las columnas tal cual. Como Create y Save, respeta el id que trae el partido (así un
+// lote puede enlazar sus partidos con nextMatchId) y solo genera los que faltan: COPY no tiene
+// RETURNING, el id debe conocerse antes de enviar la fila
+std::vector<std::string> TypedMatchRepository::CreateMany(const std::vector<domain::Match>& entities) {
+    if (entities.empty()) return {};
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    std::vector<std::string> ids;
+    ids.reserve(entities.size());
+    try {
+        pqxx::work tx(*(connection->connection));
+        ExecCopy("copy_match_records_in", [&] {
+            auto stream = pqxx::stream_to::table(tx, {"match_records"},
+                {"id", "tournament_id", "group_id", "phase", "match_number", "team1_id", "team2_id",
+                 "team1_score", "team2_score", "status", "next_match_id"});
+            for (const auto& entity : entities) {
+                ids.push_back(entity.Id().empty() ? GenerateUuid() : entity.Id());
+                BindColumns(ids.back(), entity, [&](const auto&... values) { stream.write_values(values...); });
+            }
+            stream.complete();
+            return static_cast<uint64_t>(ids.size());
+        });
+        tx.commit();
+        connection->committedWrite = true;
+        return ids;
+    } catch (const std::exception& e) { return {}; }
+}
+
+std::shared_ptr<domain::Match> TypedMatchRepository::ReadById(std::string id) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::ReadById, id);
+        tx.commit();
+        if (result.empty()) return nullptr;
+        return std::make_shared<domain::Match>(Decode(result[0]));
+    } catch (const std::exception& e) { return nullptr; }
+}
+
+std::string TypedMatchRepository::Update(const domain::Match& entity) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        BindColumns(entity.Id(), entity, [&](const auto&... values) {
+            return ExecPrepared(tx, statements::match_record::Update, values...);
+        });
+        tx.commit();
+        connection->committedWrite = true;
+        return entity.Id();
+    } catch (const std::exception& e) { return ""; }
+}
+
+void TypedMatchRepository::Delete(std::string id) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        ExecPrepared(tx, statements::match_record::Delete, id);
+        tx.commit();
+        connection->committedWrite = true;
+    } catch (const std::exception& e) { /* Manejar error */ }
+}
+
+std::vector<std::shared_ptr<domain::Match>> TypedMatchRepository::ReadAll() {
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::ReadAll);
+        tx.commit();
+        return DecodeAll(result);
+    } catch (const std::exception& e) { return {}; }
+}
+
+std::vector<std::shared_ptr<domain::Match>> TypedMatchRepository::ReadPage(const PageRequest& page) {
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::ReadPage, page.AfterOrFirst(), page.limit);
+        tx.commit();
+        return DecodeAll(result);
+    } catch (const std::exception& e) { return {}; }
+}
+
+std::vector<std::shared_ptr<domain::Match>> TypedMatchRepository::FindByTournamentId(std::string tournamentId, const PageRequest& page) {
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::FindByTournamentId,
+                                                     tournamentId, page.AfterOrFirst(), page.limit);
+        tx.commit();
+        return DecodeAll(result);
+    } catch (const std::exception& e) { return {}; }
+}
+
+IMatchRepository::ArenaMatches TypedMatchRepository::FindByTournamentId(std::string tournamentId, const PageRequest& page, std::pmr::memory_resource* arena) {
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::FindByTournamentId,
+                                                     tournamentId, page.AfterOrFirst(), page.limit);
+        tx.commit();
+        return DecodeAll(result, arena);
+    } catch (const std::exception& e) { return ArenaMatches(arena); }
+}
+
+std::vector<std::shared_ptr<domain::Match>> TypedMatchRepository::FindByTournamentIdAndPhase(std::string tournamentId, domain::MatchPhase phase, const PageRequest& page) {
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::FindByTournamentIdAndPhase,
+                                                     tournamentId, domain::Match::PhaseToString(phase),
+                                                     page.AfterOrFirst(), page.limit);
+        tx.commit();
+        return DecodeAll(result);
+    } catch (const std::exception& e) { return {}; }
+}
+
+std::vector<std::shared_ptr<domain::Match>> TypedMatchRepository::FindByGroupId(std::string groupId, const PageRequest& page) {
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::FindByGroupId,
+                                                     groupId, page.AfterOrFirst(), page.limit);
+        tx.commit();
+        return DecodeAll(result);
+    } catch (const std::exception& e) { return {}; }
+}
+
+std::vector<std::shared_ptr<domain::Match>> TypedMatchRepository::FindByTeamId(std::string teamId, const PageRequest& page) {
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::FindByTeamId,
+                                                     teamId, page.AfterOrFirst(), page.limit);
+        tx.commit();
+        return DecodeAll(result);
+    } catch (const std::exception& e) { return {}; }
+}
+
+bool TypedMatchRepository::IsGroupStageComplete(std::string tournamentId) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::IsGroupStageComplete, tournamentId);
+        tx.commit();
+
+        if (result.empty()) return false;
+        auto total = result[0]["total"].as<int>(0);
+        auto completed = result[0]["completed"].as<int>(0);
+        return (total > 0) && (total == completed);
+    } catch (const std::exception& e) { return false; }
+}
+
+std::vector<std::string> TypedMatchRepository::FindGroupIdsByTournamentId(std::string tournamentId) {
+    std::vector<std::string> groupIds;
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::FindGroupIdsByTournamentId, tournamentId);
+        tx.commit();
+        groupIds.reserve(result.size());
+        for (const auto& row : result) {
+            groupIds.emplace_back(row[0].c_str());
+        }
+    } catch (const std::exception& e) { /* Manejar error */ }
+    return groupIds;
+}
+
+std::vector<MatchResult> TypedMatchRepository::FindCompletedResultsByGroupId(std::string groupId) {
+    std::vector<MatchResult> results;
+    auto pooled = connectionProvider->ReadConnection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = ExecPrepared(tx, statements::match_record::FindCompletedResultsByGroupId, groupId);
+        tx.commit();
+        results.reserve(result.size());
+        for (const auto& row : result) {
+            results.push_back(MatchResult::FromText(row[0].view(), row[1].view(), row[2].as<int>(), row[3].as<int>()));
+        }
+    } catch (const std::exception& e) { /* Manejar error */ }
+    return results;
+}
+
+// Un solo upsert con RETURNING de todas las columnas: inserta o reemplaza en una ida y vuelta
+domain::Match TypedMatchRepository::Save(const domain::Match& match) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = BindColumns(match.Id().empty() ? GenerateUuid() : match.Id(), match, [&](const auto&... values) {
+            return ExecPrepared(tx, statements::match_record::Upsert, values...);
+        });
+        tx.commit();
+        connection->committedWrite = true;
+        return Decode(result[0]);
+    } catch (const std::exception& e) {
+        throw std::runtime_error(std::string("No se pudo guardar el partido (TypedMatchRepository::Save): ") + e.what());
+    }
+}
+
+// Un upsert por partido, todos en el mismo lote: una ida y vuelta para el lote completo
+std::vector<domain::Match> TypedMatchRepository::SaveAll(const std::vector<domain::Match>& matches) {
+    if (matches.empty()) return {};
+    std::vector<domain::Match> saved = matches;
+    for (auto& match : saved) {
+        if (match.Id().empty()) {
+            match.Id() = GenerateUuid();
+        }
+    }
+
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        PipelinedTransaction tx(*(connection->connection));
+        for (const auto& match : saved) {
+            BindColumns(match.Id(), match, [&](const auto&... values) {
+                return tx.Execute(statements::match_record::Upsert, values...);
+            });
+        }
+        tx.Commit();
+        connection->committedWrite = true;
+    } catch (const std::exception& e) {
+        throw std::runtime_error(std::string("No se pudieron guardar los partidos (TypedMatchRepository::SaveAll): ") + e.what());
+    }
+    return saved;
+}
+
+// Igual que MatchRepository::UpdateById: [BEGIN + SELECT ... FOR UPDATE] y [UPDATE + COMMIT]
+std::shared_ptr<domain::Match> TypedMatchRepository::UpdateById(const std::string& id, const std::function<void(domain::Match&)>& modify) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+
+    try {
+        PrepareMatchRecords(*connection);
+        PipelinedTransaction tx(*(connection->connection));
+        const auto result = tx.Retrieve(tx.Execute(statements::match_record::ReadByIdForUpdate, id));
+        if (result.Empty()) return nullptr;
+
+        auto match = std::make_shared<domain::Match>(DecodeRow(result, 0));
+        modify(*match); // si lanza, el destructor de tx hace ROLLBACK y la excepción sigue su curso
+
+        BindColumns(id, *match, [&](const auto&... values) {
+            return tx.Execute(statements::match_record::Update, values...);
+        });
+        tx.Commit();
+        connection->committedWrite = true;
+        return match;
+    } catch (const pqxx::failure& e) {
+        throw std::runtime_error(std::string("No se pudo actualizar el partido (TypedMatchRepository::UpdateById): ") + e.what());
+    }
+}
+
+// Igual que MatchRepository::CreateLinked: [BEGIN + INSERT + UPDATE] y [COMMIT], comprobando que
+// el UPDATE encontró el partido antes de confirmar. La FK next_match_id es diferida, así que el
+// orden dentro del lote no importa.
+domain::Match TypedMatchRepository::CreateLinked(const domain::Match& nextMatch, const domain::Match& completedMatch) {
+    auto created = nextMatch;
+    created.Id() = GenerateUuid();
+    auto linked = completedMatch;
+    linked.SetNextMatchId(created.Id());
+
+    auto pooled = connectionProvider->Connection();
+    const auto connection = AsPostgres(pooled);
+    try {
+        PrepareMatchRecords(*connection);
+        PipelinedTransaction tx(*(connection->connection));
+        BindColumns(created.Id(), created, [&](const auto&... values) {
+            return tx.Execute(statements::match_record::Insert, values...);
+        });
+        const auto update = BindColumns(linked.Id(), linked, [&](const auto&... values) {
+            return tx.Execute(statements::match_record::Update, values...);
+        });
+        if (tx.Retrieve(update).AffectedRows() != 1) {
+            throw std::runtime_error("el partido " + linked.Id() + " no existe"); // el destructor de tx hace ROLLBACK
+        }
+        tx.Commit();
+        connection->committedWrite = true;
+    } catch (const std::exception& e) {
+        throw std::runtime_error(std::string("No se pudo crear el siguiente partido (TypedMatchRepository::CreateLinked): ") + e.what());
+    }
+    return created;
+}
+
+} // namespace repository
@@ -28,17 +28,23 @@ struct TeamStanding {
 std::vector<Match> SingleEliminationStrategy::GenerateGroupStageMatches(
     const std::vector<Group>& groups, const std::string& tournamentId) {
     
+    // Se construye cada partido en su lugar: copiarlo al vector duplicaba sus cuatro ids de texto
+    size_t matchCount = 0;
+    for (const auto& group : groups) {
+        const auto teamCount = group.Teams().size();
+        matchCount += teamCount * (teamCount - 1) / 2;
+    }
     std::vector<Match> matches;
+    matches.reserve(matchCount);
     int matchNumber = 1;
     for (const auto& group : groups) {
         const auto& teams = group.Teams();
         for (size_t i = 0; i < teams.size(); i++) {
             for (size_t j = i + 1; j < teams.size(); j++) {
-                Match match(tournamentId, MatchPhase::GROUP_STAGE, matchNumber++);
-                match.SetTeam1(teams[i].Id()); 
+                auto& match = matches.emplace_back(tournamentId, MatchPhase::GROUP_STAGE, matchNumber++);
+                match.SetTeam1(teams[i].Id());
                 match.SetTeam2(teams[j].Id());
                 match.SetGroupId(group.Id());
-                matches.push_back(match);
             }
         }
     }
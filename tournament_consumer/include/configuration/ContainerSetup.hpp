@@ -15,7 +15,9 @@
 #include "configuration/DatabaseConfiguration.hpp"
 #include "cms/ConnectionManager.hpp"
 #include "cms/QueueMessageConsumer.hpp"
+#include "persistence/configuration/MatchStorage.hpp"
 #include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
 #include "persistence/repository/IRepository.hpp"
 #include "persistence/repository/TeamRepository.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
@@ -24,6 +26,7 @@
 // 🆕 INCLUDES DE MATCHES
 #include "persistence/repository/IMatchRepository.hpp"
 #include "persistence/repository/MatchRepository.hpp"
+#include "persistence/repository/TypedMatchRepository.hpp"
 #include "service/MatchService.hpp"
 #include "handlers/MatchEventHandler.hpp"
 #include "delegate/MatchDelegate.hpp"
@@ -40,10 +43,11 @@ namespace config {
         // ====================================================================
         // BASE DE DATOS
         // ====================================================================
+        QueryStatistics::Instance().Configure(configuration["databaseConfig"].get<QueryStatisticsConfiguration>());
+
         std::shared_ptr<PostgresConnectionProvider> postgressConnection = 
             std::make_shared<PostgresConnectionProvider>(
-                configuration["databaseConfig"]["connectionString"].get<std::string>(), 
-                configuration["databaseConfig"]["poolSize"].get<size_t>()
+                configuration["databaseConfig"].get<ConnectionPoolConfiguration>()
             );
         builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
 
@@ -84,9 +88,17 @@ namespace config {
         // ====================================================================
         //
         // ====================================================================
-        builder.registerType<repository::MatchRepository>()
-            .as<repository::IMatchRepository>()
-            .singleInstance();
+        // MATCHES o MATCH_RECORDS (V005); el servicio REST lee el mismo valor de databaseConfig
+        const auto matchStorage = configuration["databaseConfig"].get<MatchStorageConfiguration>().storage;
+        if (matchStorage == MatchStorage::Typed) {
+            builder.registerType<repository::TypedMatchRepository>()
+                .as<repository::IMatchRepository>()
+                .singleInstance();
+        } else {
+            builder.registerType<repository::MatchRepository>()
+                .as<repository::IMatchRepository>()
+                .singleInstance();
+        }
 
         // ====================================================================
         //
@@ -19,14 +19,21 @@
 #include "controller/TeamController.hpp"
 #include "controller/TournamentController.hpp"
 #include "delegate/TournamentDelegate.hpp"
+#include "persistence/configuration/MatchStorage.hpp"
 #include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/ReplicatedConnectionProvider.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
 #include "persistence/repository/GroupRepository.hpp"
+#include "persistence/repository/CachingRepository.hpp"
+#include "persistence/cache/CacheMetricsRegistry.hpp"
+#include "persistence/cache/CacheInvalidationListener.hpp"
 #include "cms/QueueMessageProducer.hpp"
 #include "cms/QueueResolver.hpp"
 #include "delegate/IGroupDelegate.hpp"
 #include "delegate/GroupDelegate.hpp"
 #include "controller/GroupController.hpp"
+#include "controller/MetricsController.hpp"
 
 namespace config {
     inline std::shared_ptr<Hypodermic::Container> containerSetup() {
@@ -38,9 +45,21 @@ namespace config {
         std::shared_ptr<RunConfiguration> appConfig = std::make_shared<RunConfiguration>(configuration["runConfig"]);
         builder.registerInstance(appConfig);
 
-        std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(
-            configuration["databaseConfig"]["connectionString"].get<std::string>(),
-            configuration["databaseConfig"]["poolSize"].get<size_t>());
+        QueryStatistics::Instance().Configure(configuration["databaseConfig"].get<QueryStatisticsConfiguration>());
+
+        std::shared_ptr<IDbConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(
+            configuration["databaseConfig"].get<ConnectionPoolConfiguration>());
+
+        // Con réplicas declaradas, los listados y búsquedas se leen de ellas y el primario queda para las escrituras
+        const auto replicaRouting = configuration["databaseConfig"].get<ReplicaRoutingConfiguration>();
+        if (!replicaRouting.replicas.empty()) {
+            std::vector<std::shared_ptr<IDbConnectionProvider>> replicas;
+            for (const auto& replica : replicaRouting.replicas) {
+                replicas.push_back(std::make_shared<PostgresConnectionProvider>(replica));
+            }
+            postgressConnection = std::make_shared<ReplicatedConnectionProvider>(
+                postgressConnection, std::move(replicas), replicaRouting.readYourWritesWindow, replicaRouting.replicaRetryAfter);
+        }
         builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
 
         builder.registerType<ConnectionManager>()
@@ -56,11 +75,44 @@ namespace config {
         builder.registerType<QueueResolver>().as<IResolver<IQueueMessageProducer> >().named("queueResolver").
                 singleInstance();
 
-  
-        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string>>().singleInstance();
-        
-        builder.registerType<GroupRepository>().as<IRepository<domain::Group, std::string>>().singleInstance();
-        builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, std::string>>().singleInstance();
+        // Equipos y torneos se leen mucho más de lo que se escriben: ReadById pasa por un caché en memoria
+        std::shared_ptr<CacheMetricsRegistry> cacheMetrics = std::make_shared<CacheMetricsRegistry>();
+        builder.registerInstance(cacheMetrics);
+        const auto cacheConfiguration = [&configuration](const std::string& entity) {
+            return configuration.value("cacheConfig", nlohmann::json::object()).value(entity, nlohmann::json::object()).get<CacheConfiguration>();
+        };
+
+        auto teamRepository = std::make_shared<CachingRepository<domain::Team>>(
+            std::make_shared<TeamRepository>(postgressConnection), cacheConfiguration("teams"));
+        cacheMetrics->Register("teams", [teamRepository] { return teamRepository->Metrics(); });
+        builder.registerInstance(teamRepository).as<IRepository<domain::Team, std::string>>();
+
+        // GET /tournaments/<id>/full lee los partidos de la tabla en la que los escribe el consumer
+        const auto matchStorage = configuration["databaseConfig"].get<MatchStorageConfiguration>().storage;
+        auto tournamentStore = std::make_shared<TournamentRepository>(postgressConnection, matchStorage);
+        builder.registerInstance(tournamentStore).as<ITournamentRepository>();
+        auto tournamentRepository = std::make_shared<CachingRepository<domain::Tournament>>(
+            tournamentStore, cacheConfiguration("tournaments"));
+        cacheMetrics->Register("tournaments", [tournamentRepository] { return tournamentRepository->Metrics(); });
+        builder.registerInstance(tournamentRepository).as<IRepository<domain::Tournament, std::string>>();
+
+        // Las escrituras de las otras réplicas llegan por LISTEN/NOTIFY y desalojan la entidad aquí.
+        // Siempre contra el primario: las réplicas de streaming no reenvían NOTIFY.
+        std::shared_ptr<CacheInvalidationListener> cacheInvalidation = std::make_shared<CacheInvalidationListener>(
+            configuration["databaseConfig"]["connectionString"].get<std::string>());
+        cacheInvalidation->Subscribe("teams", {
+            [teamRepository](const std::string& id) { teamRepository->Evict(id); },
+            [teamRepository] { teamRepository->Clear(); }});
+        cacheInvalidation->Subscribe("tournaments", {
+            [tournamentRepository](const std::string& id) { tournamentRepository->Evict(id); },
+            [tournamentRepository] { tournamentRepository->Clear(); }});
+        cacheInvalidation->Start();
+        builder.registerInstance(cacheInvalidation);
+
+        builder.registerType<GroupRepository>()
+            .as<IRepository<domain::Group, std::string>>()
+            .as<IGroupRepository>()
+            .singleInstance();
 
         builder.registerType<TeamDelegate>().as<ITeamDelegate>().singleInstance();
         builder.registerType<TeamController>().singleInstance();
@@ -73,6 +125,8 @@ namespace config {
         builder.registerType<GroupDelegate>().as<IGroupDelegate>().singleInstance();
         builder.registerType<GroupController>().singleInstance();
 
+        builder.registerType<MetricsController>().singleInstance();
+
         return builder.build();
     }
 }
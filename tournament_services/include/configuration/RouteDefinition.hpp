@@ -9,8 +9,12 @@
 #include <Hypodermic/Container.h>
 #include <vector>
 #include <functional>
+#include <exception>
 #include <string>
 
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/ReadYourWritesSession.hpp"
+
 // Route definition storage
 struct RouteDefinition {
     std::string path;
@@ -43,6 +47,72 @@ auto invokeController(Controller* controller, Method method, const crow::request
 
 }
 
+template<typename Controller, typename Method, typename... Args>
+void invokeAsyncController(Controller* controller, Method method, const crow::request& request, crow::response& response, Args&&... args) {
+    if constexpr(std::is_invocable_v<Method, Controller*, const crow::request&, crow::response&, Args...>) {
+        (controller->*method)(request, response, std::forward<Args>(args)...);
+    }
+    else {
+        (controller->*method)(response, std::forward<Args>(args)...);
+    }
+}
+
+// Pool de conexiones agotado: se responde 503 para que el cliente reintente
+inline crow::response databaseUnavailableResponse() {
+    crow::response response(crow::SERVICE_UNAVAILABLE, "{\"error\":\"Database connection pool exhausted\"}");
+    response.add_header("Content-Type", "application/json");
+    response.add_header("Retry-After", "1");
+    return response;
+}
+
+// Error entregado a un callback asíncrono: mismo criterio que REGISTER_ROUTE
+inline crow::response asyncErrorResponse(const std::exception_ptr& error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (const ConnectionAcquireTimeout&) {
+        return databaseUnavailableResponse();
+    } catch (...) {
+        return crow::response(crow::INTERNAL_SERVER_ERROR);
+    }
+}
+
+// Termina una respuesta asíncrona en el hilo de Crow dueño de la conexión: crow::response no es
+// thread-safe y end() escribe en el socket, así que un resultado que llega en otro hilo (el
+// reactor de AsyncQueryExecutor) se pasa al io_context de la conexión con request.dispatch. Si
+// ya se está en ese hilo (p. ej. un acierto de caché) se termina en el acto, igual que cuando la
+// petición no viene de Crow (sin io_context, como en las pruebas).
+template<typename Fill>
+void endOnConnectionThread(const crow::request& request, crow::response& response, Fill fill) {
+    auto end = [&response, fill = std::move(fill)]() mutable {
+        fill(response);
+        response.end();
+    };
+    if (request.io_context == nullptr) {
+        end();
+        return;
+    }
+    // Crow entrega la petición como const, pero dispatch no lo es; el objeto (de la conexión) no es const
+    const_cast<crow::request&>(request).dispatch(std::move(end));
+}
+
+// Token de read-your-writes: la respuesta de una petición que escribió lo trae, y el cliente lo
+// reenvía para que sus lecturas siguientes vayan al primario mientras dure la ventana
+inline constexpr auto ReadYourWritesHeader = "X-Read-Your-Writes";
+
+// Atiende la petición con su ReadYourWritesSession instalada en el hilo
+template<typename Handler>
+crow::response withReadYourWritesSession(const crow::request& request, Handler handler) {
+    auto session = ReadYourWritesSession::FromToken(request.get_header_value(ReadYourWritesHeader));
+    crow::response response = [&] {
+        ReadYourWritesScope scope(session);
+        return crow::response(handler());
+    }();
+    if (session.Wrote()) {
+        response.set_header(ReadYourWritesHeader, session.Token());
+    }
+    return response;
+}
+
 // Annotation-style macro
 #define REGISTER_ROUTE(Controller, Method, Path, HttpMethod) \
 struct Controller## _##Method##_RouteRegistrator { \
@@ -50,9 +120,43 @@ struct Controller## _##Method##_RouteRegistrator { \
         routeRegistry().push_back({ Path, HttpMethod, \
             [](crow::SimpleApp& app, std::shared_ptr<Hypodermic::Container> container) { \
                     CROW_ROUTE(app, Path).methods(HttpMethod)( \
-                        [container](const crow::request& request ,auto&&... args) { \
-                        auto controller = container->resolve<Controller>(); \
-                        return invokeController(controller.get(), &Controller::Method, request, std::forward<decltype(args)>(args)...); \
+                        [container](const crow::request& request ,auto&&... args) -> crow::response { \
+                        try { \
+                            auto controller = container->resolve<Controller>(); \
+                            return withReadYourWritesSession(request, [&] { \
+                                return invokeController(controller.get(), &Controller::Method, request, std::forward<decltype(args)>(args)...); \
+                            }); \
+                        } catch (const ConnectionAcquireTimeout&) { \
+                            return databaseUnavailableResponse(); \
+                        } \
+                    } \
+                ); \
+            } \
+        }); \
+    } \
+}; \
+static Controller##_##Method##_RouteRegistrator global_##Controller##_##Method##_registrator;
+
+// Igual que REGISTER_ROUTE, pero el método del controlador recibe la crow::request y la
+// crow::response, y la termina con endOnConnectionThread cuando llega el resultado. El hilo de
+// Crow queda libre en cuanto el controlador encola la consulta. Por ahora solo GET /teams/<id> y
+// GET /tournaments/<id> la usan; las demás rutas siguen bloqueando el hilo en el pool.
+#define REGISTER_ASYNC_ROUTE(Controller, Method, Path, HttpMethod) \
+struct Controller## _##Method##_RouteRegistrator { \
+    Controller##_##Method##_RouteRegistrator() { \
+        routeRegistry().push_back({ Path, HttpMethod, \
+            [](crow::SimpleApp& app, std::shared_ptr<Hypodermic::Container> container) { \
+                    CROW_ROUTE(app, Path).methods(HttpMethod)( \
+                        [container](const crow::request& request, crow::response& response, auto&&... args) { \
+                        try { \
+                            auto controller = container->resolve<Controller>(); \
+                            auto session = ReadYourWritesSession::FromToken(request.get_header_value(ReadYourWritesHeader)); \
+                            ReadYourWritesScope scope(session); \
+                            invokeAsyncController(controller.get(), &Controller::Method, request, response, std::forward<decltype(args)>(args)...); \
+                        } catch (const ConnectionAcquireTimeout&) { \
+                            response = databaseUnavailableResponse(); \
+                            response.end(); \
+                        } \
                     } \
                 ); \
             } \
@@ -12,9 +12,10 @@ public:
     explicit GroupController(const std::shared_ptr<IGroupDelegate>& delegate);
 
     crow::response CreateGroup(const crow::request& request, const std::string& tournamentId) const;
-    crow::response GetGroups(const std::string& tournamentId) const;
+    crow::response GetGroups(const crow::request& request, const std::string& tournamentId) const;
     crow::response GetGroup(const std::string& tournamentId, const std::string& groupId) const;
     crow::response UpdateGroup(const crow::request& request, const std::string& tournamentId, const std::string& groupId) const;
+    crow::response AddTeams(const crow::request& request, const std::string& tournamentId, const std::string& groupId) const;
     crow::response DeleteGroup(const std::string& tournamentId, const std::string& groupId) const;
 };
 
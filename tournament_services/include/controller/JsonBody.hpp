@@ -0,0 +1,19 @@
+#ifndef RESTAPI_JSONBODY_HPP
+#define RESTAPI_JSONBODY_HPP
+
+#include "crow.h"
+#include "domain/JsonReader.hpp"
+
+// Cuerpos de petición leídos una sola vez con domain::json_reader (sin json::accept previo)
+namespace json_body {
+
+    // Mismas respuestas que daban json::accept ("Invalid JSON format") y from_json ("JSON parsing error")
+    inline crow::response BadRequest(domain::json_reader::ReadError error) {
+        if (error == domain::json_reader::ReadError::InvalidJson) {
+            return crow::response{crow::BAD_REQUEST, "{\"error\":\"Invalid JSON format\"}"};
+        }
+        return crow::response{crow::BAD_REQUEST, "{\"error\":\"JSON parsing error\"}"};
+    }
+}
+
+#endif //RESTAPI_JSONBODY_HPP
@@ -24,6 +24,7 @@ public:
     explicit MatchController(std::shared_ptr<service::MatchService> service);
     
     // --- Endpoints del CRUD ---
+    // Los listados aceptan ?limit=N&after=<cursor> (ver controller/Pagination.hpp)
 
     // POST /matches/{id}/score - Registrar puntaje
     crow::response RegisterScore(const crow::request& req, const std::string& matchId) const;
@@ -32,16 +33,16 @@ public:
     crow::response GetMatchById(const std::string& matchId) const;
 
     // GET /tournaments/{id}/matches - Obtener partidos de un torneo
-    crow::response GetMatchesByTournament(const std::string& tournamentId) const;
+    crow::response GetMatchesByTournament(const crow::request& req, const std::string& tournamentId) const;
 
     // GET /tournaments/{id}/matches/phase/{phase} - Obtener partidos por fase
-    crow::response GetMatchesByPhase(const std::string& tournamentId, const std::string& phase) const;
+    crow::response GetMatchesByPhase(const crow::request& req, const std::string& tournamentId, const std::string& phase) const;
 
     // GET /groups/{id}/matches - Obtener partidos de un grupo
-    crow::response GetMatchesByGroup(const std::string& groupId) const;
+    crow::response GetMatchesByGroup(const crow::request& req, const std::string& groupId) const;
 
     // GET /teams/{id}/matches - Obtener partidos de un equipo
-    crow::response GetMatchesByTeam(const std::string& teamId) const;
+    crow::response GetMatchesByTeam(const crow::request& req, const std::string& teamId) const;
     
     // POST /api/matches - Crear un partido (Uso administrativo/interno)
     crow::response CreateMatch(const crow::request& req) const;
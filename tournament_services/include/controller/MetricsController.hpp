@@ -0,0 +1,19 @@
+#ifndef TOURNAMENTS_METRICSCONTROLLER_HPP
+#define TOURNAMENTS_METRICSCONTROLLER_HPP
+
+#include <memory>
+#include "crow.h"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/cache/CacheMetricsRegistry.hpp"
+
+// Expone los contadores internos del servicio (pool de conexiones, cachés, latencia por sentencia, etc.)
+class MetricsController {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    std::shared_ptr<CacheMetricsRegistry> cacheMetrics;
+public:
+    MetricsController(std::shared_ptr<IDbConnectionProvider> provider, std::shared_ptr<CacheMetricsRegistry> cacheMetrics);
+
+    crow::response GetMetrics() const;
+};
+
+#endif //TOURNAMENTS_METRICSCONTROLLER_HPP
@@ -0,0 +1,133 @@
+#ifndef RESTAPI_PAGINATION_HPP
+#define RESTAPI_PAGINATION_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "crow.h"
+#include "persistence/repository/PageRequest.hpp"
+#include "domain/Uuid.hpp"
+
+// Paginación por cursor para las rutas de listado: ?limit=N&after=<cursor>.
+// El cursor es el último id de la página codificado en base64url, opaco para el cliente.
+// La siguiente página se anuncia en el header Link (rel="next").
+namespace pagination {
+    inline constexpr size_t DefaultLimit = 50;
+    inline constexpr size_t MaxLimit = 500;
+
+    inline constexpr std::string_view Base64UrlAlphabet =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+    inline std::string EncodeCursor(std::string_view id) {
+        std::string cursor;
+        cursor.reserve((id.size() * 4 + 2) / 3);
+        uint32_t buffer = 0;
+        int bits = 0;
+        for (const unsigned char c : id) {
+            buffer = (buffer << 8) | c;
+            bits += 8;
+            while (bits >= 6) {
+                bits -= 6;
+                cursor.push_back(Base64UrlAlphabet[(buffer >> bits) & 0x3F]);
+            }
+        }
+        if (bits > 0) {
+            cursor.push_back(Base64UrlAlphabet[(buffer << (6 - bits)) & 0x3F]);
+        }
+        return cursor;
+    }
+
+    // Mismo criterio que domain::Uuid, que es como lo leen los repositorios
+    inline bool IsUuid(std::string_view value) {
+        return domain::Uuid::Parse(value).has_value();
+    }
+
+    // nullopt si el cursor no es base64url válido o no contiene un id
+    inline std::optional<std::string> DecodeCursor(std::string_view cursor) {
+        std::string id;
+        uint32_t buffer = 0;
+        int bits = 0;
+        for (const char c : cursor) {
+            const auto value = Base64UrlAlphabet.find(c);
+            if (value == std::string_view::npos) return std::nullopt;
+            buffer = (buffer << 6) | static_cast<uint32_t>(value);
+            bits += 6;
+            if (bits >= 8) {
+                bits -= 8;
+                id.push_back(static_cast<char>((buffer >> bits) & 0xFF));
+            }
+        }
+        if (!IsUuid(id)) return std::nullopt;
+        return id;
+    }
+
+    // nullopt si la petición no pide paginación (ni limit ni after): se conserva el listado completo
+    inline std::expected<std::optional<PageRequest>, std::string> ParsePageRequest(const crow::request& request) {
+        const char* limitParam = request.url_params.get("limit");
+        const char* afterParam = request.url_params.get("after");
+        if (limitParam == nullptr && afterParam == nullptr) {
+            return std::nullopt;
+        }
+
+        PageRequest page{.limit = DefaultLimit};
+        if (limitParam != nullptr) {
+            const std::string_view text(limitParam);
+            size_t limit = 0;
+            const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), limit);
+            if (error != std::errc{} || end != text.data() + text.size() || limit == 0) {
+                return std::unexpected("Invalid limit");
+            }
+            page.limit = std::min(limit, MaxLimit);
+        }
+        if (afterParam != nullptr) {
+            page.after = DecodeCursor(afterParam);
+            if (!page.after) {
+                return std::unexpected("Invalid cursor");
+            }
+        }
+        return page;
+    }
+
+    // Para los listados de tablas que crecen sin límite (equipos, torneos): sin limit ni after se
+    // sirve la primera página de DefaultLimit con su Link, así la respuesta nunca crece con la tabla
+    inline std::expected<PageRequest, std::string> ParseBoundedPageRequest(const crow::request& request) {
+        auto page = ParsePageRequest(request);
+        if (!page) {
+            return std::unexpected(page.error());
+        }
+        return page->value_or(PageRequest{.limit = DefaultLimit});
+    }
+
+    // Se pide una fila de más para saber si hay otra página sin hacer un COUNT
+    inline PageRequest WithLookahead(const PageRequest& page) {
+        return PageRequest{page.after, *page.limit + 1};
+    }
+
+    inline std::string IdOf(const auto& item) { return item.Id(); }
+    template<typename T>
+    std::string IdOf(const std::shared_ptr<T>& item) { return item->Id(); }
+
+    // Descarta la fila de más y, si existía, agrega el enlace a la siguiente página
+    template<typename T, typename Allocator>
+    void ApplyPage(crow::response& response, const crow::request& request, const PageRequest& page, std::vector<T, Allocator>& items) {
+        if (items.size() <= *page.limit) {
+            return;
+        }
+        items.resize(*page.limit);
+        const auto next = request.url + "?limit=" + std::to_string(*page.limit) + "&after=" + EncodeCursor(IdOf(items.back()));
+        response.add_header("Link", "<" + next + ">; rel=\"next\"");
+    }
+
+    inline crow::response BadRequest(const std::string& error) {
+        return crow::response{crow::BAD_REQUEST, "{\"error\":\"" + error + "\"}"};
+    }
+}
+
+#endif //RESTAPI_PAGINATION_HPP
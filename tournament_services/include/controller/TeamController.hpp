@@ -1,6 +1,7 @@
 #ifndef RESTAPI_TEAMCONTROLLER_HPP
 #define RESTAPI_TEAMCONTROLLER_HPP
 
+#include "controller/JsonBody.hpp"
 #include "delegate/ITeamDelegate.hpp"
 #include "domain/Team.hpp"
 #include <nlohmann/json.hpp>
@@ -13,32 +14,28 @@ class TeamController {
 public:
     explicit TeamController(const std::shared_ptr<ITeamDelegate>& delegate);
 
-    crow::response getTeam(const std::string& teamId) const;
-    crow::response getAllTeams() const;
+    // Asíncrono: termina la respuesta en el hilo de la conexión cuando el delegate entrega el equipo
+    void getTeam(const crow::request& request, crow::response& response, const std::string& teamId) const;
+    crow::response getAllTeams(const crow::request& request) const;
     crow::response UpdateTeam(const crow::request& request, const std::string& id) const;
     crow::response DeleteTeam(const std::string& id) const;
+    crow::response ImportTeams(const crow::request& request) const;
 
     // La implementación de SaveTeam vive aquí como 'inline'
     inline crow::response SaveTeam(const crow::request& request) const {
-        if (!nlohmann::json::accept(request.body)) {
-            return crow::response{crow::BAD_REQUEST, "{\"error\":\"Invalid JSON format\"}"};
+        domain::Team team;
+        if (const auto read = domain::json_reader::Read(request.body, team); !read) {
+            return json_body::BadRequest(read.error());
         }
-        try {
-            auto requestBody = nlohmann::json::parse(request.body);
-            domain::Team team;
-            from_json(requestBody, team);
 
-            auto result = teamDelegate->SaveTeam(team);
+        auto result = teamDelegate->SaveTeam(team);
 
-            if (result) {
-                crow::response response(crow::CREATED);
-                response.add_header("Location", result.value());
-                return response;
-            } else {
-                return crow::response{crow::CONFLICT, "{\"error\":\"Team already exists\"}"};
-            }
-        } catch (const nlohmann::json::exception& e) {
-            return crow::response{crow::BAD_REQUEST, "{\"error\":\"JSON parsing error\"}"};
+        if (result) {
+            crow::response response(crow::CREATED);
+            response.add_header("Location", result.value());
+            return response;
+        } else {
+            return crow::response{crow::CONFLICT, "{\"error\":\"Team already exists\"}"};
         }
     }
 };
@@ -13,9 +13,12 @@ public:
 
     // Métodos existentes
     crow::response CreateTournament(const crow::request& request) const;
-    crow::response ReadAll() const;
+    crow::response ReadAll(const crow::request& request) const;
 
-    crow::response GetTournament(const std::string& id) const;
+    // Asíncrono: termina la respuesta en el hilo de la conexión cuando el delegate entrega el torneo
+    void GetTournament(const crow::request& request, crow::response& response, const std::string& id) const;
+    // Torneo con grupos, equipos y partidos: una sola consulta en lugar de una llamada por recurso
+    crow::response GetTournamentAggregate(const std::string& id) const;
     crow::response UpdateTournament(const crow::request& request, const std::string& id) const;
     crow::response DeleteTournament(const std::string& id) const;
 };
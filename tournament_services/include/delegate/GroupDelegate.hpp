@@ -1,6 +1,7 @@
 #ifndef SERVICE_GROUP_DELEGATE_HPP
 #define SERVICE_GROUP_DELEGATE_HPP
 
+#include <algorithm>
 #include <string>
 #include <string_view>
 #include <memory>
@@ -15,22 +16,26 @@
 #include "domain/Group.hpp"
 #include "domain/Tournament.hpp" 
 #include "domain/Team.hpp"
+#include "domain/Uuid.hpp"
+#include "events/Events.hpp"
 
 class GroupDelegate : public IGroupDelegate{
     std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepository;
-    std::shared_ptr<IRepository<domain::Group, std::string>> groupRepository;
+    std::shared_ptr<IGroupRepository> groupRepository;
     std::shared_ptr<IRepository<domain::Team, std::string>> teamRepository;
 
 public:
    GroupDelegate(
         const std::shared_ptr<IRepository<domain::Tournament, std::string>>& tournamentRepo,
-        const std::shared_ptr<IRepository<domain::Group, std::string>>& groupRepo,
+        const std::shared_ptr<IGroupRepository>& groupRepo,
         const std::shared_ptr<IRepository<domain::Team, std::string>>& teamRepo);
 
     std::expected<std::string, std::string> CreateGroup(const std::string_view& tournamentId, const domain::Group& group) override;
     std::expected<std::vector<domain::Group>, std::string> GetGroups(const std::string_view& tournamentId) override;
+    std::expected<std::vector<domain::Group>, std::string> GetGroupsPage(const std::string_view& tournamentId, const PageRequest& page) override;
     std::expected<domain::Group, std::string> GetGroup(const std::string_view& tournamentId, const std::string_view& groupId) override;
     std::expected<void, std::string> UpdateGroup(const std::string_view& tournamentId, const domain::Group& group) override;
+    std::expected<void, AddTeamsError> AddTeams(const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<std::string>& teamIds) override;
     std::expected<void, std::string> RemoveGroup(const std::string_view& tournamentId, const std::string_view& groupId) override;
 };
 
@@ -38,25 +43,34 @@ public:
 
 inline GroupDelegate::GroupDelegate(
     const std::shared_ptr<IRepository<domain::Tournament, std::string>>& tournamentRepo,
-    const std::shared_ptr<IRepository<domain::Group, std::string>>& groupRepo,
+    const std::shared_ptr<IGroupRepository>& groupRepo,
     const std::shared_ptr<IRepository<domain::Team, std::string>>& teamRepo)
     : tournamentRepository(tournamentRepo), groupRepository(groupRepo), teamRepository(teamRepo) {}
     
 inline std::expected<std::string, std::string> GroupDelegate::CreateGroup(const std::string_view& tournamentId, const domain::Group& group) {
     // **Lógica de negocio: Verificar que el torneo exista**
-    auto tournament = tournamentRepository->ReadById(tournamentId.data());
-    if (tournament == nullptr) {
+    if (!tournamentRepository->Exists(std::string(tournamentId))) {
         return std::unexpected("Tournament not found");
     }
 
     domain::Group g = group;
-    g.TournamentId() = tournament->Id();
+    g.TournamentId() = std::string(tournamentId);
 
-    // Lógica opcional: validar que los equipos existan si se proporcionan
+    // Lógica opcional: validar que los equipos existan si se proporcionan (una sola consulta)
     if (!g.Teams().empty()) {
-        for (auto& t : g.Teams()) {
-            if (teamRepository->ReadById(t.Id()) == nullptr) {
-                return std::unexpected("Team with id " + t.Id() + " not found");
+        std::vector<std::string> teamIds;
+        teamIds.reserve(g.Teams().size());
+        for (const auto& t : g.Teams()) {
+            // se informa el id mal formado en lugar de dejar que la consulta falle para todos
+            if (!domain::Uuid::Parse(t.Id())) {
+                return std::unexpected("Invalid team id " + t.Id());
+            }
+            teamIds.push_back(t.Id());
+        }
+        const auto found = teamRepository->ReadByIds(teamIds);
+        for (const auto& teamId : teamIds) {
+            if (std::none_of(found.begin(), found.end(), [&teamId](const auto& team) { return team->Id() == teamId; })) {
+                return std::unexpected("Team with id " + teamId + " not found");
             }
         }
     }
@@ -71,13 +85,17 @@ inline std::expected<std::string, std::string> GroupDelegate::CreateGroup(const
 }
 
 inline std::expected<std::vector<domain::Group>, std::string> GroupDelegate::GetGroups(const std::string_view& tournamentId) {
-    auto allGroupsPtrs = groupRepository->ReadAll();
     std::vector<domain::Group> tournamentGroups;
+    for (const auto& groupPtr : groupRepository->FindByTournamentId(std::string(tournamentId))) {
+        tournamentGroups.push_back(*groupPtr);
+    }
+    return tournamentGroups;
+}
 
-    for (const auto& groupPtr : allGroupsPtrs) {
-        if (groupPtr != nullptr && groupPtr->TournamentId() == tournamentId) {
-            tournamentGroups.push_back(*groupPtr);
-        }
+inline std::expected<std::vector<domain::Group>, std::string> GroupDelegate::GetGroupsPage(const std::string_view& tournamentId, const PageRequest& page) {
+    std::vector<domain::Group> tournamentGroups;
+    for (const auto& groupPtr : groupRepository->ReadPageByTournamentId(std::string(tournamentId), page)) {
+        tournamentGroups.push_back(*groupPtr);
     }
     return tournamentGroups;
 }
@@ -93,9 +111,9 @@ inline std::expected<domain::Group, std::string> GroupDelegate::GetGroup(const s
 }
 
 inline std::expected<void, std::string> GroupDelegate::UpdateGroup(const std::string_view& tournamentId, const domain::Group& group) {
-    auto existingGroup = groupRepository->ReadById(group.Id());
-    
-    if (existingGroup == nullptr || existingGroup->TournamentId() != tournamentId) {
+    auto existingTournamentId = groupRepository->FindTournamentIdById(group.Id());
+
+    if (!existingTournamentId || *existingTournamentId != tournamentId) {
         return std::unexpected("Group not found in this tournament");
     }
 
@@ -103,10 +121,39 @@ inline std::expected<void, std::string> GroupDelegate::UpdateGroup(const std::st
     return {};
 }
 
+inline std::expected<void, IGroupDelegate::AddTeamsError> GroupDelegate::AddTeams(const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<std::string>& teamIds) {
+    const std::string tournament(tournamentId);
+    const std::string group(groupId);
+
+    // Una sola transacción para el lote: la BD valida grupo, equipos, repetidos y cupo
+    auto registration = groupRepository->AddTeams(tournament, group, teamIds, domain::Group::DefaultMaxTeams);
+    if (!registration) {
+        return std::unexpected(AddTeamsError::Unknown);
+    }
+    switch (registration->status) {
+        case TeamRegistration::Registered:
+            break;
+        case TeamRegistration::GroupNotFound:
+            return std::unexpected(AddTeamsError::GroupNotFound);
+        case TeamRegistration::TeamNotFound:
+            return std::unexpected(AddTeamsError::TeamNotFound);
+        case TeamRegistration::AlreadyRegistered:
+            return std::unexpected(AddTeamsError::AlreadyRegistered);
+        case TeamRegistration::GroupFull:
+            return std::unexpected(AddTeamsError::GroupFull);
+    }
+
+    // los eventos salen después del COMMIT, cuando el lote ya está guardado
+    for (const auto& teamId : teamIds) {
+        events::EventBus::Instance()->Publish(events::TeamRegisteredToGroupEvent(tournament, group, teamId));
+    }
+    return {};
+}
+
 inline std::expected<void, std::string> GroupDelegate::RemoveGroup(const std::string_view& tournamentId, const std::string_view& groupId) {
-    auto existingGroup = groupRepository->ReadById(std::string(groupId));
-    
-    if (existingGroup == nullptr || existingGroup->TournamentId() != tournamentId) {
+    auto existingTournamentId = groupRepository->FindTournamentIdById(std::string(groupId));
+
+    if (!existingTournamentId || *existingTournamentId != tournamentId) {
         return std::unexpected("Group not found in this tournament");
     }
 
@@ -7,14 +7,21 @@
 #include <expected>
 
 #include "domain/Group.hpp"
+#include "persistence/repository/PageRequest.hpp"
 
 class IGroupDelegate{
 public:
+    // Por qué no se inscribió el lote (ninguno de sus equipos queda inscrito)
+    enum class AddTeamsError { GroupNotFound, TeamNotFound, AlreadyRegistered, GroupFull, Unknown };
+
     virtual ~IGroupDelegate() = default;
     virtual std::expected<std::string, std::string> CreateGroup(const std::string_view& tournamentId, const domain::Group& group) = 0;
     virtual std::expected<std::vector<domain::Group>, std::string> GetGroups(const std::string_view& tournamentId) = 0;
+    virtual std::expected<std::vector<domain::Group>, std::string> GetGroupsPage(const std::string_view& tournamentId, const PageRequest& page) = 0;
     virtual std::expected<domain::Group, std::string> GetGroup(const std::string_view& tournamentId, const std::string_view& groupId) = 0;
     virtual std::expected<void, std::string> UpdateGroup(const std::string_view& tournamentId, const domain::Group& group) = 0;
+    // Inscribe todos los equipos o ninguno
+    virtual std::expected<void, AddTeamsError> AddTeams(const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<std::string>& teamIds) = 0;
     virtual std::expected<void, std::string> RemoveGroup(const std::string_view& tournamentId, const std::string_view& groupId) = 0;
 };
 
@@ -5,8 +5,12 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <span>
 #include <expected>
+#include <functional>
+#include <exception>
 #include "domain/Team.hpp"
+#include "persistence/repository/PageRequest.hpp"
 
 class ITeamDelegate {
 public:
@@ -18,9 +22,27 @@ public:
     // Métodos existentes
     virtual std::expected<std::string, SaveError> SaveTeam(const domain::Team& team) = 0;
     virtual std::shared_ptr<domain::Team> GetTeam(std::string_view id) = 0;
+    // GetTeam sin bloquear el hilo de Crow; el callback puede llegar desde el reactor de la BD.
+    // La implementación por defecto responde en el acto con GetTeam.
+    using TeamCallback = std::function<void(std::expected<std::shared_ptr<domain::Team>, std::exception_ptr>)>;
+    virtual void GetTeamAsync(std::string_view id, TeamCallback callback) {
+        std::expected<std::shared_ptr<domain::Team>, std::exception_ptr> team;
+        try {
+            team = GetTeam(id);
+        } catch (...) {
+            team = std::unexpected(std::current_exception());
+        }
+        callback(std::move(team));
+    }
+    // Varios equipos en una sola consulta, en el orden de ids; los inexistentes se omiten
+    virtual std::vector<std::shared_ptr<domain::Team>> GetTeams(std::span<const std::string> ids) = 0;
     virtual std::vector<std::shared_ptr<domain::Team>> GetAllTeams() = 0;
+    virtual std::vector<std::shared_ptr<domain::Team>> GetTeamsPage(const PageRequest& page) = 0;
     virtual std::expected<void, SaveError> UpdateTeam(std::string_view id, const domain::Team& team) = 0;
     virtual std::expected<void, SaveError> DeleteTeam(std::string_view id) = 0;
+
+    // Importación masiva: devuelve los ids creados en el mismo orden que los equipos recibidos
+    virtual std::expected<std::vector<std::string>, SaveError> ImportTeams(const std::vector<domain::Team>& teams) = 0;
 };
 
 #endif //RESTAPI_ITEAMDELEGATE_HPP 
\ No newline at end of file
@@ -6,7 +6,10 @@
 #include <string_view>
 #include <vector>
 #include <expected>
+#include <functional>
+#include <exception>
 #include "domain/Tournament.hpp"
+#include "persistence/repository/PageRequest.hpp"
 
 class ITournamentDelegate {
 public:
@@ -16,7 +19,21 @@ public:
     
     virtual std::expected<std::string, SaveError> CreateTournament(std::shared_ptr<domain::Tournament> tournament) = 0;
     virtual std::shared_ptr<domain::Tournament> GetTournament(std::string_view id) = 0;
+    // GetTournament sin bloquear el hilo de Crow (ver ITeamDelegate::GetTeamAsync)
+    using TournamentCallback = std::function<void(std::expected<std::shared_ptr<domain::Tournament>, std::exception_ptr>)>;
+    virtual void GetTournamentAsync(std::string_view id, TournamentCallback callback) {
+        std::expected<std::shared_ptr<domain::Tournament>, std::exception_ptr> tournament;
+        try {
+            tournament = GetTournament(id);
+        } catch (...) {
+            tournament = std::unexpected(std::current_exception());
+        }
+        callback(std::move(tournament));
+    }
+    // Torneo con grupos, equipos y partidos en una sola consulta; nullptr si no existe
+    virtual std::shared_ptr<domain::Tournament> GetTournamentAggregate(std::string_view id) = 0;
     virtual std::vector<std::shared_ptr<domain::Tournament>> GetAllTournaments() = 0;
+    virtual std::vector<std::shared_ptr<domain::Tournament>> GetTournamentsPage(const PageRequest& page) = 0;
     virtual std::expected<void, SaveError> UpdateTournament(std::string_view id, const domain::Tournament& tournament) = 0;
     virtual std::expected<void, SaveError> DeleteTournament(std::string_view id) = 0;
 };
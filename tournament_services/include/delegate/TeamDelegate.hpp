@@ -16,9 +16,13 @@ public:
 
     std::expected<std::string, SaveError> SaveTeam(const domain::Team& team) override;
     std::shared_ptr<domain::Team> GetTeam(std::string_view id) override;
+    void GetTeamAsync(std::string_view id, TeamCallback callback) override;
+    std::vector<std::shared_ptr<domain::Team>> GetTeams(std::span<const std::string> ids) override;
     std::vector<std::shared_ptr<domain::Team>> GetAllTeams() override;
+    std::vector<std::shared_ptr<domain::Team>> GetTeamsPage(const PageRequest& page) override;
     std::expected<void, SaveError> UpdateTeam(std::string_view id, const domain::Team& team) override;
     std::expected<void, SaveError> DeleteTeam(std::string_view id) override;
+    std::expected<std::vector<std::string>, SaveError> ImportTeams(const std::vector<domain::Team>& teams) override;
 };
 
 #endif // RESTAPI_TEAMDELEGATE_HPP
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "delegate/ITournamentDelegate.hpp"
 #include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITournamentRepository.hpp"
 #include "cms/IQueueMessageProducer.hpp" // Usar la interfaz
 #include <memory>
 
@@ -15,19 +16,25 @@ class TournamentDelegate : public ITournamentDelegate {
     // Miembros de la clase
     std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepository;
     std::shared_ptr<IQueueMessageProducer> producer; // Usar la interfaz
+    // Sin caché: el agregado cambia con cada grupo y partido, no solo con el torneo
+    std::shared_ptr<ITournamentRepository> aggregateRepository;
 
 public:
     // Declaración del constructor
     explicit TournamentDelegate(
         std::shared_ptr<IRepository<domain::Tournament, std::string>> repository, 
-        std::shared_ptr<IQueueMessageProducer> producer
+        std::shared_ptr<IQueueMessageProducer> producer,
+        std::shared_ptr<ITournamentRepository> aggregateRepository
     );
     ~TournamentDelegate() override = default;
 
     // Declaraciones de los métodos del CRUD
     std::expected<std::string, SaveError> CreateTournament(std::shared_ptr<domain::Tournament> tournament) override;
     std::shared_ptr<domain::Tournament> GetTournament(std::string_view id) override;
+    void GetTournamentAsync(std::string_view id, TournamentCallback callback) override;
+    std::shared_ptr<domain::Tournament> GetTournamentAggregate(std::string_view id) override;
     std::vector<std::shared_ptr<domain::Tournament>> GetAllTournaments() override;
+    std::vector<std::shared_ptr<domain::Tournament>> GetTournamentsPage(const PageRequest& page) override;
     std::expected<void, SaveError> UpdateTournament(std::string_view id, const domain::Tournament& tournament) override;
     std::expected<void, SaveError> DeleteTournament(std::string_view id) override;
 };
@@ -4,6 +4,7 @@
 #include "events/Events.hpp"
 #include "domain/Match.hpp"
 #include "domain/Group.hpp"
+#include "domain/Uuid.hpp"
 #include "domain/IMatchStrategy.hpp"
 #include "persistence/repository/IMatchRepository.hpp"
 #include <memory>
@@ -17,9 +18,18 @@ class MatchEventHandler {
 private:
     std::shared_ptr<repository::IMatchRepository> matchRepository;
 
+    domain::Match CreateMatchWithTeams(
+        const std::string& tournamentId, 
+        domain::MatchPhase phase, 
+        int matchNumber,
+        const std::string& team1Id, 
+        const std::string& team2Id
+    );
+
+public:
     // Estructura para almacenar estadísticas de un equipo en el grupo
     struct TeamStanding {
-        std::string teamId;
+        repository::TeamKey teamId;
         int wins;
         int pointsFor;
         int pointsAgainst;  
@@ -39,20 +49,14 @@ private:
         }
     };
 
-    domain::Match CreateMatchWithTeams(
-        const std::string& tournamentId, 
-        domain::MatchPhase phase, 
-        int matchNumber,
-        const std::string& team1Id, 
-        const std::string& team2Id
-    );
-
-public:
     explicit MatchEventHandler(std::shared_ptr<repository::IMatchRepository> matchRepo);
 
     // Suscribirse a los eventos
     void Subscribe();
 
+    // Tabla de posiciones a partir de los resultados de un grupo, ordenada según TeamStanding
+    static std::vector<TeamStanding> ComputeStandings(const std::vector<repository::MatchResult>& results);
+
     // Handler principal: Se registró un puntaje
     void OnScoreRegistered(const events::ScoreRegisteredEvent& event);
 
@@ -19,13 +19,16 @@ public:
     
     void RegisterMatchResult(const std::string& matchId, int team1Score, int team2Score);
     
-    std::vector<std::shared_ptr<domain::Match>> GetMatchesByTournament(const std::string& tournamentId);
+    std::vector<std::shared_ptr<domain::Match>> GetMatchesByTournament(const std::string& tournamentId, const PageRequest& page = {});
     
-    std::vector<std::shared_ptr<domain::Match>> GetMatchesByPhase(const std::string& tournamentId, domain::MatchPhase phase);
+    // Partidos en la arena de la petición (ver IMatchRepository::ArenaMatches)
+    repository::IMatchRepository::ArenaMatches GetMatchesByTournament(const std::string& tournamentId, const PageRequest& page, std::pmr::memory_resource* arena);
     
-    std::vector<std::shared_ptr<domain::Match>> GetMatchesByGroup(const std::string& groupId);
+    std::vector<std::shared_ptr<domain::Match>> GetMatchesByPhase(const std::string& tournamentId, domain::MatchPhase phase, const PageRequest& page = {});
     
-    std::vector<std::shared_ptr<domain::Match>> GetMatchesByTeam(const std::string& teamId);
+    std::vector<std::shared_ptr<domain::Match>> GetMatchesByGroup(const std::string& groupId, const PageRequest& page = {});
+    
+    std::vector<std::shared_ptr<domain::Match>> GetMatchesByTeam(const std::string& teamId, const PageRequest& page = {});
     
     std::shared_ptr<domain::Match> GetMatchById(const std::string& matchId);
     
@@ -1,40 +1,50 @@
 #include "controller/GroupController.hpp"
 #include "configuration/RouteDefinition.hpp"
+#include "controller/JsonBody.hpp"
+#include "controller/Pagination.hpp"
 #include "domain/Group.hpp"
 #include <nlohmann/json.hpp>
+#include <string>
 #include <utility>
+#include <vector>
 
 GroupController::GroupController(const std::shared_ptr<IGroupDelegate>& delegate) : groupDelegate(std::move(delegate)) {}
 
 crow::response GroupController::CreateGroup(const crow::request& request, const std::string& tournamentId) const {
-    if (!nlohmann::json::accept(request.body)) {
-        return crow::response(crow::BAD_REQUEST, "{\"error\":\"Invalid JSON format\"}");
+    domain::Group group;
+    if (const auto read = domain::json_reader::Read(request.body, group); !read) {
+        return json_body::BadRequest(read.error());
     }
-    try {
-        auto body = nlohmann::json::parse(request.body);
-        domain::Group group;
-        from_json(body, group);
-        auto result = groupDelegate->CreateGroup(tournamentId, group);
-        if (result) {
-            crow::response res(crow::CREATED);
-            res.add_header("Location", result.value());
-            return res;
-        } else {
-            if (result.error() == "Tournament not found") {
-                return crow::response(crow::NOT_FOUND, "{\"error\":\"" + result.error() + "\"}");
-            }
-            return crow::response(422, "{\"error\":\"" + result.error() + "\"}");
+    auto result = groupDelegate->CreateGroup(tournamentId, group);
+    if (result) {
+        crow::response res(crow::CREATED);
+        res.add_header("Location", result.value());
+        return res;
+    } else {
+        if (result.error() == "Tournament not found") {
+            return crow::response(crow::NOT_FOUND, "{\"error\":\"" + result.error() + "\"}");
         }
-    } catch (const nlohmann::json::exception& e) {
-       return crow::response(crow::BAD_REQUEST, "{\"error\":\"JSON parsing error\"}");
+        return crow::response(422, "{\"error\":\"" + result.error() + "\"}");
     }
 }
 
-crow::response GroupController::GetGroups(const std::string& tournamentId) const {
-    auto result = groupDelegate->GetGroups(tournamentId);
+crow::response GroupController::GetGroups(const crow::request& request, const std::string& tournamentId) const {
+    auto page = pagination::ParsePageRequest(request);
+    if (!page) {
+        return pagination::BadRequest(page.error());
+    }
+
+    auto result = page->has_value()
+        ? groupDelegate->GetGroupsPage(tournamentId, pagination::WithLookahead(**page))
+        : groupDelegate->GetGroups(tournamentId);
     if (result) {
+        crow::response response(crow::OK);
+        if (page->has_value()) {
+            pagination::ApplyPage(response, request, **page, result.value());
+        }
         nlohmann::json body = result.value();
-        return crow::response(crow::OK, body.dump());
+        response.body = body.dump();
+        return response;
     }
     return crow::response(crow::INTERNAL_SERVER_ERROR, "{\"error\":\"" + result.error() + "\"}");
 }
@@ -49,9 +59,10 @@ crow::response GroupController::GetGroup(const std::string& tournamentId, const
 }
 
 crow::response GroupController::UpdateGroup(const crow::request& request, const std::string& tournamentId, const std::string& groupId) const {
-    auto body = nlohmann::json::parse(request.body);
     domain::Group group;
-    from_json(body, group);
+    if (const auto read = domain::json_reader::Read(request.body, group); !read) {
+        return json_body::BadRequest(read.error());
+    }
     group.Id() = groupId;
 
     auto result = groupDelegate->UpdateGroup(tournamentId, group);
@@ -61,6 +72,43 @@ crow::response GroupController::UpdateGroup(const crow::request& request, const
     return crow::response(crow::NOT_FOUND);
 }
 
+crow::response GroupController::AddTeams(const crow::request& request, const std::string& tournamentId, const std::string& groupId) const {
+    // Cuerpo: [{"id": "..."}, ...] o un solo {"id": "..."}; solo se usa el id de cada equipo
+    auto body = nlohmann::json::parse(request.body, nullptr, false);
+    if (body.is_object()) {
+        body = nlohmann::json::array({body});
+    }
+    if (!body.is_array() || body.empty()) {
+        return pagination::BadRequest("Expected a list of teams");
+    }
+    std::vector<std::string> teamIds;
+    teamIds.reserve(body.size());
+    for (const auto& team : body) {
+        if (!team.is_object() || !team.contains("id") || !team["id"].is_string()
+            || !pagination::IsUuid(team["id"].get_ref<const std::string&>())) {
+            return pagination::BadRequest("Invalid team id");
+        }
+        teamIds.push_back(team["id"].get<std::string>());
+    }
+
+    auto result = groupDelegate->AddTeams(tournamentId, groupId, teamIds);
+    if (result) {
+        return crow::response(crow::NO_CONTENT);
+    }
+    switch (result.error()) {
+        case IGroupDelegate::AddTeamsError::GroupNotFound:
+            return crow::response(crow::NOT_FOUND, "{\"error\":\"Group not found in this tournament\"}");
+        case IGroupDelegate::AddTeamsError::AlreadyRegistered:
+            return crow::response(crow::CONFLICT, "{\"error\":\"Team already registered\"}");
+        case IGroupDelegate::AddTeamsError::GroupFull:
+            return crow::response(crow::CONFLICT, "{\"error\":\"Group is full\"}");
+        case IGroupDelegate::AddTeamsError::TeamNotFound:
+            return crow::response(422, "{\"error\":\"Team not found\"}");
+        default:
+            return crow::response(crow::INTERNAL_SERVER_ERROR, "{\"error\":\"Teams could not be registered\"}");
+    }
+}
+
 crow::response GroupController::DeleteGroup(const std::string& tournamentId, const std::string& groupId) const {
     auto result = groupDelegate->RemoveGroup(tournamentId, groupId);
     if (result) {
@@ -73,4 +121,5 @@ REGISTER_ROUTE(GroupController, CreateGroup, "/tournaments/<string>/groups", "PO
 REGISTER_ROUTE(GroupController, GetGroups, "/tournaments/<string>/groups", "GET"_method)
 REGISTER_ROUTE(GroupController, GetGroup, "/tournaments/<string>/groups/<string>", "GET"_method)
 REGISTER_ROUTE(GroupController, UpdateGroup, "/tournaments/<string>/groups/<string>", "PATCH"_method)
+REGISTER_ROUTE(GroupController, AddTeams, "/tournaments/<string>/groups/<string>/teams", "PATCH"_method)
 REGISTER_ROUTE(GroupController, DeleteGroup, "/tournaments/<string>/groups/<string>", "DELETE"_method)
\ No newline at end of file
@@ -1,11 +1,36 @@
 #include "controller/MatchController.hpp"
 #include "configuration/RouteDefinition.hpp"
+#include "controller/Pagination.hpp"
 #include "domain/Match.hpp"
+#include "domain/JsonWriter.hpp"
+#include "memory/RequestArena.hpp"
 #include <nlohmann/json.hpp>
 #include <utility>
 
 namespace controller { 
 
+namespace {
+    // Tamaño aproximado de un partido serializado con ids UUID; solo para reservar el cuerpo
+    constexpr size_t EstimatedMatchJsonBytes = 384;
+
+    // Lista de partidos; si la petición trae limit/after se responde una página (keyset)
+    template<typename Finder>
+    crow::response MatchListResponse(const crow::request& req, Finder&& find) {
+        auto page = pagination::ParsePageRequest(req);
+        if (!page) {
+            return pagination::BadRequest(page.error());
+        }
+        crow::response response(crow::OK);
+        auto matchList = find(page->has_value() ? pagination::WithLookahead(**page) : PageRequest{});
+        if (page->has_value()) {
+            pagination::ApplyPage(response, req, **page, matchList);
+        }
+        nlohmann::json responseBody = matchList;
+        response.body = responseBody.dump();
+        return response;
+    }
+}
+
 MatchController::MatchController(std::shared_ptr<service::MatchService> service)
     : matchService(std::move(service)) {}
 
@@ -39,36 +64,50 @@ crow::response MatchController::GetMatchById(const std::string& matchId) const {
 }
 
 // GET /api/tournaments/{id}/matches
-crow::response MatchController::GetMatchesByTournament(const std::string& tournamentId) const {
-    auto matchList = matchService->GetMatchesByTournament(tournamentId); // Renombrado
-    nlohmann::json responseBody = matchList; // Renombrado
-    return crow::response(crow::OK, responseBody.dump());
+// Los partidos viven en la arena de la petición y el cuerpo se escribe sin DOM. El cuerpo es
+// lo único que queda fuera de la arena: Crow lo envía después de que el handler regresa.
+crow::response MatchController::GetMatchesByTournament(const crow::request& req, const std::string& tournamentId) const {
+    auto page = pagination::ParsePageRequest(req);
+    if (!page) {
+        return pagination::BadRequest(page.error());
+    }
+    RequestArena arena;
+    auto matchList = matchService->GetMatchesByTournament(
+        tournamentId, page->has_value() ? pagination::WithLookahead(**page) : PageRequest{}, arena.Resource());
+
+    crow::response response(crow::OK);
+    if (page->has_value()) {
+        pagination::ApplyPage(response, req, **page, matchList);
+    }
+    response.body.reserve(matchList.size() * EstimatedMatchJsonBytes + 2);
+    domain::AppendJsonArray(response.body, matchList);
+    return response;
 }
 
 // GET /api/tournaments/{id}/matches/phase/{phase}
-crow::response MatchController::GetMatchesByPhase(const std::string& tournamentId, const std::string& phase) const {
+crow::response MatchController::GetMatchesByPhase(const crow::request& req, const std::string& tournamentId, const std::string& phase) const {
     try {
         domain::MatchPhase phaseEnum = domain::Match::StringToPhase(phase);
-        auto matchList = matchService->GetMatchesByPhase(tournamentId, phaseEnum); // Renombrado
-        nlohmann::json responseBody = matchList; // Renombrado
-        return crow::response(crow::OK, responseBody.dump());
+        return MatchListResponse(req, [&](const PageRequest& page) {
+            return matchService->GetMatchesByPhase(tournamentId, phaseEnum, page);
+        });
     } catch (const std::exception& e) {
         return crow::response(crow::BAD_REQUEST, std::string("{\"error\":\"Fase inválida: ") + e.what() + "\"}");
     }
 }
 
 // GET /api/groups/{id}/matches
-crow::response MatchController::GetMatchesByGroup(const std::string& groupId) const {
-    auto matchList = matchService->GetMatchesByGroup(groupId); // Renombrado
-    nlohmann::json responseBody = matchList; // Renombrado
-    return crow::response(crow::OK, responseBody.dump());
+crow::response MatchController::GetMatchesByGroup(const crow::request& req, const std::string& groupId) const {
+    return MatchListResponse(req, [&](const PageRequest& page) {
+        return matchService->GetMatchesByGroup(groupId, page);
+    });
 }
 
 // GET /api/teams/{id}/matches
-crow::response MatchController::GetMatchesByTeam(const std::string& teamId) const {
-    auto matchList = matchService->GetMatchesByTeam(teamId); // Renombrado
-    nlohmann::json responseBody = matchList; // Renombrado
-    return crow::response(crow::OK, responseBody.dump());
+crow::response MatchController::GetMatchesByTeam(const crow::request& req, const std::string& teamId) const {
+    return MatchListResponse(req, [&](const PageRequest& page) {
+        return matchService->GetMatchesByTeam(teamId, page);
+    });
 }
 
 // POST /api/matches (Uso administrativo)
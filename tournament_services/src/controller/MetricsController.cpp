@@ -0,0 +1,22 @@
+#include "controller/MetricsController.hpp"
+#include "configuration/RouteDefinition.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
+#include <nlohmann/json.hpp>
+#include <utility>
+
+MetricsController::MetricsController(std::shared_ptr<IDbConnectionProvider> provider, std::shared_ptr<CacheMetricsRegistry> cacheMetrics)
+    : connectionProvider(std::move(provider)), cacheMetrics(std::move(cacheMetrics)) {}
+
+crow::response MetricsController::GetMetrics() const {
+    nlohmann::json body = {
+        {"connectionPool", connectionProvider->Metrics()},
+        {"replicaPools", connectionProvider->ReplicaMetrics()},
+        {"caches", cacheMetrics->Snapshot()},
+        {"queries", QueryStatistics::Instance().Snapshot()}
+    };
+    crow::response response(crow::OK, body.dump());
+    response.add_header("Content-Type", "application/json");
+    return response;
+}
+
+REGISTER_ROUTE(MetricsController, GetMetrics, "/metrics", "GET"_method)
@@ -1,35 +1,91 @@
 #include "controller/TeamController.hpp"
 #include "configuration/RouteDefinition.hpp"
+#include "controller/Pagination.hpp"
 #include "domain/Utilities.hpp" 
+#include <algorithm>
+#include <expected>
+#include <string_view>
+#include <vector>
+
+namespace {
+    // ?ids=a,b,c: UUIDs separados por coma, sin repetidos, como mucho pagination::MaxLimit.
+    // Cada segmento debe ser un UUID, así que "", "a,,b" y "a," se rechazan
+    std::expected<std::vector<std::string>, std::string> ParseIds(std::string_view text) {
+        std::vector<std::string> ids;
+        while (true) {
+            const auto comma = text.find(',');
+            const auto id = text.substr(0, comma);
+            if (!pagination::IsUuid(id)) {
+                return std::unexpected("Invalid id");
+            }
+            if (std::find(ids.begin(), ids.end(), id) == ids.end()) {
+                ids.emplace_back(id);
+            }
+            if (comma == std::string_view::npos) break;
+            text.remove_prefix(comma + 1);
+        }
+        if (ids.size() > pagination::MaxLimit) {
+            return std::unexpected("Too many ids");
+        }
+        return ids;
+    }
+}
 
 // La implementación del constructor
 TeamController::TeamController(const std::shared_ptr<ITeamDelegate>& delegate) : teamDelegate(delegate) {}
 
 // La implementación de getTeam
-crow::response TeamController::getTeam(const std::string& teamId) const {
-    if(auto team = teamDelegate->GetTeam(teamId); team != nullptr) {
-        nlohmann::json body = *team;
-        auto response = crow::response{crow::OK, body.dump()};
+void TeamController::getTeam(const crow::request& request, crow::response& response, const std::string& teamId) const {
+    teamDelegate->GetTeamAsync(teamId, [&request, &response](std::expected<std::shared_ptr<domain::Team>, std::exception_ptr> team) {
+        endOnConnectionThread(request, response, [team = std::move(team)](crow::response& response) {
+            if (!team) {
+                response = asyncErrorResponse(team.error());
+            } else if (*team != nullptr) {
+                nlohmann::json body = **team;
+                response = crow::response{crow::OK, body.dump()};
+                response.add_header("Content-Type", "application/json");
+            } else {
+                response = crow::response{crow::NOT_FOUND, "{\"error\":\"Team not found\"}"};
+            }
+        });
+    });
+}
+
+// La implementación de getAllTeams
+crow::response TeamController::getAllTeams(const crow::request& request) const {
+    // Multi-get: una sola consulta en lugar de un GET /teams/<id> por equipo
+    if (const char* idsParam = request.url_params.get("ids")) {
+        auto ids = ParseIds(idsParam);
+        if (!ids) {
+            return pagination::BadRequest(ids.error());
+        }
+        nlohmann::json body = teamDelegate->GetTeams(*ids);
+        crow::response response{crow::OK, body.dump()};
         response.add_header("Content-Type", "application/json");
         return response;
     }
-    return crow::response{crow::NOT_FOUND, "{\"error\":\"Team not found\"}"};
-}
 
-// La implementación de getAllTeams
-crow::response TeamController::getAllTeams() const {
-    nlohmann::json body = teamDelegate->GetAllTeams();
-    auto response = crow::response{crow::OK, body.dump()};
+    auto page = pagination::ParseBoundedPageRequest(request);
+    if (!page) {
+        return pagination::BadRequest(page.error());
+    }
+
+    crow::response response(crow::OK);
+    auto teams = teamDelegate->GetTeamsPage(pagination::WithLookahead(*page));
+    pagination::ApplyPage(response, request, *page, teams);
+    nlohmann::json body = teams;
+    response.body = body.dump();
     response.add_header("Content-Type", "application/json");
     return response;
 }
 
 // La implementación de UpdateTeam
 crow::response TeamController::UpdateTeam(const crow::request& request, const std::string& id) const {
-    auto requestBody = nlohmann::json::parse(request.body);
     domain::Team team;
-    from_json(requestBody, team);
-    team.Id() = id;
+    if (const auto read = domain::json_reader::Read(request.body, team); !read) {
+        return json_body::BadRequest(read.error());
+    }
+    team.SetId(id);
 
     auto result = teamDelegate->UpdateTeam(id, team);
     
@@ -51,9 +107,46 @@ crow::response TeamController::DeleteTeam(const std::string& id) const {
     }
 }
 
+// La implementación de ImportTeams: acepta un arreglo JSON o NDJSON (un equipo por línea)
+crow::response TeamController::ImportTeams(const crow::request& request) const {
+    std::vector<domain::Team> teams;
+    const auto firstChar = request.body.find_first_not_of(" \t\r\n");
+    if (firstChar != std::string::npos && request.body[firstChar] == '[') {
+        if (!domain::json_reader::Read(request.body, teams)) {
+            return crow::response{crow::BAD_REQUEST, "{\"error\":\"JSON parsing error\"}"};
+        }
+    } else {
+        std::string_view lines(request.body);
+        while (!lines.empty()) {
+            const auto newline = lines.find('\n');
+            const auto line = lines.substr(0, newline);
+            lines.remove_prefix(newline == std::string_view::npos ? lines.size() : newline + 1);
+            if (line.find_first_not_of(" \t\r") == std::string_view::npos) continue;
+            if (!domain::json_reader::Read(line, teams.emplace_back())) {
+                return crow::response{crow::BAD_REQUEST, "{\"error\":\"JSON parsing error\"}"};
+            }
+        }
+    }
+
+    if (teams.empty()) {
+        return crow::response{crow::BAD_REQUEST, "{\"error\":\"No teams to import\"}"};
+    }
+
+    auto result = teamDelegate->ImportTeams(teams);
+    if (!result) {
+        return crow::response{crow::INTERNAL_SERVER_ERROR, "{\"error\":\"Teams could not be imported\"}"};
+    }
+
+    nlohmann::json body = result.value();
+    auto response = crow::response{crow::CREATED, body.dump()};
+    response.add_header("Content-Type", "application/json");
+    return response;
+}
+
 // El registro de TODAS las rutas vive aquí
-REGISTER_ROUTE(TeamController, getTeam, "/teams/<string>", "GET"_method)
+REGISTER_ASYNC_ROUTE(TeamController, getTeam, "/teams/<string>", "GET"_method)
 REGISTER_ROUTE(TeamController, getAllTeams, "/teams", "GET"_method)
 REGISTER_ROUTE(TeamController, SaveTeam, "/teams", "POST"_method)
+REGISTER_ROUTE(TeamController, ImportTeams, "/teams/import", "POST"_method)
 REGISTER_ROUTE(TeamController, UpdateTeam, "/teams/<string>", "PATCH"_method)
 REGISTER_ROUTE(TeamController, DeleteTeam, "/teams/<string>", "DELETE"_method)
\ No newline at end of file
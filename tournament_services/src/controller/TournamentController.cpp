@@ -1,5 +1,7 @@
 #include "controller/TournamentController.hpp"
 #include "configuration/RouteDefinition.hpp"
+#include "controller/JsonBody.hpp"
+#include "controller/Pagination.hpp"
 #include "domain/Tournament.hpp"
 #include "delegate/ITournamentDelegate.hpp"
 #include <nlohmann/json.hpp>
@@ -8,60 +10,78 @@
 TournamentController::TournamentController(std::shared_ptr<ITournamentDelegate> delegate) : tournamentDelegate(std::move(delegate)) {}
 
 crow::response TournamentController::CreateTournament(const crow::request& request) const {
-    if (!nlohmann::json::accept(request.body)) {
-        return crow::response{crow::BAD_REQUEST, "{\"error\":\"Invalid JSON format\"}"};
+    auto tournament = std::make_shared<domain::Tournament>();
+    if (const auto read = domain::json_reader::Read(request.body, *tournament); !read) {
+        return json_body::BadRequest(read.error());
     }
-    try {
-        auto requestBody = nlohmann::json::parse(request.body);
-        auto tournament = std::make_shared<domain::Tournament>();
-        from_json(requestBody, *tournament);
 
-        auto result = tournamentDelegate->CreateTournament(tournament);
+    auto result = tournamentDelegate->CreateTournament(tournament);
 
-        if (result) {
-            crow::response res(crow::CREATED);
-            res.set_header("Location", result.value());
-            return res;
-        } else {
-            return crow::response{crow::CONFLICT, "{\"error\":\"Tournament already exists\"}"};
-        }
-    } catch (const nlohmann::json::exception& e) {
-        return crow::response{crow::BAD_REQUEST, "{\"error\":\"JSON parsing error\"}"};
+    if (result) {
+        crow::response res(crow::CREATED);
+        res.set_header("Location", result.value());
+        return res;
+    } else {
+        return crow::response{crow::CONFLICT, "{\"error\":\"Tournament already exists\"}"};
     }
 }
 
-crow::response TournamentController::ReadAll() const {
-    nlohmann::json body = tournamentDelegate->GetAllTournaments();
+crow::response TournamentController::ReadAll(const crow::request& request) const {
+    auto page = pagination::ParseBoundedPageRequest(request);
+    if (!page) {
+        return pagination::BadRequest(page.error());
+    }
+
     crow::response response(crow::OK);
-    response.add_header("Content-Type", "application/json");
+    auto tournaments = tournamentDelegate->GetTournamentsPage(pagination::WithLookahead(*page));
+    pagination::ApplyPage(response, request, *page, tournaments);
+    nlohmann::json body = tournaments;
     response.body = body.dump();
+    response.add_header("Content-Type", "application/json");
     return response;
 }
 
-crow::response TournamentController::GetTournament(const std::string& id) const {
-    auto tournamentPtr = tournamentDelegate->GetTournament(id);
-    if (tournamentPtr != nullptr) {
-        nlohmann::json body = *tournamentPtr;
-        return crow::response(crow::OK, body.dump());
+void TournamentController::GetTournament(const crow::request& request, crow::response& response, const std::string& id) const {
+    tournamentDelegate->GetTournamentAsync(id, [&request, &response](std::expected<std::shared_ptr<domain::Tournament>, std::exception_ptr> tournament) {
+        endOnConnectionThread(request, response, [tournament = std::move(tournament)](crow::response& response) {
+            if (!tournament) {
+                response = asyncErrorResponse(tournament.error());
+            } else if (*tournament != nullptr) {
+                nlohmann::json body = **tournament;
+                response = crow::response(crow::OK, body.dump());
+            } else {
+                response = crow::response(crow::NOT_FOUND);
+            }
+        });
+    });
+}
+
+crow::response TournamentController::GetTournamentAggregate(const std::string& id) const {
+    auto tournament = tournamentDelegate->GetTournamentAggregate(id);
+    if (tournament == nullptr) {
+        return crow::response(crow::NOT_FOUND);
     }
-    return crow::response(crow::NOT_FOUND);
+    nlohmann::json body = *tournament;
+    body["groups"] = tournament->Groups();
+    body["matches"] = tournament->Matches();
+
+    crow::response response(crow::OK, body.dump());
+    response.add_header("Content-Type", "application/json");
+    return response;
 }
 
 crow::response TournamentController::UpdateTournament(const crow::request& request, const std::string& id) const {
-    try {
-        auto body = nlohmann::json::parse(request.body);
-        domain::Tournament tournament;
-        from_json(body, tournament);
-        tournament.Id() = id;
+    domain::Tournament tournament;
+    if (const auto read = domain::json_reader::Read(request.body, tournament); !read) {
+        return json_body::BadRequest(read.error());
+    }
+    tournament.Id() = id;
 
-        auto result = tournamentDelegate->UpdateTournament(id, tournament);
-        if (result) {
-            return crow::response(crow::NO_CONTENT);
-        }
-        return crow::response(crow::NOT_FOUND);
-    } catch (const nlohmann::json::exception& e) {
-        return crow::response{crow::BAD_REQUEST, "{\"error\":\"JSON parsing error\"}"};
+    auto result = tournamentDelegate->UpdateTournament(id, tournament);
+    if (result) {
+        return crow::response(crow::NO_CONTENT);
     }
+    return crow::response(crow::NOT_FOUND);
 }
 
 crow::response TournamentController::DeleteTournament(const std::string& id) const {
@@ -75,6 +95,7 @@ crow::response TournamentController::DeleteTournament(const std::string& id) con
 // Se registran todas las rutas para los métodos del TournamentController
 REGISTER_ROUTE(TournamentController, CreateTournament, "/tournaments", "POST"_method)
 REGISTER_ROUTE(TournamentController, ReadAll, "/tournaments", "GET"_method)
-REGISTER_ROUTE(TournamentController, GetTournament, "/tournaments/<string>", "GET"_method)
+REGISTER_ASYNC_ROUTE(TournamentController, GetTournament, "/tournaments/<string>", "GET"_method)
+REGISTER_ROUTE(TournamentController, GetTournamentAggregate, "/tournaments/<string>/full", "GET"_method)
 REGISTER_ROUTE(TournamentController, UpdateTournament, "/tournaments/<string>", "PATCH"_method)
 REGISTER_ROUTE(TournamentController, DeleteTournament, "/tournaments/<string>", "DELETE"_method)
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "delegate/TeamDelegate.hpp"
+#include <unordered_map>
 #include <utility>
 #include <expected>
 
@@ -22,10 +23,36 @@ std::shared_ptr<domain::Team> TeamDelegate::GetTeam(std::string_view id) {
     return teamRepository->ReadById(std::string(id));
 }
 
+void TeamDelegate::GetTeamAsync(std::string_view id, TeamCallback callback) {
+    teamRepository->ReadByIdAsync(std::string(id), std::move(callback));
+}
+
+std::vector<std::shared_ptr<domain::Team>> TeamDelegate::GetTeams(std::span<const std::string> ids) {
+    auto found = teamRepository->ReadByIds(ids);
+    std::unordered_map<std::string, std::shared_ptr<domain::Team>> byId;
+    byId.reserve(found.size());
+    for (auto& team : found) {
+        byId.emplace(team->Id(), std::move(team));
+    }
+
+    std::vector<std::shared_ptr<domain::Team>> teams;
+    teams.reserve(byId.size());
+    for (const auto& id : ids) {
+        if (auto team = byId.find(id); team != byId.end()) {
+            teams.push_back(team->second);
+        }
+    }
+    return teams;
+}
+
 std::vector<std::shared_ptr<domain::Team>> TeamDelegate::GetAllTeams() {
     return teamRepository->ReadAll();
 }
 
+std::vector<std::shared_ptr<domain::Team>> TeamDelegate::GetTeamsPage(const PageRequest& page) {
+    return teamRepository->ReadPage(page);
+}
+
 // La implementación de UpdateTeam
 std::expected<void, ITeamDelegate::SaveError> TeamDelegate::UpdateTeam(std::string_view id, const domain::Team& team) {
     if (teamRepository->ReadById(std::string(id)) == nullptr) {
@@ -44,4 +71,15 @@ std::expected<void, ITeamDelegate::SaveError> TeamDelegate::DeleteTeam(std::stri
 
     teamRepository->Delete(std::string(id));
     return {};
-}
\ No newline at end of file
+}
+
+// La implementación de ImportTeams
+std::expected<std::vector<std::string>, ITeamDelegate::SaveError> TeamDelegate::ImportTeams(const std::vector<domain::Team>& teams) {
+    auto ids = teamRepository->CreateMany(teams);
+
+    // CreateMany es todo o nada: si no regresan todos los ids no se insertó ninguno
+    if (ids.size() != teams.size()) {
+        return std::unexpected(ITeamDelegate::SaveError::Unknown);
+    }
+    return ids;
+}
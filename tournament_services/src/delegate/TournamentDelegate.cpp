@@ -3,8 +3,9 @@
 
 TournamentDelegate::TournamentDelegate(
     std::shared_ptr<IRepository<domain::Tournament, std::string>> repository, 
-    std::shared_ptr<IQueueMessageProducer> producer) 
-    : tournamentRepository(std::move(repository)), producer(std::move(producer)) {
+    std::shared_ptr<IQueueMessageProducer> producer,
+    std::shared_ptr<ITournamentRepository> aggregateRepository)
+    : tournamentRepository(std::move(repository)), producer(std::move(producer)), aggregateRepository(std::move(aggregateRepository)) {
 }
 
 std::expected<std::string, ITournamentDelegate::SaveError> TournamentDelegate::CreateTournament(std::shared_ptr<domain::Tournament> tournament) {
@@ -22,10 +23,22 @@ std::shared_ptr<domain::Tournament> TournamentDelegate::GetTournament(std::strin
     return tournamentRepository->ReadById(std::string(id));
 }
 
+void TournamentDelegate::GetTournamentAsync(std::string_view id, TournamentCallback callback) {
+    tournamentRepository->ReadByIdAsync(std::string(id), std::move(callback));
+}
+
+std::shared_ptr<domain::Tournament> TournamentDelegate::GetTournamentAggregate(std::string_view id) {
+    return aggregateRepository->ReadAggregateById(std::string(id));
+}
+
 std::vector<std::shared_ptr<domain::Tournament>> TournamentDelegate::GetAllTournaments() {
     return tournamentRepository->ReadAll();
 }
 
+std::vector<std::shared_ptr<domain::Tournament>> TournamentDelegate::GetTournamentsPage(const PageRequest& page) {
+    return tournamentRepository->ReadPage(page);
+}
+
 std::expected<void, ITournamentDelegate::SaveError> TournamentDelegate::UpdateTournament(std::string_view id, const domain::Tournament& tournament) {
     if (tournamentRepository->ReadById(std::string(id)) == nullptr) {
         return std::unexpected(ITournamentDelegate::SaveError::NotFound);
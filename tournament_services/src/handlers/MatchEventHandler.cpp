@@ -1,4 +1,5 @@
 #include "handlers/MatchEventHandler.hpp"
+#include "persistence/repository/IdGenerator.hpp"
 #include <iostream>
 #include <string> 
 #include <map>   
@@ -100,9 +101,9 @@ void MatchEventHandler::GeneratePlayoffsFromGroupStage(const std::string& tourna
             strategy.get()
         );
 
-        for (auto& match : playoffMatches) {
-            matchRepository->Save(match);
-        }
+        // todo el cuadro de playoffs, ya enlazado, en una sola transacción
+        LinkPlayoffMatches(playoffMatches);
+        matchRepository->SaveAll(playoffMatches);
         std::cout << "[MatchEventHandler] Generated " << playoffMatches.size() 
                   << " playoff matches" << std::endl;
 
@@ -121,68 +122,75 @@ std::vector<std::string> MatchEventHandler::ApplyStandingsRules(
         auto standings = CalculateGroupStandings(groupId);
         
         for (size_t i = 0; i < standings.size() && i < 2; i++) {
-            std::cout << "  " << (i+1) << ". Team " << standings[i].teamId 
+            std::cout << "  " << (i+1) << ". Team " << standings[i].teamId.ToString() 
                       << " - Wins: " << standings[i].wins 
                       << " PF: " << standings[i].pointsFor
                       << " PA: " << standings[i].pointsAgainst << std::endl;
         }
         
         if (standings.size() >= 2) {
-            qualifiedTeams.push_back(standings[0].teamId); // Primero
-            qualifiedTeams.push_back(standings[1].teamId); // Segundo
+            qualifiedTeams.push_back(standings[0].teamId.ToString()); // Primero
+            qualifiedTeams.push_back(standings[1].teamId.ToString()); // Segundo
         } else if (standings.size() == 1) {
-            qualifiedTeams.push_back(standings[0].teamId);
+            qualifiedTeams.push_back(standings[0].teamId.ToString());
         }
     }
     return qualifiedTeams;
 }
 
 std::vector<MatchEventHandler::TeamStanding> MatchEventHandler::CalculateGroupStandings(const std::string& groupId) {
-    auto matches = matchRepository->FindByGroupId(groupId);
-    std::map<std::string, TeamStanding> standings;
-
-    for (const auto& matchPtr : matches) {
-        if (!matchPtr->IsComplete() || !matchPtr->Team1Id().has_value() || !matchPtr->Team2Id().has_value()) {
-            continue;
-        }
-
-        std::string team1Id = matchPtr->Team1Id().value();
-        std::string team2Id = matchPtr->Team2Id().value();
-        int score1 = matchPtr->Team1Score().value_or(0);
-        int score2 = matchPtr->Team2Score().value_or(0);
+    // Solo los partidos terminados con ambos equipos, y de ellos solo equipos y marcador
+    return ComputeStandings(matchRepository->FindCompletedResultsByGroupId(groupId));
+}
 
-        if (standings.find(team1Id) == standings.end()) {
-            standings[team1Id] = TeamStanding{team1Id};
-        }
-        if (standings.find(team2Id) == standings.end()) {
-            standings[team2Id] = TeamStanding{team2Id};
+std::vector<MatchEventHandler::TeamStanding> MatchEventHandler::ComputeStandings(const std::vector<repository::MatchResult>& results) {
+    // Un grupo tiene pocos equipos: cada id se interna en un índice de un vector contiguo, más
+    // barato que un mapa con claves de texto. Los ids UUID se comparan como 16 bytes y los
+    // heredados ("team-1") como texto, así la tabla no depende de que el id sea un UUID.
+    std::vector<TeamStanding> standings;
+    // índices y no referencias: agregar un equipo puede mover el vector
+    const auto indexOf = [&standings](const repository::TeamKey& teamId) {
+        for (size_t i = 0; i < standings.size(); i++) {
+            if (standings[i].teamId == teamId) return i;
         }
-
-        standings[team1Id].matchesPlayed++;
-        standings[team2Id].matchesPlayed++;
-        standings[team1Id].pointsFor += score1;
-        standings[team1Id].pointsAgainst += score2;
-        standings[team2Id].pointsFor += score2;
-        standings[team2Id].pointsAgainst += score1;
+        standings.push_back(TeamStanding{teamId});
+        return standings.size() - 1;
+    };
+
+    for (const auto& matchResult : results) {
+        const int score1 = matchResult.team1Score;
+        const int score2 = matchResult.team2Score;
+        const auto team1Index = indexOf(matchResult.team1Id);
+        const auto team2Index = indexOf(matchResult.team2Id);
+        auto& team1 = standings[team1Index];
+        auto& team2 = standings[team2Index];
+
+        team1.matchesPlayed++;
+        team2.matchesPlayed++;
+        team1.pointsFor += score1;
+        team1.pointsAgainst += score2;
+        team2.pointsFor += score2;
+        team2.pointsAgainst += score1;
 
         if (score1 > score2) {
-            standings[team1Id].wins++;
-            standings[team2Id].losses++;
+            team1.wins++;
+            team2.losses++;
         } else if (score2 > score1) {
-            standings[team2Id].wins++;
-            standings[team1Id].losses++;
+            team2.wins++;
+            team1.losses++;
         } else {
-            standings[team1Id].draws++;
-            standings[team2Id].draws++;
+            team1.draws++;
+            team2.draws++;
         }
     }
 
-    std::vector<TeamStanding> result;
-    for (const auto& [teamId, standing] : standings) {
-        result.push_back(standing);
-    }
-    std::sort(result.begin(), result.end());
-    return result;
+    // a igualdad de criterios decide el id, como hacía el orden del mapa
+    std::sort(standings.begin(), standings.end(), [](const TeamStanding& a, const TeamStanding& b) {
+        if (a < b) return true;
+        if (b < a) return false;
+        return a.teamId < b.teamId;
+    });
+    return standings;
 }
 
 
@@ -267,11 +275,8 @@ void MatchEventHandler::CreateAndAssignNextMatch(
     auto nextMatchOpt = strategy->GenerateNextMatch(completedMatch, existingMatches);
     
     if (nextMatchOpt.has_value()) {
-        auto savedMatch = matchRepository->Save(nextMatchOpt.value());
-        
-        auto updatedMatch = completedMatch; // Copia para modificar
-        updatedMatch.SetNextMatchId(savedMatch.Id());
-        matchRepository->Update(updatedMatch);
+        // Crea el partido y enlaza el terminado en un solo lote
+        auto savedMatch = matchRepository->CreateLinked(nextMatchOpt.value(), completedMatch);
 
         std::cout << "[MatchEventHandler] Created next match " << savedMatch.Id() 
                   << " for completed match " << completedMatch.Id() << std::endl;
@@ -299,11 +304,17 @@ void MatchEventHandler::GenerateEmptyPlayoffStructure(
     }
 }
 
+// Asigna los ids del cuadro antes de guardarlo y apunta cada partido al de la fase siguiente
+// (partidos 2k-1 y 2k hacia el k-ésimo), así UpdateNextMatchWithWinner avanza al ganador sin
+// que CreateAndAssignNextMatch tenga que crear partidos nuevos.
 void MatchEventHandler::LinkPlayoffMatches(std::vector<domain::Match>& matches) {
     // Agrupar por fase
     std::map<domain::MatchPhase, std::vector<size_t>> matchIndexByPhase;
     
     for (size_t i = 0; i < matches.size(); i++) {
+        if (matches[i].Id().empty()) {
+            matches[i].Id() = GenerateUuid();
+        }
         matchIndexByPhase[matches[i].Phase()].push_back(i);
     }
 
@@ -319,8 +330,7 @@ void MatchEventHandler::LinkPlayoffMatches(std::vector<domain::Match>& matches)
         for (size_t i = 0; i < indices.size(); i++) {
             size_t nextMatchIndex = i / 2;
             if (nextMatchIndex < nextPhaseIndices.size()) {
-                // (La lógica de vinculación real sucede en UpdateNextMatchWithWinner
-                // y CreateAndAssignNextMatch)
+                matches[indices[i]].SetNextMatchId(matches[nextPhaseIndices[nextMatchIndex]].Id());
             }
         }
     }
@@ -340,21 +350,7 @@ domain::MatchPhase MatchEventHandler::GetNextPhase(domain::MatchPhase currentPha
 }
 
 std::vector<std::string> MatchEventHandler::GetGroupIdsForTournament(const std::string& tournamentId) {
-    auto matches = matchRepository->FindByTournamentIdAndPhase(
-        tournamentId, 
-        domain::MatchPhase::GROUP_STAGE
-    );
-
-    std::vector<std::string> groupIds;
-    for (const auto& matchPtr : matches) {
-        if (!matchPtr->GroupId().empty()) { 
-            const std::string& groupId = matchPtr->GroupId();
-            if (std::find(groupIds.begin(), groupIds.end(), groupId) == groupIds.end()) {
-                groupIds.push_back(groupId);
-            }
-        }
-    }
-    return groupIds;
+    return matchRepository->FindGroupIdsByTournamentId(tournamentId);
 }
 
 } // namespace handlers
\ No newline at end of file
@@ -9,19 +9,17 @@ MatchService::MatchService(std::shared_ptr<repository::IMatchRepository> matchRe
 
 // ✅ CAMBIO: ID es const std::string&
 void MatchService::RegisterMatchResult(const std::string& matchId, int team1Score, int team2Score) {
-    // ✅ CAMBIO: FindById -> ReadById
-    auto match = matchRepository->ReadById(matchId); 
+    // Lectura, validación y escritura en una sola transacción (ver MatchRepository::UpdateById)
+    auto match = matchRepository->UpdateById(matchId, [team1Score, team2Score](domain::Match& match) {
+        if (!match.HasBothTeams()) {
+            throw std::runtime_error("El partido no tiene ambos equipos asignados");
+        }
+        match.SetScore(team1Score, team2Score);
+    });
     if (!match) {
         throw std::runtime_error("Partido no encontrado");
     }
 
-    if (!match->HasBothTeams()) {
-        throw std::runtime_error("El partido no tiene ambos equipos asignados");
-    }
-
-    match->SetScore(team1Score, team2Score);
-    matchRepository->Update(*match);
-
     std::string phaseStr = domain::Match::PhaseToString(match->Phase());
     std::string winnerId = match->WinnerId().value_or(""); // Manejar opcional
 
@@ -36,20 +34,24 @@ void MatchService::RegisterMatchResult(const std::string& matchId, int team1Scor
     events::EventBus::Instance()->Publish(event);
 }
 
-std::vector<std::shared_ptr<domain::Match>> MatchService::GetMatchesByTournament(const std::string& tournamentId) {
-    return matchRepository->FindByTournamentId(tournamentId);
+std::vector<std::shared_ptr<domain::Match>> MatchService::GetMatchesByTournament(const std::string& tournamentId, const PageRequest& page) {
+    return matchRepository->FindByTournamentId(tournamentId, page);
+}
+
+repository::IMatchRepository::ArenaMatches MatchService::GetMatchesByTournament(const std::string& tournamentId, const PageRequest& page, std::pmr::memory_resource* arena) {
+    return matchRepository->FindByTournamentId(tournamentId, page, arena);
 }
 
-std::vector<std::shared_ptr<domain::Match>> MatchService::GetMatchesByPhase(const std::string& tournamentId, domain::MatchPhase phase) {
-    return matchRepository->FindByTournamentIdAndPhase(tournamentId, phase);
+std::vector<std::shared_ptr<domain::Match>> MatchService::GetMatchesByPhase(const std::string& tournamentId, domain::MatchPhase phase, const PageRequest& page) {
+    return matchRepository->FindByTournamentIdAndPhase(tournamentId, phase, page);
 }
 
-std::vector<std::shared_ptr<domain::Match>> MatchService::GetMatchesByGroup(const std::string& groupId) {
-    return matchRepository->FindByGroupId(groupId);
+std::vector<std::shared_ptr<domain::Match>> MatchService::GetMatchesByGroup(const std::string& groupId, const PageRequest& page) {
+    return matchRepository->FindByGroupId(groupId, page);
 }
 
-std::vector<std::shared_ptr<domain::Match>> MatchService::GetMatchesByTeam(const std::string& teamId) {
-    return matchRepository->FindByTeamId(teamId);
+std::vector<std::shared_ptr<domain::Match>> MatchService::GetMatchesByTeam(const std::string& teamId, const PageRequest& page) {
+    return matchRepository->FindByTeamId(teamId, page);
 }
 
 std::shared_ptr<domain::Match> MatchService::GetMatchById(const std::string& matchId) {
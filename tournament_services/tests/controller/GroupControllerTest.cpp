@@ -5,6 +5,7 @@
 #include "domain/Group.hpp"
 #include "crow.h"
 #include <expected>
+#include <utility>
 #include <vector>
 #include <string>
 
@@ -19,8 +20,10 @@ public:
     // Mocks para todos los métodos de la interfaz IGroupDelegate
     MOCK_METHOD((std::expected<std::string, std::string>), CreateGroup, (const std::string_view& tournamentId, const domain::Group& group), (override));
     MOCK_METHOD((std::expected<std::vector<domain::Group>, std::string>), GetGroups, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD((std::expected<std::vector<domain::Group>, std::string>), GetGroupsPage, (const std::string_view& tournamentId, const PageRequest& page), (override));
     MOCK_METHOD((std::expected<domain::Group, std::string>), GetGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
     MOCK_METHOD((std::expected<void, std::string>), UpdateGroup, (const std::string_view& tournamentId, const domain::Group& group), (override));
+    MOCK_METHOD((std::expected<void, IGroupDelegate::AddTeamsError>), AddTeams, (const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<std::string>& teamIds), (override));
     MOCK_METHOD((std::expected<void, std::string>), RemoveGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
 };
 
@@ -108,7 +111,8 @@ TEST(GroupControllerTest, GetGroups_Returns200_WithData) {
         .WillOnce(Return(std::expected<std::vector<domain::Group>, std::string>(groups)));
 
     // Acción
-    crow::response res = controller.GetGroups(tournamentId);
+    crow::request req;
+    crow::response res = controller.GetGroups(req, tournamentId);
 
     // Verificación
     ASSERT_EQ(res.code, 200);
@@ -118,6 +122,35 @@ TEST(GroupControllerTest, GetGroups_Returns200_WithData) {
     ASSERT_EQ(body[0]["name"], "Group A");
 }
 
+// Prueba leer una página con siguiente página (HTTP 200)
+TEST(GroupControllerTest, GetGroups_WithLimit_ReturnsPageAndNextLink) {
+    // Preparación
+    auto mockDelegate = std::make_shared<MockGroupDelegate>();
+    GroupController controller(mockDelegate);
+    std::string tournamentId = "tourn-1";
+    std::vector<domain::Group> groups = { domain::Group("Group A"), domain::Group("Group B") };
+    groups[0].Id() = "00000000-0000-0000-0000-00000000000a";
+    groups[1].Id() = "00000000-0000-0000-0000-00000000000b";
+
+    // Simular que el Delegate devuelve limit + 1 grupos
+    EXPECT_CALL(*mockDelegate, GetGroupsPage(tournamentId, _))
+        .WillOnce(Return(std::expected<std::vector<domain::Group>, std::string>(groups)));
+    EXPECT_CALL(*mockDelegate, GetGroups(_)).Times(0);
+
+    // Acción
+    crow::request req;
+    req.url = "/tournaments/tourn-1/groups";
+    req.url_params = crow::query_string("?limit=1");
+    crow::response res = controller.GetGroups(req, tournamentId);
+
+    // Verificación
+    ASSERT_EQ(res.code, 200);
+    nlohmann::json body = nlohmann::json::parse(res.body);
+    ASSERT_EQ(body.size(), 1);
+    ASSERT_EQ(body[0]["name"], "Group A");
+    ASSERT_NE(res.get_header_value("Link").find("rel=\"next\""), std::string::npos);
+}
+
 // --- Pruebas para GET /tournaments/{id}/groups/{id} (Leer Uno) ---
 
 // Prueba leer uno con éxito (HTTP 200) [cite: 239-240]
@@ -208,6 +241,69 @@ TEST(GroupControllerTest, UpdateGroup_Returns404_WhenNotFound) {
     ASSERT_EQ(res.code, 404);
 }
 
+// --- Pruebas para PATCH /tournaments/{id}/groups/{id}/teams (Inscripción) ---
+
+TEST(GroupControllerTest, AddTeams_Returns204_OnSuccess) {
+    auto mockDelegate = std::make_shared<MockGroupDelegate>();
+    GroupController controller(mockDelegate);
+    const std::string teamId = "00000000-0000-0000-0000-000000000001";
+
+    EXPECT_CALL(*mockDelegate, AddTeams("tourn-1", "g1", std::vector<std::string>{teamId}))
+        .WillOnce(Return(std::expected<void, IGroupDelegate::AddTeamsError>()));
+
+    crow::request req;
+    req.body = R"([{"id": ")" + teamId + R"("}])";
+    crow::response res = controller.AddTeams(req, "tourn-1", "g1");
+
+    ASSERT_EQ(res.code, 204);
+}
+
+TEST(GroupControllerTest, AddTeams_Returns409_WhenGroupIsFull) {
+    auto mockDelegate = std::make_shared<MockGroupDelegate>();
+    GroupController controller(mockDelegate);
+
+    EXPECT_CALL(*mockDelegate, AddTeams(_, _, _))
+        .WillOnce(Return(std::unexpected(IGroupDelegate::AddTeamsError::GroupFull)));
+
+    crow::request req;
+    req.body = R"({"id": "00000000-0000-0000-0000-000000000005"})";
+    crow::response res = controller.AddTeams(req, "tourn-1", "g1");
+
+    ASSERT_EQ(res.code, 409);
+}
+
+TEST(GroupControllerTest, AddTeams_MapsEachErrorToItsStatus) {
+    auto mockDelegate = std::make_shared<MockGroupDelegate>();
+    GroupController controller(mockDelegate);
+
+    crow::request req;
+    req.body = R"([{"id": "00000000-0000-0000-0000-000000000005"}])";
+    const std::vector<std::pair<IGroupDelegate::AddTeamsError, int>> cases{
+        {IGroupDelegate::AddTeamsError::GroupNotFound, 404},
+        {IGroupDelegate::AddTeamsError::AlreadyRegistered, 409},
+        {IGroupDelegate::AddTeamsError::TeamNotFound, 422},
+        {IGroupDelegate::AddTeamsError::Unknown, 500},
+    };
+    for (const auto& [error, status] : cases) {
+        EXPECT_CALL(*mockDelegate, AddTeams(_, _, _)).WillOnce(Return(std::unexpected(error)));
+        EXPECT_EQ(controller.AddTeams(req, "tourn-1", "g1").code, status);
+    }
+}
+
+TEST(GroupControllerTest, AddTeams_Returns400_OnInvalidTeamId) {
+    auto mockDelegate = std::make_shared<MockGroupDelegate>();
+    GroupController controller(mockDelegate);
+
+    EXPECT_CALL(*mockDelegate, AddTeams(_, _, _)).Times(0);
+
+    crow::request req;
+    req.body = R"([{"id": "not-a-uuid"}])";
+    ASSERT_EQ(controller.AddTeams(req, "tourn-1", "g1").code, 400);
+
+    req.body = "[]";
+    ASSERT_EQ(controller.AddTeams(req, "tourn-1", "g1").code, 400);
+}
+
 // --- Pruebas para DELETE /tournaments/{id}/groups/{id} (Borrado) ---
 // (Estas no estaban explícitamente en tu lista, pero son parte del CRUD)
 
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "controller/MetricsController.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/cache/CacheMetricsRegistry.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
+#include "crow.h"
+#include <nlohmann/json.hpp>
+#include <memory>
+
+using ::testing::Return;
+
+class MockDbConnectionProvider : public IDbConnectionProvider {
+public:
+    MOCK_METHOD(PooledConnection, Connection, (), (override));
+    MOCK_METHOD(ConnectionPoolMetrics, Metrics, (), (const, override));
+};
+
+// Prueba que los contadores del pool se exponen en GET /metrics
+TEST(MetricsControllerTest, GetMetrics_ReturnsConnectionPoolCounters) {
+    auto mockProvider = std::make_shared<MockDbConnectionProvider>();
+    MetricsController controller(mockProvider, std::make_shared<CacheMetricsRegistry>());
+
+    ConnectionPoolMetrics metrics;
+    metrics.maxSize = 8;
+    metrics.open = 3;
+    metrics.idle = 1;
+    metrics.inUse = 2;
+    metrics.exhausted = 5;
+    metrics.totalWaitMicros = 1200;
+
+    EXPECT_CALL(*mockProvider, Metrics())
+        .WillOnce(Return(metrics));
+
+    crow::response res = controller.GetMetrics();
+
+    ASSERT_EQ(res.code, 200);
+    auto body = nlohmann::json::parse(res.body);
+    EXPECT_EQ(body["connectionPool"]["maxSize"], 8);
+    EXPECT_EQ(body["connectionPool"]["inUse"], 2);
+    EXPECT_EQ(body["connectionPool"]["exhausted"], 5);
+    EXPECT_EQ(body["connectionPool"]["totalWaitMicros"], 1200);
+}
+
+// Prueba que los contadores de cada caché registrado se exponen bajo "caches"
+TEST(MetricsControllerTest, GetMetrics_ReturnsCacheCounters) {
+    auto mockProvider = std::make_shared<MockDbConnectionProvider>();
+    auto cacheMetrics = std::make_shared<CacheMetricsRegistry>();
+    cacheMetrics->Register("teams", [] {
+        CacheMetrics metrics;
+        metrics.size = 10;
+        metrics.hits = 90;
+        metrics.negativeHits = 4;
+        metrics.misses = 10;
+        return metrics;
+    });
+    MetricsController controller(mockProvider, cacheMetrics);
+
+    EXPECT_CALL(*mockProvider, Metrics())
+        .WillOnce(Return(ConnectionPoolMetrics{}));
+
+    crow::response res = controller.GetMetrics();
+
+    ASSERT_EQ(res.code, 200);
+    auto body = nlohmann::json::parse(res.body);
+    EXPECT_EQ(body["caches"]["teams"]["size"], 10);
+    EXPECT_EQ(body["caches"]["teams"]["hits"], 90);
+    EXPECT_EQ(body["caches"]["teams"]["negativeHits"], 4);
+    EXPECT_EQ(body["caches"]["teams"]["misses"], 10);
+}
+
+// Prueba que la latencia por sentencia se expone bajo "queries"
+TEST(MetricsControllerTest, GetMetrics_ReturnsQueryStatistics) {
+    auto mockProvider = std::make_shared<MockDbConnectionProvider>();
+    MetricsController controller(mockProvider, std::make_shared<CacheMetricsRegistry>());
+    QueryStatistics::Instance().Record(statements::team::ReadById.name, std::chrono::milliseconds(1), 1);
+
+    EXPECT_CALL(*mockProvider, Metrics())
+        .WillOnce(Return(ConnectionPoolMetrics{}));
+
+    crow::response res = controller.GetMetrics();
+
+    ASSERT_EQ(res.code, 200);
+    auto body = nlohmann::json::parse(res.body);
+    const auto& query = body["queries"][statements::team::ReadById.name];
+    EXPECT_GE(query["calls"].get<uint64_t>(), 1);
+    EXPECT_TRUE(query.contains("p99Micros"));
+    EXPECT_TRUE(query.contains("errorsBySqlState"));
+}
@@ -1,23 +1,31 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "controller/TeamController.hpp"
+#include "controller/Pagination.hpp"
 #include "delegate/ITeamDelegate.hpp"
 #include "domain/Team.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
 #include "crow.h"
 #include <expected>
+#include <span>
 #include <vector>
 #include <memory>
 
 using ::testing::Return;
 using ::testing::_;
+using ::testing::Invoke;
 
 class MockTeamDelegate : public ITeamDelegate {
 public:
     MOCK_METHOD((std::expected<std::string, SaveError>), SaveTeam, (const domain::Team& team), (override));
     MOCK_METHOD(std::shared_ptr<domain::Team>, GetTeam, (std::string_view id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, GetAllTeams, (), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, GetTeams, (std::span<const std::string> ids), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, GetTeamsPage, (const PageRequest& page), (override));
     MOCK_METHOD((std::expected<void, SaveError>), UpdateTeam, (std::string_view id, const domain::Team& team), (override));
     MOCK_METHOD((std::expected<void, SaveError>), DeleteTeam, (std::string_view id), (override));
+    MOCK_METHOD((std::expected<std::vector<std::string>, SaveError>), ImportTeams, (const std::vector<domain::Team>& teams), (override));
 };
 
 // --- Pruebas para POST /teams (Creación) ---
@@ -54,6 +62,26 @@ TEST(TeamControllerTest, SaveTeam_Returns409_OnConflict) {
     ASSERT_EQ(res.code, 409);
 }
 
+// Prueba cuerpos inválidos (HTTP 400): texto que no es JSON y JSON sin "name"
+TEST(TeamControllerTest, SaveTeam_Returns400_OnInvalidBody) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+
+    EXPECT_CALL(*mockDelegate, SaveTeam(_)).Times(0);
+
+    crow::request notJson;
+    notJson.body = "{\"name\":";
+    crow::response res = controller.SaveTeam(notJson);
+    ASSERT_EQ(res.code, 400);
+    ASSERT_EQ(res.body, "{\"error\":\"Invalid JSON format\"}");
+
+    crow::request withoutName;
+    withoutName.body = "{\"nombre\":\"New Team\"}";
+    res = controller.SaveTeam(withoutName);
+    ASSERT_EQ(res.code, 400);
+    ASSERT_EQ(res.body, "{\"error\":\"JSON parsing error\"}");
+}
+
 // --- Pruebas para GET /teams/{id} (Búsqueda por ID) ---
 
 // Prueba búsqueda por ID exitosa (HTTP 200)
@@ -66,7 +94,9 @@ TEST(TeamControllerTest, GetTeamById_Returns200_WhenFound) {
     EXPECT_CALL(*mockDelegate, GetTeam(teamId))
         .WillOnce(Return(team));
 
-    crow::response res = controller.getTeam(teamId);
+    crow::request req;
+    crow::response res;
+    controller.getTeam(req, res, teamId);
 
     ASSERT_EQ(res.code, 200);
     nlohmann::json body = nlohmann::json::parse(res.body);
@@ -83,14 +113,33 @@ TEST(TeamControllerTest, GetTeamById_Returns404_WhenNotFound) {
     EXPECT_CALL(*mockDelegate, GetTeam(teamId))
         .WillOnce(Return(nullptr));
 
-    crow::response res = controller.getTeam(teamId);
+    crow::request req;
+    crow::response res;
+    controller.getTeam(req, res, teamId);
 
     ASSERT_EQ(res.code, 404);
 }
 
+// El error que llega al callback asíncrono se traduce igual que en REGISTER_ROUTE (HTTP 503)
+TEST(TeamControllerTest, GetTeamById_Returns503_WhenPoolExhausted) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+
+    EXPECT_CALL(*mockDelegate, GetTeam(_))
+        .WillOnce(Invoke([](std::string_view) -> std::shared_ptr<domain::Team> {
+            throw ConnectionAcquireTimeout("Timed out waiting for a database connection");
+        }));
+
+    crow::request req;
+    crow::response res;
+    controller.getTeam(req, res, "any-id");
+
+    ASSERT_EQ(res.code, 503);
+}
+
 // --- Pruebas para GET /teams (Búsqueda de todos) ---
 
-// Prueba búsqueda de todos con resultados (HTTP 200)
+// Prueba búsqueda sin paginación: se sirve la primera página de DefaultLimit (HTTP 200)
 TEST(TeamControllerTest, GetAllTeams_Returns200_WithListOfTeams) {
     auto mockDelegate = std::make_shared<MockTeamDelegate>();
     TeamController controller(mockDelegate);
@@ -99,28 +148,34 @@ TEST(TeamControllerTest, GetAllTeams_Returns200_WithListOfTeams) {
         std::make_shared<domain::Team>(domain::Team{"id2", "Team Two"})
     };
 
-    EXPECT_CALL(*mockDelegate, GetAllTeams())
-        .WillOnce(Return(teams));
+    EXPECT_CALL(*mockDelegate, GetTeamsPage(_))
+        .WillOnce(Invoke([&teams](const PageRequest& page) {
+            EXPECT_FALSE(page.after.has_value());
+            EXPECT_EQ(page.limit, pagination::DefaultLimit + 1);
+            return teams;
+        }));
 
-    crow::response res = controller.getAllTeams();
+    crow::request req;
+    crow::response res = controller.getAllTeams(req);
     
     ASSERT_EQ(res.code, 200);
     nlohmann::json body = nlohmann::json::parse(res.body);
     ASSERT_TRUE(body.is_array());
     ASSERT_EQ(body.size(), 2);
     ASSERT_EQ(body[0]["name"], "Team One");
+    ASSERT_EQ(res.get_header_value("Link"), "");
 }
 
 // Prueba búsqueda de todos con lista vacía (HTTP 200)
 TEST(TeamControllerTest, GetAllTeams_Returns200_WithEmptyList) {
     auto mockDelegate = std::make_shared<MockTeamDelegate>();
     TeamController controller(mockDelegate);
-    std::vector<std::shared_ptr<domain::Team>> emptyList;
 
-    EXPECT_CALL(*mockDelegate, GetAllTeams())
-        .WillOnce(Return(emptyList));
+    EXPECT_CALL(*mockDelegate, GetTeamsPage(_))
+        .WillOnce(Return(std::vector<std::shared_ptr<domain::Team>>{}));
 
-    crow::response res = controller.getAllTeams();
+    crow::request req;
+    crow::response res = controller.getAllTeams(req);
 
     ASSERT_EQ(res.code, 200);
     nlohmann::json body = nlohmann::json::parse(res.body);
@@ -128,6 +183,151 @@ TEST(TeamControllerTest, GetAllTeams_Returns200_WithEmptyList) {
     ASSERT_EQ(body.size(), 0);
 }
 
+// Prueba que sin limit la respuesta no crece con la tabla: trae DefaultLimit equipos y el
+// enlace a la siguiente página (HTTP 200)
+TEST(TeamControllerTest, GetAllTeams_WithoutLimit_IsBoundedAndLinksNextPage) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+    std::vector<std::shared_ptr<domain::Team>> teams;
+    for (size_t i = 0; i <= pagination::DefaultLimit; i++) {
+        teams.push_back(std::make_shared<domain::Team>(domain::Team{GenerateUuid(), "Team " + std::to_string(i)}));
+    }
+
+    EXPECT_CALL(*mockDelegate, GetTeamsPage(_))
+        .WillOnce(Return(teams));
+
+    crow::request req;
+    req.url = "/teams";
+    crow::response res = controller.getAllTeams(req);
+
+    ASSERT_EQ(res.code, 200);
+    ASSERT_EQ(nlohmann::json::parse(res.body).size(), pagination::DefaultLimit);
+    const auto cursor = pagination::EncodeCursor(teams[pagination::DefaultLimit - 1]->Id());
+    ASSERT_EQ(res.get_header_value("Link"),
+              "</teams?limit=" + std::to_string(pagination::DefaultLimit) + "&after=" + cursor + ">; rel=\"next\"");
+}
+
+// Prueba primera página: se pide una fila de más y se anuncia la siguiente página (HTTP 200)
+TEST(TeamControllerTest, GetAllTeams_WithLimit_ReturnsPageAndNextLink) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+    std::vector<std::shared_ptr<domain::Team>> teams = {
+        std::make_shared<domain::Team>(domain::Team{"00000000-0000-0000-0000-000000000001", "Team One"}),
+        std::make_shared<domain::Team>(domain::Team{"00000000-0000-0000-0000-000000000002", "Team Two"}),
+        std::make_shared<domain::Team>(domain::Team{"00000000-0000-0000-0000-000000000003", "Team Three"})
+    };
+
+    EXPECT_CALL(*mockDelegate, GetTeamsPage(_))
+        .WillOnce(Invoke([&teams](const PageRequest& page) {
+            EXPECT_FALSE(page.after.has_value());
+            EXPECT_EQ(page.limit, 3u);
+            return teams;
+        }));
+
+    crow::request req;
+    req.url = "/teams";
+    req.url_params = crow::query_string("?limit=2");
+    crow::response res = controller.getAllTeams(req);
+
+    ASSERT_EQ(res.code, 200);
+    nlohmann::json body = nlohmann::json::parse(res.body);
+    ASSERT_EQ(body.size(), 2);
+    const auto cursor = pagination::EncodeCursor("00000000-0000-0000-0000-000000000002");
+    ASSERT_EQ(res.get_header_value("Link"), "</teams?limit=2&after=" + cursor + ">; rel=\"next\"");
+}
+
+// Prueba página siguiente: el cursor se decodifica y la última página no trae Link (HTTP 200)
+TEST(TeamControllerTest, GetAllTeams_WithCursor_ReturnsLastPage) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+    const std::string lastSeenId = "00000000-0000-0000-0000-000000000002";
+
+    EXPECT_CALL(*mockDelegate, GetTeamsPage(_))
+        .WillOnce(Invoke([&lastSeenId](const PageRequest& page) {
+            EXPECT_EQ(page.after, lastSeenId);
+            return std::vector<std::shared_ptr<domain::Team>>{
+                std::make_shared<domain::Team>(domain::Team{"00000000-0000-0000-0000-000000000003", "Team Three"})
+            };
+        }));
+
+    crow::request req;
+    req.url = "/teams";
+    req.url_params = crow::query_string("?limit=2&after=" + pagination::EncodeCursor(lastSeenId));
+    crow::response res = controller.getAllTeams(req);
+
+    ASSERT_EQ(res.code, 200);
+    ASSERT_EQ(nlohmann::json::parse(res.body).size(), 1);
+    ASSERT_EQ(res.get_header_value("Link"), "");
+}
+
+// Prueba parámetros de paginación inválidos (HTTP 400)
+TEST(TeamControllerTest, GetAllTeams_Returns400_OnInvalidPageParameters) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+
+    EXPECT_CALL(*mockDelegate, GetTeamsPage(_)).Times(0);
+
+    crow::request badLimit;
+    badLimit.url_params = crow::query_string("?limit=abc");
+    ASSERT_EQ(controller.getAllTeams(badLimit).code, 400);
+
+    crow::request badCursor;
+    badCursor.url_params = crow::query_string("?after=not-a-cursor");
+    ASSERT_EQ(controller.getAllTeams(badCursor).code, 400);
+}
+
+// Prueba búsqueda por varios ids: una sola llamada al delegate, sin repetidos (HTTP 200)
+TEST(TeamControllerTest, GetAllTeams_WithIds_ReturnsRequestedTeams) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+    const std::string id1 = "00000000-0000-0000-0000-000000000001";
+    const std::string id2 = "00000000-0000-0000-0000-000000000002";
+
+    EXPECT_CALL(*mockDelegate, GetTeamsPage(_)).Times(0);
+    EXPECT_CALL(*mockDelegate, GetTeams(_))
+        .WillOnce(Invoke([&](std::span<const std::string> ids) {
+            EXPECT_EQ(std::vector<std::string>(ids.begin(), ids.end()), (std::vector<std::string>{id1, id2}));
+            return std::vector<std::shared_ptr<domain::Team>>{
+                std::make_shared<domain::Team>(domain::Team{id1, "Team One"}),
+                std::make_shared<domain::Team>(domain::Team{id2, "Team Two"})
+            };
+        }));
+
+    crow::request req;
+    req.url = "/teams";
+    req.url_params = crow::query_string("?ids=" + id1 + "," + id2 + "," + id1);
+    crow::response res = controller.getAllTeams(req);
+
+    ASSERT_EQ(res.code, 200);
+    nlohmann::json body = nlohmann::json::parse(res.body);
+    ASSERT_EQ(body.size(), 2);
+    ASSERT_EQ(body[1]["id"], id2);
+}
+
+// Prueba ids inválidos o vacíos (HTTP 400)
+TEST(TeamControllerTest, GetAllTeams_WithIds_Returns400_OnInvalidId) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+
+    EXPECT_CALL(*mockDelegate, GetTeams(_)).Times(0);
+
+    crow::request badId;
+    badId.url_params = crow::query_string("?ids=00000000-0000-0000-0000-000000000001,not-a-uuid");
+    ASSERT_EQ(controller.getAllTeams(badId).code, 400);
+
+    crow::request empty;
+    empty.url_params = crow::query_string("?ids=");
+    ASSERT_EQ(controller.getAllTeams(empty).code, 400);
+
+    // segmentos vacíos: coma final, inicial o doble
+    const std::string id = "00000000-0000-0000-0000-000000000001";
+    for (const auto& ids : {id + ",", "," + id, id + ",," + id}) {
+        crow::request emptySegment;
+        emptySegment.url_params = crow::query_string("?ids=" + ids);
+        EXPECT_EQ(controller.getAllTeams(emptySegment).code, 400) << ids;
+    }
+}
+
 // --- Pruebas para PATCH /teams/{id} (Actualización) ---
 
 // Prueba actualización exitosa (HTTP 204)
@@ -190,4 +390,70 @@ TEST(TeamControllerTest, DeleteTeam_Returns404_WhenNotFound) {
     crow::response res = controller.DeleteTeam(teamId);
     
     ASSERT_EQ(res.code, 404);
-}
\ No newline at end of file
+}
+
+// --- Pruebas para POST /teams/import (Importación masiva) ---
+
+// Prueba importación con arreglo JSON (HTTP 201, ids en orden)
+TEST(TeamControllerTest, ImportTeams_Returns201_WithJsonArray) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+    std::vector<domain::Team> expectedTeams{{"", "Team A"}, {"", "Team B"}};
+    std::vector<std::string> ids{"id-a", "id-b"};
+
+    EXPECT_CALL(*mockDelegate, ImportTeams(expectedTeams))
+        .WillOnce(Return(std::expected<std::vector<std::string>, ITeamDelegate::SaveError>(ids)));
+
+    crow::request req;
+    req.body = "[{\"name\":\"Team A\"},{\"name\":\"Team B\"}]";
+    crow::response res = controller.ImportTeams(req);
+
+    ASSERT_EQ(res.code, 201);
+    nlohmann::json body = nlohmann::json::parse(res.body);
+    ASSERT_EQ(body, nlohmann::json(ids));
+}
+
+// Prueba importación con NDJSON (HTTP 201)
+TEST(TeamControllerTest, ImportTeams_Returns201_WithNdjson) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+    std::vector<domain::Team> expectedTeams{{"", "Team A"}, {"", "Team B"}};
+
+    EXPECT_CALL(*mockDelegate, ImportTeams(expectedTeams))
+        .WillOnce(Return(std::expected<std::vector<std::string>, ITeamDelegate::SaveError>(std::vector<std::string>{"id-a", "id-b"})));
+
+    crow::request req;
+    req.body = "{\"name\":\"Team A\"}\n\n{\"name\":\"Team B\"}\n";
+    crow::response res = controller.ImportTeams(req);
+
+    ASSERT_EQ(res.code, 201);
+}
+
+// Prueba importación con un elemento inválido (HTTP 400)
+TEST(TeamControllerTest, ImportTeams_Returns400_OnInvalidBody) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+
+    EXPECT_CALL(*mockDelegate, ImportTeams(_)).Times(0);
+
+    crow::request req;
+    req.body = "{\"name\":\"Team A\"}\n{\"nombre\":\"Team B\"}";
+    crow::response res = controller.ImportTeams(req);
+
+    ASSERT_EQ(res.code, 400);
+}
+
+// Prueba importación fallida en la BD (HTTP 500)
+TEST(TeamControllerTest, ImportTeams_Returns500_WhenImportFails) {
+    auto mockDelegate = std::make_shared<MockTeamDelegate>();
+    TeamController controller(mockDelegate);
+
+    EXPECT_CALL(*mockDelegate, ImportTeams(_))
+        .WillOnce(Return(std::unexpected(ITeamDelegate::SaveError::Unknown)));
+
+    crow::request req;
+    req.body = "[{\"name\":\"Team A\"}]";
+    crow::response res = controller.ImportTeams(req);
+
+    ASSERT_EQ(res.code, 500);
+}
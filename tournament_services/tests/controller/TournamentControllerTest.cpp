@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "controller/TournamentController.hpp"
+#include "controller/Pagination.hpp"
 #include "delegate/ITournamentDelegate.hpp"
 #include "domain/Tournament.hpp"
+#include "persistence/repository/IdGenerator.hpp"
 #include "crow.h"
 #include <expected>
 #include <vector>
@@ -10,6 +12,7 @@
 // Usamos 'using' para simplificar las llamadas a los matchers de gmock
 using ::testing::Return;
 using ::testing::_; // El comodín para "cualquier argumento"
+using ::testing::Invoke;
 
 // Clase Mock para simular el TournamentDelegate
 class MockTournamentDelegate : public ITournamentDelegate {
@@ -17,7 +20,9 @@ public:
     // Mocks para todos los métodos de la interfaz ITournamentDelegate
     MOCK_METHOD((std::expected<std::string, SaveError>), CreateTournament, (std::shared_ptr<domain::Tournament> tournament), (override));
     MOCK_METHOD(std::shared_ptr<domain::Tournament>, GetTournament, (std::string_view id), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Tournament>, GetTournamentAggregate, (std::string_view id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, GetAllTournaments, (), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, GetTournamentsPage, (const PageRequest& page), (override));
     MOCK_METHOD((std::expected<void, SaveError>), UpdateTournament, (std::string_view id, const domain::Tournament& tournament), (override));
     MOCK_METHOD((std::expected<void, SaveError>), DeleteTournament, (std::string_view id), (override));
 };
@@ -78,7 +83,9 @@ TEST(TournamentControllerTest, GetTournamentById_Returns200_WhenFound) {
         .WillOnce(Return(tournament));
 
     // Acción
-    crow::response res = controller.GetTournament(tournamentId);
+    crow::request req;
+    crow::response res;
+    controller.GetTournament(req, res, tournamentId);
 
     // Verificación [cite: 142-143]
     ASSERT_EQ(res.code, 200);
@@ -98,12 +105,52 @@ TEST(TournamentControllerTest, GetTournamentById_Returns404_WhenNotFound) {
         .WillOnce(Return(nullptr));
 
     // Acción
-    crow::response res = controller.GetTournament(tournamentId);
+    crow::request req;
+    crow::response res;
+    controller.GetTournament(req, res, tournamentId);
 
     // Verificación [cite: 144-145]
     ASSERT_EQ(res.code, 404);
 }
 
+// --- Pruebas para GET /tournaments/{id}/full (Agregado) ---
+
+TEST(TournamentControllerTest, GetTournamentAggregate_Returns200_WithGroupsAndMatches) {
+    auto mockDelegate = std::make_shared<MockTournamentDelegate>();
+    TournamentController controller(mockDelegate);
+    auto tournament = std::make_shared<domain::Tournament>("World Cup");
+    tournament->Id() = "tournament-1";
+    domain::Group group("Group A", "group-1");
+    group.Teams().push_back(domain::Team{"team-1", "Mexico"});
+    tournament->Groups().push_back(group);
+    tournament->Matches().emplace_back("tournament-1", domain::MatchPhase::GROUP_STAGE, 1);
+
+    EXPECT_CALL(*mockDelegate, GetTournamentAggregate(std::string_view("tournament-1")))
+        .WillOnce(Return(tournament));
+
+    crow::response res = controller.GetTournamentAggregate("tournament-1");
+
+    ASSERT_EQ(res.code, 200);
+    nlohmann::json body = nlohmann::json::parse(res.body);
+    EXPECT_EQ(body["id"], "tournament-1");
+    ASSERT_EQ(body["groups"].size(), 1);
+    EXPECT_EQ(body["groups"][0]["teams"][0]["name"], "Mexico");
+    ASSERT_EQ(body["matches"].size(), 1);
+    EXPECT_EQ(body["matches"][0]["tournamentId"], "tournament-1");
+}
+
+TEST(TournamentControllerTest, GetTournamentAggregate_Returns404_WhenNotFound) {
+    auto mockDelegate = std::make_shared<MockTournamentDelegate>();
+    TournamentController controller(mockDelegate);
+
+    EXPECT_CALL(*mockDelegate, GetTournamentAggregate(_))
+        .WillOnce(Return(nullptr));
+
+    crow::response res = controller.GetTournamentAggregate("missing");
+
+    ASSERT_EQ(res.code, 404);
+}
+
 // --- Pruebas para GET /tournaments (Búsqueda de todos) ---
 
 TEST(TournamentControllerTest, GetAllTournaments_Returns200_WithListOfTournaments) {
@@ -119,12 +166,17 @@ TEST(TournamentControllerTest, GetAllTournaments_Returns200_WithListOfTournament
     tournaments[1]->Id() = "id2";
 
 
-    // Simular que el Delegate devuelve una lista con dos torneos
-    EXPECT_CALL(*mockDelegate, GetAllTournaments())
-        .WillOnce(Return(tournaments));
+    // Simular que el Delegate entrega dos torneos; sin limit se pide la primera página acotada
+    EXPECT_CALL(*mockDelegate, GetTournamentsPage(_))
+        .WillOnce(Invoke([&tournaments](const PageRequest& page) {
+            EXPECT_FALSE(page.after.has_value());
+            EXPECT_EQ(page.limit, pagination::DefaultLimit + 1);
+            return tournaments;
+        }));
 
     // Acción
-    crow::response res = controller.ReadAll();
+    crow::request req;
+    crow::response res = controller.ReadAll(req);
     
     // Verificación [cite: 146]
     ASSERT_EQ(res.code, 200);
@@ -138,14 +190,14 @@ TEST(TournamentControllerTest, GetAllTournaments_Returns200_WithEmptyList) {
     // Preparación
     auto mockDelegate = std::make_shared<MockTournamentDelegate>();
     TournamentController controller(mockDelegate);
-    std::vector<std::shared_ptr<domain::Tournament>> emptyList;
 
-    // Simular que el Delegate devuelve una lista vacía
-    EXPECT_CALL(*mockDelegate, GetAllTournaments())
-        .WillOnce(Return(emptyList));
+    // Simular que el Delegate no entrega ningún torneo
+    EXPECT_CALL(*mockDelegate, GetTournamentsPage(_))
+        .WillOnce(Return(std::vector<std::shared_ptr<domain::Tournament>>{}));
 
     // Acción
-    crow::response res = controller.ReadAll();
+    crow::request req;
+    crow::response res = controller.ReadAll(req);
 
     // Verificación [cite: 147]
     ASSERT_EQ(res.code, 200);
@@ -154,6 +206,57 @@ TEST(TournamentControllerTest, GetAllTournaments_Returns200_WithEmptyList) {
     ASSERT_EQ(body.size(), 0);
 }
 
+TEST(TournamentControllerTest, GetAllTournaments_WithoutLimit_IsBoundedAndLinksNextPage) {
+    // Preparación
+    auto mockDelegate = std::make_shared<MockTournamentDelegate>();
+    TournamentController controller(mockDelegate);
+    std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+    for (size_t i = 0; i <= pagination::DefaultLimit; i++) {
+        auto tournament = std::make_shared<domain::Tournament>("Tournament " + std::to_string(i));
+        tournament->Id() = GenerateUuid();
+        tournaments.push_back(tournament);
+    }
+
+    // Simular una tabla con más torneos que DefaultLimit
+    EXPECT_CALL(*mockDelegate, GetTournamentsPage(_))
+        .WillOnce(Return(tournaments));
+
+    // Acción
+    crow::request req;
+    req.url = "/tournaments";
+    crow::response res = controller.ReadAll(req);
+
+    // Verificación: la respuesta no crece con la tabla y anuncia la siguiente página
+    ASSERT_EQ(res.code, 200);
+    ASSERT_EQ(nlohmann::json::parse(res.body).size(), pagination::DefaultLimit);
+    const auto cursor = pagination::EncodeCursor(tournaments[pagination::DefaultLimit - 1]->Id());
+    ASSERT_EQ(res.get_header_value("Link"),
+              "</tournaments?limit=" + std::to_string(pagination::DefaultLimit) + "&after=" + cursor + ">; rel=\"next\"");
+}
+
+TEST(TournamentControllerTest, GetAllTournaments_WithLimit_ReturnsPage) {
+    // Preparación
+    auto mockDelegate = std::make_shared<MockTournamentDelegate>();
+    TournamentController controller(mockDelegate);
+    auto tournament = std::make_shared<domain::Tournament>("Tournament One");
+    tournament->Id() = "00000000-0000-0000-0000-000000000001";
+
+    // Simular una sola página (menos filas que el límite)
+    EXPECT_CALL(*mockDelegate, GetTournamentsPage(_))
+        .WillOnce(Return(std::vector<std::shared_ptr<domain::Tournament>>{tournament}));
+
+    // Acción
+    crow::request req;
+    req.url = "/tournaments";
+    req.url_params = crow::query_string("?limit=10");
+    crow::response res = controller.ReadAll(req);
+
+    // Verificación
+    ASSERT_EQ(res.code, 200);
+    ASSERT_EQ(nlohmann::json::parse(res.body).size(), 1);
+    ASSERT_EQ(res.get_header_value("Link"), "");
+}
+
 // --- Pruebas para PATCH /tournaments/{id} (Actualización) ---
 
 TEST(TournamentControllerTest, UpdateTournament_Returns204_OnSuccess) {
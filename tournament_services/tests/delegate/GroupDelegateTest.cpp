@@ -2,10 +2,14 @@
 #include <gmock/gmock.h>
 #include "delegate/GroupDelegate.hpp"
 #include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/IGroupRepository.hpp"
 #include "domain/Group.hpp"
 #include "domain/Tournament.hpp"
 #include "domain/Team.hpp"
+#include "events/Events.hpp"
 #include <optional>
+#include <span>
+#include <utility>
 #include <vector>
 #include <memory>
 #include <string>
@@ -15,20 +19,27 @@ using ::testing::Return;
 using ::testing::_;
 using ::testing::Eq; // Para comparar objetos
 
+// Mocks en un namespace anónimo: TeamDelegateTest y TournamentDelegateTest definen otros con el mismo nombre
+namespace {
 // Mock del Repositorio de Grupos
-class MockGroupRepository : public IRepository<domain::Group, std::string> {
+class MockGroupRepository : public IGroupRepository {
 public:
     MOCK_METHOD(std::optional<std::string>, Create, (const domain::Group& entity), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateMany, (const std::vector<domain::Group>& entities), (override));
     MOCK_METHOD(std::shared_ptr<domain::Group>, ReadById, (std::string id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, ReadAll, (), (override));
     MOCK_METHOD(std::string, Update, (const domain::Group& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, FindByTournamentId, (const std::string& tournamentId), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, ReadPageByTournamentId, (const std::string& tournamentId, const PageRequest& page), (override));
+    MOCK_METHOD(std::optional<TeamsRegistration>, AddTeams, (const std::string& tournamentId, const std::string& groupId, std::span<const std::string> teamIds, int maxTeams), (override));
 };
 
 // Mock del Repositorio de Torneos
 class MockTournamentRepository : public IRepository<domain::Tournament, std::string> {
 public:
     MOCK_METHOD(std::optional<std::string>, Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateMany, (const std::vector<domain::Tournament>& entities), (override));
     MOCK_METHOD(std::shared_ptr<domain::Tournament>, ReadById, (std::string id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
     MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
@@ -39,11 +50,14 @@ public:
 class MockTeamRepository : public IRepository<domain::Team, std::string> {
 public:
     MOCK_METHOD(std::optional<std::string>, Create, (const domain::Team& entity), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateMany, (const std::vector<domain::Team>& entities), (override));
     MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string id), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadByIds, (std::span<const std::string> ids), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
     MOCK_METHOD(std::string, Update, (const domain::Team& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
 };
+}
 
 // --- Pruebas para Creación de Grupo ---
 
@@ -160,6 +174,34 @@ TEST(GroupDelegateTest, GetGroup_ReturnsError_WhenNotFound) {
     EXPECT_EQ(result.error(), "Group not found in this tournament");
 }
 
+TEST(GroupDelegateTest, GetGroups_FiltersByTournamentInRepository) {
+    // Preparación
+    auto mockGroupRepo = std::make_shared<MockGroupRepository>();
+    auto mockTournRepo = std::make_shared<MockTournamentRepository>();
+    auto mockTeamRepo = std::make_shared<MockTeamRepository>();
+    GroupDelegate delegate(mockTournRepo, mockGroupRepo, mockTeamRepo);
+
+    std::string tournamentId = "tourn-1";
+    auto groupA = std::make_shared<domain::Group>("Group A");
+    groupA->TournamentId() = tournamentId;
+    auto groupB = std::make_shared<domain::Group>("Group B");
+    groupB->TournamentId() = tournamentId;
+
+    // El filtro por torneo se resuelve en SQL; no se lee la tabla completa
+    EXPECT_CALL(*mockGroupRepo, FindByTournamentId(tournamentId))
+        .WillOnce(Return(std::vector<std::shared_ptr<domain::Group>>{groupA, groupB}));
+    EXPECT_CALL(*mockGroupRepo, ReadAll()).Times(0);
+
+    // Acción
+    auto result = delegate.GetGroups(tournamentId);
+
+    // Verificación
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result.value().size(), 2);
+    EXPECT_EQ(result.value()[0].Name(), "Group A");
+    EXPECT_EQ(result.value()[1].Name(), "Group B");
+}
+
 // --- Pruebas para Actualización ---
 
 // [cite: 272, 273]
@@ -218,4 +260,176 @@ TEST(GroupDelegateTest, UpdateGroup_ReturnsError_WhenNotFound) {
     // Verificación
     ASSERT_FALSE(result.has_value()); // Regresar valor usando expected
     EXPECT_EQ(result.error(), "Group not found in this tournament");
-}
\ No newline at end of file
+}
+
+// --- Pruebas para Listado Paginado ---
+
+TEST(GroupDelegateTest, GetGroupsPage_QueriesOnlyTheTournamentPage) {
+    // Preparación
+    auto mockGroupRepo = std::make_shared<MockGroupRepository>();
+    auto mockTournRepo = std::make_shared<MockTournamentRepository>();
+    auto mockTeamRepo = std::make_shared<MockTeamRepository>();
+    GroupDelegate delegate(mockTournRepo, mockGroupRepo, mockTeamRepo);
+
+    std::string tournamentId = "tourn-1";
+    auto group = std::make_shared<domain::Group>("Group A");
+    group->TournamentId() = tournamentId;
+    PageRequest page{.after = "00000000-0000-0000-0000-000000000001", .limit = 10};
+
+    // La página se resuelve en el repositorio, sin leer la tabla completa
+    EXPECT_CALL(*mockGroupRepo, ReadPageByTournamentId(tournamentId, _))
+        .WillOnce(Return(std::vector<std::shared_ptr<domain::Group>>{group}));
+    EXPECT_CALL(*mockGroupRepo, ReadAll()).Times(0);
+
+    // Acción
+    auto result = delegate.GetGroupsPage(tournamentId, page);
+
+    // Verificación
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result.value().size(), 1);
+    EXPECT_EQ(result.value()[0].Name(), "Group A");
+}
+
+namespace {
+    const std::string TeamA = "00000000-0000-0000-0000-00000000000a";
+    const std::string TeamB = "00000000-0000-0000-0000-00000000000b";
+
+    domain::Group GroupWithTeams(const std::vector<std::string>& teamIds) {
+        domain::Group group("Group Alpha");
+        for (const auto& id : teamIds) {
+            group.Teams().push_back(domain::Team{id, "Team " + id});
+        }
+        return group;
+    }
+}
+
+// Prueba que los equipos del grupo se validan en un solo ReadByIds, sin un ReadById por equipo
+TEST(GroupDelegateTest, CreateGroup_ValidatesTeamsInOneBatch) {
+    auto mockTournRepo = std::make_shared<MockTournamentRepository>();
+    auto mockGroupRepo = std::make_shared<MockGroupRepository>();
+    auto mockTeamRepo = std::make_shared<MockTeamRepository>();
+    GroupDelegate delegate(mockTournRepo, mockGroupRepo, mockTeamRepo);
+
+    EXPECT_CALL(*mockTournRepo, ReadById("tourn-1"))
+        .WillOnce(Return(std::make_shared<domain::Tournament>("Existing Tournament")));
+    std::vector<std::string> requested;
+    EXPECT_CALL(*mockTeamRepo, ReadByIds(_))
+        .WillOnce([&requested](std::span<const std::string> ids) {
+            requested.assign(ids.begin(), ids.end());
+            // el repositorio no garantiza el orden
+            return std::vector<std::shared_ptr<domain::Team>>{
+                std::make_shared<domain::Team>(TeamB, "B"), std::make_shared<domain::Team>(TeamA, "A")};
+        });
+    EXPECT_CALL(*mockTeamRepo, ReadById(_)).Times(0);
+    EXPECT_CALL(*mockGroupRepo, Create(_)).WillOnce(Return(std::optional<std::string>("group-1")));
+
+    auto result = delegate.CreateGroup("tourn-1", GroupWithTeams({TeamA, TeamB}));
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(requested, (std::vector<std::string>{TeamA, TeamB}));
+}
+
+// Prueba que el error nombra al equipo que falta, no al primero del lote
+TEST(GroupDelegateTest, CreateGroup_ReportsTheMissingTeam) {
+    auto mockTournRepo = std::make_shared<MockTournamentRepository>();
+    auto mockGroupRepo = std::make_shared<MockGroupRepository>();
+    auto mockTeamRepo = std::make_shared<MockTeamRepository>();
+    GroupDelegate delegate(mockTournRepo, mockGroupRepo, mockTeamRepo);
+
+    EXPECT_CALL(*mockTournRepo, ReadById("tourn-1"))
+        .WillOnce(Return(std::make_shared<domain::Tournament>("Existing Tournament")));
+    EXPECT_CALL(*mockTeamRepo, ReadByIds(_))
+        .WillOnce(Return(std::vector<std::shared_ptr<domain::Team>>{std::make_shared<domain::Team>(TeamA, "A")}));
+    EXPECT_CALL(*mockGroupRepo, Create(_)).Times(0);
+
+    auto result = delegate.CreateGroup("tourn-1", GroupWithTeams({TeamA, TeamB}));
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), "Team with id " + TeamB + " not found");
+}
+
+// Prueba que un id mal formado se rechaza antes de consultar: en ANY($1::uuid[]) haría fallar todo el lote
+TEST(GroupDelegateTest, CreateGroup_RejectsMalformedTeamIdBeforeQuerying) {
+    auto mockTournRepo = std::make_shared<MockTournamentRepository>();
+    auto mockGroupRepo = std::make_shared<MockGroupRepository>();
+    auto mockTeamRepo = std::make_shared<MockTeamRepository>();
+    GroupDelegate delegate(mockTournRepo, mockGroupRepo, mockTeamRepo);
+
+    EXPECT_CALL(*mockTournRepo, ReadById("tourn-1"))
+        .WillOnce(Return(std::make_shared<domain::Tournament>("Existing Tournament")));
+    EXPECT_CALL(*mockTeamRepo, ReadByIds(_)).Times(0);
+    EXPECT_CALL(*mockGroupRepo, Create(_)).Times(0);
+
+    auto result = delegate.CreateGroup("tourn-1", GroupWithTeams({TeamA, "team-b"}));
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), "Invalid team id team-b");
+}
+
+// --- Pruebas para Inscripción de Equipos ---
+
+TEST(GroupDelegateTest, AddTeams_RegistersBatchAndPublishesEvents) {
+    // Preparación
+    auto mockGroupRepo = std::make_shared<MockGroupRepository>();
+    auto mockTournRepo = std::make_shared<MockTournamentRepository>();
+    auto mockTeamRepo = std::make_shared<MockTeamRepository>();
+    GroupDelegate delegate(mockTournRepo, mockGroupRepo, mockTeamRepo);
+
+    std::vector<std::string> published;
+    auto eventBus = events::EventBus::Instance();
+    eventBus->Clear();
+    eventBus->Subscribe("TeamRegisteredToGroup", [&published](const events::Event& event) {
+        const auto& registered = dynamic_cast<const events::TeamRegisteredToGroupEvent&>(event);
+        published.push_back(registered.GroupId() + "/" + registered.TeamId());
+    });
+
+    // El lote entero va en una sola transacción; el grupo nunca se lee completo
+    std::vector<std::string> batch;
+    EXPECT_CALL(*mockGroupRepo, AddTeams("tourn-1", "g1", _, domain::Group::DefaultMaxTeams))
+        .WillOnce([&batch](auto, auto, std::span<const std::string> teamIds, int) {
+            batch.assign(teamIds.begin(), teamIds.end());
+            return TeamsRegistration{TeamRegistration::Registered, {}};
+        });
+    EXPECT_CALL(*mockGroupRepo, ReadById(_)).Times(0);
+    EXPECT_CALL(*mockGroupRepo, Update(_)).Times(0);
+
+    // Acción
+    auto result = delegate.AddTeams("tourn-1", "g1", {"t1", "t2"});
+    eventBus->Clear();
+
+    // Verificación
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(batch, (std::vector<std::string>{"t1", "t2"}));
+    EXPECT_EQ(published, (std::vector<std::string>{"g1/t1", "g1/t2"}));
+}
+
+// Prueba que cada motivo de rechazo del repositorio llega como su propio error y sin eventos
+TEST(GroupDelegateTest, AddTeams_MapsRejectionToTypedErrorWithoutEvents) {
+    auto mockGroupRepo = std::make_shared<MockGroupRepository>();
+    auto mockTournRepo = std::make_shared<MockTournamentRepository>();
+    auto mockTeamRepo = std::make_shared<MockTeamRepository>();
+    GroupDelegate delegate(mockTournRepo, mockGroupRepo, mockTeamRepo);
+
+    int published = 0;
+    auto eventBus = events::EventBus::Instance();
+    eventBus->Clear();
+    eventBus->Subscribe("TeamRegisteredToGroup", [&published](const events::Event&) { ++published; });
+
+    const std::vector<std::pair<std::optional<TeamsRegistration>, IGroupDelegate::AddTeamsError>> cases{
+        {TeamsRegistration{TeamRegistration::GroupNotFound, {}}, IGroupDelegate::AddTeamsError::GroupNotFound},
+        {TeamsRegistration{TeamRegistration::TeamNotFound, "t6"}, IGroupDelegate::AddTeamsError::TeamNotFound},
+        {TeamsRegistration{TeamRegistration::AlreadyRegistered, "t5"}, IGroupDelegate::AddTeamsError::AlreadyRegistered},
+        {TeamsRegistration{TeamRegistration::GroupFull, "t6"}, IGroupDelegate::AddTeamsError::GroupFull},
+        {std::nullopt, IGroupDelegate::AddTeamsError::Unknown},
+    };
+    for (const auto& [registration, expected] : cases) {
+        EXPECT_CALL(*mockGroupRepo, AddTeams("tourn-1", "g1", _, _)).WillOnce(Return(registration));
+
+        auto result = delegate.AddTeams("tourn-1", "g1", {"t5", "t6"});
+
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), expected);
+    }
+    eventBus->Clear();
+    EXPECT_EQ(published, 0);
+}
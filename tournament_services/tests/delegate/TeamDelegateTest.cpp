@@ -19,6 +19,7 @@ public:
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
     MOCK_METHOD(std::string, Update, (const domain::Team& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateMany, (const std::vector<domain::Team>& entities), (override));
 };
 
 // --- Pruebas para Creación ---
@@ -144,4 +145,35 @@ TEST(TeamDelegateTest, UpdateTeam_ReturnsNotFound_WhenTeamDoesNotExist) {
 
     ASSERT_FALSE(result.has_value());
     ASSERT_EQ(result.error(), ITeamDelegate::SaveError::NotFound);
-}
\ No newline at end of file
+}
+
+// --- Pruebas para Importación masiva ---
+
+TEST(TeamDelegateTest, ImportTeams_ReturnsIdsInOrder) {
+    auto mockRepo = std::make_shared<MockTeamRepository>();
+    TeamDelegate delegate(mockRepo);
+    std::vector<domain::Team> teams{{"", "Team A"}, {"", "Team B"}};
+    std::vector<std::string> ids{"id-a", "id-b"};
+
+    EXPECT_CALL(*mockRepo, CreateMany(Eq(teams)))
+        .WillOnce(Return(ids));
+
+    auto result = delegate.ImportTeams(teams);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), ids);
+}
+
+TEST(TeamDelegateTest, ImportTeams_ReturnsError_WhenRepositoryFails) {
+    auto mockRepo = std::make_shared<MockTeamRepository>();
+    TeamDelegate delegate(mockRepo);
+    std::vector<domain::Team> teams{{"", "Team A"}, {"", "Team B"}};
+
+    EXPECT_CALL(*mockRepo, CreateMany(_))
+        .WillOnce(Return(std::vector<std::string>{}));
+
+    auto result = delegate.ImportTeams(teams);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ITeamDelegate::SaveError::Unknown);
+}
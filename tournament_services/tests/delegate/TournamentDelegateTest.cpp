@@ -1,7 +1,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "delegate/TournamentDelegate.hpp"
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITournamentRepository.hpp"
 #include "domain/Tournament.hpp"
 #include "cms/IQueueMessageProducer.hpp" // ✅ CAMBIO: Se incluye la INTERFAZ
 #include <optional>
@@ -17,13 +17,15 @@ using ::testing::Eq; // Para comparar objetos
 // --- Mocks Necesarios ---
 
 // Mock del Repositorio de Torneos
-class MockTournamentRepository : public IRepository<domain::Tournament, std::string> {
+class MockTournamentRepository : public ITournamentRepository {
 public:
     MOCK_METHOD(std::optional<std::string>, Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateMany, (const std::vector<domain::Tournament>& entities), (override));
     MOCK_METHOD(std::shared_ptr<domain::Tournament>, ReadById, (std::string id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
     MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Tournament>, ReadAggregateById, (const std::string& id), (override));
 };
 
 // ✅ CAMBIO: El MockProducer ahora hereda de la INTERFAZ IQueueMessageProducer
@@ -41,7 +43,7 @@ TEST(TournamentDelegateTest, CreateTournament_Success) {
     auto mockRepo = std::make_shared<MockTournamentRepository>();
     // ✅ CAMBIO: Se crea el mock sin argumentos
     auto mockProducer = std::make_shared<MockQueueMessageProducer>(); 
-    TournamentDelegate delegate(mockRepo, mockProducer);
+    TournamentDelegate delegate(mockRepo, mockProducer, mockRepo);
     
     auto newTournament = std::make_shared<domain::Tournament>("Summer Cup");
     std::string expectedId = "tourn-uuid-456";
@@ -65,7 +67,7 @@ TEST(TournamentDelegateTest, CreateTournament_Conflict) {
     // Preparación
     auto mockRepo = std::make_shared<MockTournamentRepository>();
     auto mockProducer = std::make_shared<MockQueueMessageProducer>();
-    TournamentDelegate delegate(mockRepo, mockProducer);
+    TournamentDelegate delegate(mockRepo, mockProducer, mockRepo);
 
     auto existingTournament = std::make_shared<domain::Tournament>("Winter Cup");
 
@@ -90,7 +92,7 @@ TEST(TournamentDelegateTest, GetTournament_ReturnsTournament_WhenFound) {
     // Preparación
     auto mockRepo = std::make_shared<MockTournamentRepository>();
     auto mockProducer = std::make_shared<MockQueueMessageProducer>();
-    TournamentDelegate delegate(mockRepo, mockProducer);
+    TournamentDelegate delegate(mockRepo, mockProducer, mockRepo);
 
     std::string tournamentId = "t1";
     auto expectedTournament = std::make_shared<domain::Tournament>("Tournament One");
@@ -114,7 +116,7 @@ TEST(TournamentDelegateTest, GetTournament_ReturnsNull_WhenNotFound) {
     // Preparación
     auto mockRepo = std::make_shared<MockTournamentRepository>();
     auto mockProducer = std::make_shared<MockQueueMessageProducer>();
-    TournamentDelegate delegate(mockRepo, mockProducer);
+    TournamentDelegate delegate(mockRepo, mockProducer, mockRepo);
     
     // Simular que el repositorio no encuentra nada
     EXPECT_CALL(*mockRepo, ReadById(_))
@@ -127,6 +129,25 @@ TEST(TournamentDelegateTest, GetTournament_ReturnsNull_WhenNotFound) {
     ASSERT_EQ(result, nullptr);
 }
 
+// Prueba que el agregado se lee con ReadAggregateById y no con ReadById
+TEST(TournamentDelegateTest, GetTournamentAggregate_ReadsAggregateFromRepository) {
+    auto mockRepo = std::make_shared<MockTournamentRepository>();
+    auto mockProducer = std::make_shared<MockQueueMessageProducer>();
+    TournamentDelegate delegate(mockRepo, mockProducer, mockRepo);
+
+    auto aggregate = std::make_shared<domain::Tournament>("Tournament One");
+    aggregate->Groups().emplace_back("Group A");
+
+    EXPECT_CALL(*mockRepo, ReadAggregateById("t1"))
+        .WillOnce(Return(aggregate));
+    EXPECT_CALL(*mockRepo, ReadById(_)).Times(0);
+
+    auto result = delegate.GetTournamentAggregate("t1");
+
+    ASSERT_EQ(result, aggregate);
+    ASSERT_EQ(result->Groups().size(), 1);
+}
+
 // --- Pruebas para Búsqueda de Todos ---
 
 // Prueba de búsqueda de todos con resultados
@@ -134,7 +155,7 @@ TEST(TournamentDelegateTest, GetAllTournaments_ReturnsListOfTournaments) {
     // Preparación
     auto mockRepo = std::make_shared<MockTournamentRepository>();
     auto mockProducer = std::make_shared<MockQueueMessageProducer>();
-    TournamentDelegate delegate(mockRepo, mockProducer);
+    TournamentDelegate delegate(mockRepo, mockProducer, mockRepo);
 
     std::vector<std::shared_ptr<domain::Tournament>> tournaments = {
         std::make_shared<domain::Tournament>("Tournament One")
@@ -156,7 +177,7 @@ TEST(TournamentDelegateTest, GetAllTournaments_ReturnsEmptyList) {
     // Preparación
     auto mockRepo = std::make_shared<MockTournamentRepository>();
     auto mockProducer = std::make_shared<MockQueueMessageProducer>();
-    TournamentDelegate delegate(mockRepo, mockProducer);
+    TournamentDelegate delegate(mockRepo, mockProducer, mockRepo);
     
     // Simular que el repositorio devuelve una lista vacía
     EXPECT_CALL(*mockRepo, ReadAll())
@@ -176,7 +197,7 @@ TEST(TournamentDelegateTest, UpdateTournament_ReturnsSuccess_WhenTournamentExist
     // Preparación
     auto mockRepo = std::make_shared<MockTournamentRepository>();
     auto mockProducer = std::make_shared<MockQueueMessageProducer>();
-    TournamentDelegate delegate(mockRepo, mockProducer);
+    TournamentDelegate delegate(mockRepo, mockProducer, mockRepo);
 
     std::string tournamentId = "existing-tourn-id";
     auto existingTournament = std::make_shared<domain::Tournament>("Original Name");
@@ -203,7 +224,7 @@ TEST(TournamentDelegateTest, UpdateTournament_ReturnsNotFound_WhenTournamentDoes
     // Preparación
     auto mockRepo = std::make_shared<MockTournamentRepository>();
     auto mockProducer = std::make_shared<MockQueueMessageProducer>();
-    TournamentDelegate delegate(mockRepo, mockProducer);
+    TournamentDelegate delegate(mockRepo, mockProducer, mockRepo);
 
     std::string tournamentId = "non-existing-tourn-id";
     domain::Tournament updatedTournament("Updated Name");
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "persistence/configuration/AsyncQueryExecutor.hpp"
+#include "persistence/configuration/StatementRegistry.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+// Sin BD: el puerto 1 rechaza la conexión y la petición vence en la cola
+TEST(AsyncQueryExecutorTest, TimesOutWhileNoConnectionIsAvailable) {
+    AsyncQueryExecutor executor("host=127.0.0.1 port=1 connect_timeout=1", 1, 100ms, 50ms, 200ms);
+
+    auto future = executor.Execute(statements::team::ReadById, {"00000000-0000-0000-0000-000000000000"});
+
+    ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+    auto result = future.get();
+    EXPECT_EQ(result.status, AsyncQueryResult::Status::TimedOut);
+    EXPECT_EQ(executor.TimedOut(), 1);
+}
+
+// Prueba que un callback que lanza algo que no es std::exception no detiene el reactor
+TEST(AsyncQueryExecutorTest, SurvivesCallbackThrowingNonStandardException) {
+    AsyncQueryExecutor executor("host=127.0.0.1 port=1 connect_timeout=1", 1, 100ms, 50ms, 200ms);
+
+    executor.Execute(statements::team::ReadById, {"00000000-0000-0000-0000-000000000000"}, [](AsyncQueryResult) { throw 42; });
+    auto future = executor.Execute(statements::team::ReadById, {"00000000-0000-0000-0000-000000000000"});
+
+    ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+    EXPECT_EQ(future.get().status, AsyncQueryResult::Status::TimedOut);
+    EXPECT_EQ(executor.TimedOut(), 2);
+}
+
+TEST(AsyncQueryExecutorTest, StopFailsQueuedRequests) {
+    AsyncQueryExecutor executor("host=127.0.0.1 port=1 connect_timeout=1", 1, 10s);
+    auto future = executor.Execute(statements::team::ReadById, {"00000000-0000-0000-0000-000000000000"});
+
+    executor.Stop();
+
+    ASSERT_EQ(future.wait_for(1s), std::future_status::ready);
+    EXPECT_EQ(future.get().status, AsyncQueryResult::Status::Failed);
+}
+
+// Contra una BD real; sin TOURNAMENT_DB_URL la prueba se omite.
+class AsyncQueryExecutorDatabaseTest : public ::testing::Test {
+protected:
+    const char* url = nullptr;
+
+    void SetUp() override {
+        url = std::getenv("TOURNAMENT_DB_URL");
+        if (url == nullptr) {
+            GTEST_SKIP() << "TOURNAMENT_DB_URL is not set";
+        }
+    }
+};
+
+TEST_F(AsyncQueryExecutorDatabaseTest, ServesManyInFlightRequestsWithFewConnections) {
+    AsyncQueryExecutor executor(url, 2, 10s);
+
+    std::vector<std::future<AsyncQueryResult>> futures;
+    for (int i = 0; i < 500; i++) {
+        futures.push_back(executor.Execute(statements::team::ReadById, {"00000000-0000-0000-0000-000000000000"}));
+    }
+
+    for (auto& future : futures) {
+        ASSERT_EQ(future.wait_for(10s), std::future_status::ready);
+        auto result = future.get();
+        EXPECT_TRUE(result.Ok()) << result.error;
+        EXPECT_TRUE(result.rows.empty());
+    }
+    EXPECT_EQ(executor.Completed(), 500);
+}
+
+TEST_F(AsyncQueryExecutorDatabaseTest, ReportsQueryErrorsAndKeepsTheConnection) {
+    AsyncQueryExecutor executor(url, 1, 10s);
+
+    auto invalid = executor.Execute(statements::team::ReadById, {"not-a-uuid"}).get();
+    auto valid = executor.Execute(statements::team::ReadAll, {}).get();
+
+    EXPECT_EQ(invalid.status, AsyncQueryResult::Status::Failed);
+    EXPECT_FALSE(invalid.error.empty());
+    EXPECT_TRUE(valid.Ok()) << valid.error;
+    EXPECT_EQ(executor.Reconnects(), 0);
+}
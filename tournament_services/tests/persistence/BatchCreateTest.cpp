@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "persistence/repository/GroupRepository.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include "persistence/repository/TeamRepository.hpp"
+#include "persistence/repository/TournamentRepository.hpp"
+#include "persistence/repository/TypedMatchRepository.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+// CreateMany de cada repositorio contra una BD real (V005 aplicada); sin TOURNAMENT_DB_URL la
+// prueba se omite. Cada lote se guarda completo o no se guarda nada.
+class BatchCreateTest : public ::testing::Test {
+protected:
+    std::shared_ptr<TeamRepository> teams;
+    std::shared_ptr<TournamentRepository> tournaments;
+    std::shared_ptr<GroupRepository> groups;
+    std::shared_ptr<repository::TypedMatchRepository> matches;
+    std::vector<std::string> createdTeams;
+    std::vector<std::string> createdTournaments;
+    std::vector<std::string> createdGroups;
+
+    void SetUp() override {
+        const char* url = std::getenv("TOURNAMENT_DB_URL");
+        if (url == nullptr) {
+            GTEST_SKIP() << "TOURNAMENT_DB_URL is not set";
+        }
+        auto provider = std::make_shared<PostgresConnectionProvider>(url, 1);
+        teams = std::make_shared<TeamRepository>(provider);
+        tournaments = std::make_shared<TournamentRepository>(provider);
+        groups = std::make_shared<GroupRepository>(provider);
+        matches = std::make_shared<repository::TypedMatchRepository>(provider);
+    }
+
+    void TearDown() override {
+        if (!teams) return;
+        for (const auto& id : createdGroups) groups->Delete(id);
+        for (const auto& id : createdTournaments) tournaments->Delete(id);
+        for (const auto& id : createdTeams) teams->Delete(id);
+    }
+};
+
+TEST_F(BatchCreateTest, Teams_ReturnsIdsInInputOrder) {
+    const std::vector<domain::Team> batch{{"", "Batch 1"}, {"", "Batch 2"}, {"", "Batch 3"}};
+
+    createdTeams = teams->CreateMany(batch);
+
+    ASSERT_EQ(createdTeams.size(), batch.size());
+    for (size_t i = 0; i < batch.size(); i++) {
+        const auto stored = teams->ReadById(createdTeams[i]);
+        ASSERT_NE(stored, nullptr);
+        EXPECT_EQ(stored->Name(), batch[i].Name());
+    }
+}
+
+// Prueba que un id mal formado en ReadByIds se omite en lugar de hacer fallar ANY($1::uuid[]) para todos
+TEST_F(BatchCreateTest, Teams_ReadByIdsSkipsMalformedIds) {
+    createdTeams = teams->CreateMany({domain::Team{"", "Batch 1"}, domain::Team{"", "Batch 2"}});
+    ASSERT_EQ(createdTeams.size(), 2);
+
+    const std::vector<std::string> ids{createdTeams[0], "not-a-uuid", createdTeams[1], ""};
+    EXPECT_EQ(teams->ReadByIds(ids).size(), 2);
+    EXPECT_TRUE(teams->ReadByIds(std::vector<std::string>{"not-a-uuid"}).empty());
+}
+
+TEST_F(BatchCreateTest, TournamentsAndGroups_ReturnIdsInInputOrder) {
+    createdTournaments = tournaments->CreateMany({domain::Tournament("Batch A"), domain::Tournament("Batch B")});
+    ASSERT_EQ(createdTournaments.size(), 2);
+    ASSERT_NE(tournaments->ReadById(createdTournaments[1]), nullptr);
+    EXPECT_EQ(tournaments->ReadById(createdTournaments[1])->Name(), "Batch B");
+
+    std::vector<domain::Group> batch{domain::Group("Grupo A"), domain::Group("Grupo B")};
+    for (auto& group : batch) group.TournamentId() = createdTournaments[0];
+    createdGroups = groups->CreateMany(batch);
+
+    ASSERT_EQ(createdGroups.size(), 2);
+    for (size_t i = 0; i < batch.size(); i++) {
+        const auto stored = groups->ReadById(createdGroups[i]);
+        ASSERT_NE(stored, nullptr);
+        EXPECT_EQ(stored->Name(), batch[i].Name());
+        EXPECT_EQ(stored->TournamentId(), createdTournaments[0]);
+    }
+}
+
+// Prueba que una fila inválida a mitad del lote (equipo inexistente) no deja guardadas las anteriores
+TEST_F(BatchCreateTest, Matches_FailedRowLeavesNothingStored) {
+    createdTeams = teams->CreateMany({domain::Team{"", "Batch local"}, domain::Team{"", "Batch visitante"}});
+    ASSERT_EQ(createdTeams.size(), 2);
+
+    const auto tournamentId = GenerateUuid();
+    std::vector<domain::Match> batch;
+    for (int number = 1; number <= 3; number++) {
+        domain::Match match(tournamentId, domain::MatchPhase::GROUP_STAGE, number);
+        match.SetTeam1(createdTeams[0]);
+        match.SetTeam2(number == 2 ? GenerateUuid() : createdTeams[1]);
+        batch.push_back(match);
+    }
+
+    EXPECT_TRUE(matches->CreateMany(batch).empty());
+    EXPECT_TRUE(matches->FindByTournamentId(tournamentId).empty());
+}
+
+// Prueba que AddTeams inscribe el lote completo o nada: un equipo inexistente a mitad del lote
+// deshace los anteriores, y un repetido se informa como tal aunque el grupo tenga cupo
+TEST_F(BatchCreateTest, GroupAddTeams_RejectedTeamLeavesBatchUnregistered) {
+    createdTournaments = tournaments->CreateMany({domain::Tournament("Batch inscripción")});
+    ASSERT_EQ(createdTournaments.size(), 1);
+    domain::Group group("Grupo lote");
+    group.TournamentId() = createdTournaments[0];
+    createdGroups = groups->CreateMany({group});
+    ASSERT_EQ(createdGroups.size(), 1);
+    createdTeams = teams->CreateMany({domain::Team{"", "Batch 1"}, domain::Team{"", "Batch 2"}});
+    ASSERT_EQ(createdTeams.size(), 2);
+
+    const std::vector<std::string> rejected{createdTeams[0], GenerateUuid(), createdTeams[1]};
+    const auto failed = groups->AddTeams(createdTournaments[0], createdGroups[0], rejected, domain::Group::DefaultMaxTeams);
+    ASSERT_TRUE(failed.has_value());
+    EXPECT_EQ(failed->status, TeamRegistration::TeamNotFound);
+    EXPECT_EQ(failed->teamId, rejected[1]);
+    EXPECT_TRUE(groups->ReadById(createdGroups[0])->Teams().empty());
+
+    const auto registered = groups->AddTeams(createdTournaments[0], createdGroups[0], createdTeams, domain::Group::DefaultMaxTeams);
+    ASSERT_TRUE(registered.has_value());
+    EXPECT_EQ(registered->status, TeamRegistration::Registered);
+    EXPECT_EQ(groups->ReadById(createdGroups[0])->Teams().size(), 2);
+
+    const auto duplicate = groups->AddTeams(createdTournaments[0], createdGroups[0], std::vector{createdTeams[1]}, domain::Group::DefaultMaxTeams);
+    ASSERT_TRUE(duplicate.has_value());
+    EXPECT_EQ(duplicate->status, TeamRegistration::AlreadyRegistered);
+}
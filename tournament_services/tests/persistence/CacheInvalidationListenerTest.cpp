@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+#include "persistence/cache/CacheInvalidationListener.hpp"
+#include <string>
+#include <vector>
+
+// Dispatch se prueba sin BD: es lo que el hilo del listener ejecuta por cada NOTIFY
+TEST(CacheInvalidationListenerTest, Dispatch_EvictsIdFromSubscribedEntity) {
+    CacheInvalidationListener listener("");
+    std::vector<std::string> evictedTeams;
+    std::vector<std::string> evictedTournaments;
+    listener.Subscribe("teams", {[&](const std::string& id) { evictedTeams.push_back(id); }, [] {}});
+    listener.Subscribe("tournaments", {[&](const std::string& id) { evictedTournaments.push_back(id); }, [] {}});
+
+    listener.Dispatch("teams:6f1c2a3e-0000-4000-8000-000000000001");
+
+    ASSERT_EQ(evictedTeams.size(), 1);
+    EXPECT_EQ(evictedTeams[0], "6f1c2a3e-0000-4000-8000-000000000001");
+    EXPECT_TRUE(evictedTournaments.empty());
+    EXPECT_EQ(listener.Received(), 1);
+}
+
+TEST(CacheInvalidationListenerTest, Dispatch_IgnoresUnknownEntitiesAndMalformedPayloads) {
+    CacheInvalidationListener listener("");
+    int evictions = 0;
+    listener.Subscribe("teams", {[&](const std::string&) { evictions++; }, [] {}});
+
+    listener.Dispatch("groups:6f1c2a3e-0000-4000-8000-000000000001");
+    listener.Dispatch("teams");
+
+    EXPECT_EQ(evictions, 0);
+}
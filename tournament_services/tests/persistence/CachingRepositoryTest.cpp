@@ -0,0 +1,354 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "persistence/repository/CachingRepository.hpp"
+#include "persistence/cache/ShardedLruCache.hpp"
+#include "persistence/configuration/ReadYourWritesSession.hpp"
+#include "domain/Team.hpp"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ::testing::Return;
+using ::testing::_;
+
+// Repositorio decorado; en un namespace anónimo para no chocar con los mocks de los delegates
+namespace {
+class MockTeamRepository : public IRepository<domain::Team, std::string> {
+public:
+    MOCK_METHOD(std::optional<std::string>, Create, (const domain::Team& entity), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateMany, (const std::vector<domain::Team>& entities), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string id), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadByIds, (std::span<const std::string> ids), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
+    MOCK_METHOD(std::string, Update, (const domain::Team& entity), (override));
+    MOCK_METHOD(void, Delete, (std::string id), (override));
+};
+}
+
+class CachingRepositoryTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockTeamRepository> mockRepository = std::make_shared<MockTeamRepository>();
+
+    CachingRepository<domain::Team> MakeRepository(CacheConfiguration configuration = {}) {
+        return CachingRepository<domain::Team>(mockRepository, configuration);
+    }
+};
+
+TEST_F(CachingRepositoryTest, ReadById_SecondReadIsServedFromCache) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "Mexico")));
+
+    auto first = repository.ReadById("team-1");
+    auto second = repository.ReadById("team-1");
+
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->Name(), "Mexico");
+    // cada llamador recibe su propia copia
+    EXPECT_NE(first.get(), second.get());
+    EXPECT_EQ(repository.Metrics().hits, 1);
+    EXPECT_EQ(repository.Metrics().misses, 1);
+}
+
+TEST_F(CachingRepositoryTest, ReadByIdAsync_SharesCacheWithReadById) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "Mexico")));
+
+    std::shared_ptr<domain::Team> asyncResult;
+    repository.ReadByIdAsync("team-1", [&asyncResult](auto team) { asyncResult = team.value(); });
+    auto syncResult = repository.ReadById("team-1");
+
+    ASSERT_NE(asyncResult, nullptr);
+    ASSERT_NE(syncResult, nullptr);
+    EXPECT_EQ(syncResult->Name(), "Mexico");
+    EXPECT_EQ(repository.Metrics().hits, 1);
+}
+
+TEST_F(CachingRepositoryTest, ReadByIdAsync_DoesNotCacheErrors) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .WillOnce([](std::string) -> std::shared_ptr<domain::Team> { throw std::runtime_error("pool exhausted"); })
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "Mexico")));
+
+    bool failed = false;
+    repository.ReadByIdAsync("team-1", [&failed](auto team) { failed = !team.has_value(); });
+
+    EXPECT_TRUE(failed);
+    EXPECT_NE(repository.ReadById("team-1"), nullptr);
+}
+
+TEST_F(CachingRepositoryTest, Exists_AnswersFromCacheWithoutPopulatingIt) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "Mexico")));
+    EXPECT_CALL(*mockRepository, ReadById("team-2"))
+        .Times(2)
+        .WillRepeatedly(Return(std::make_shared<domain::Team>("team-2", "Canada")));
+
+    repository.ReadById("team-1");
+    EXPECT_TRUE(repository.Exists("team-1"));  // acierto: no llega al repositorio
+    EXPECT_TRUE(repository.Exists("team-2"));  // fallo: Exists del repositorio (ReadById por defecto)
+    EXPECT_NE(repository.ReadById("team-2"), nullptr);
+    EXPECT_EQ(repository.Metrics().hits, 1);
+}
+
+TEST_F(CachingRepositoryTest, ReadById_RemembersMissingIds) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, ReadById("missing"))
+        .WillOnce(Return(nullptr));
+
+    EXPECT_EQ(repository.ReadById("missing"), nullptr);
+    EXPECT_EQ(repository.ReadById("missing"), nullptr);
+
+    EXPECT_EQ(repository.Metrics().negativeHits, 1);
+}
+
+TEST_F(CachingRepositoryTest, Update_InvalidatesCachedEntity) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "Mexico")))
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "México")));
+    EXPECT_CALL(*mockRepository, Update(_))
+        .WillOnce(Return("team-1"));
+
+    repository.ReadById("team-1");
+    repository.Update(domain::Team{"team-1", "México"});
+    auto result = repository.ReadById("team-1");
+
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->Name(), "México");
+    EXPECT_EQ(repository.Metrics().invalidations, 1);
+}
+
+TEST_F(CachingRepositoryTest, Delete_InvalidatesCachedEntity) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "Mexico")))
+        .WillOnce(Return(nullptr));
+    EXPECT_CALL(*mockRepository, Delete("team-1"));
+
+    repository.ReadById("team-1");
+    repository.Delete("team-1");
+
+    EXPECT_EQ(repository.ReadById("team-1"), nullptr);
+}
+
+TEST_F(CachingRepositoryTest, Create_ClearsNegativeEntryForNewId) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .WillOnce(Return(nullptr))
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "Mexico")));
+    EXPECT_CALL(*mockRepository, Create(_))
+        .WillOnce(Return(std::optional<std::string>("team-1")));
+
+    EXPECT_EQ(repository.ReadById("team-1"), nullptr);
+    repository.Create(domain::Team{"", "Mexico"});
+
+    EXPECT_NE(repository.ReadById("team-1"), nullptr);
+}
+
+// Prueba que CreateMany pasa el lote completo y olvida los ids nuevos que estaban marcados como inexistentes
+TEST_F(CachingRepositoryTest, CreateMany_ClearsNegativeEntriesForNewIds) {
+    auto repository = MakeRepository();
+    const std::vector<domain::Team> teams{{"", "Mexico"}, {"", "Chile"}};
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .WillOnce(Return(nullptr))
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "Mexico")));
+    EXPECT_CALL(*mockRepository, CreateMany(teams))
+        .WillOnce(Return(std::vector<std::string>{"team-1", "team-2"}));
+
+    EXPECT_EQ(repository.ReadById("team-1"), nullptr);
+    EXPECT_EQ(repository.CreateMany(teams), (std::vector<std::string>{"team-1", "team-2"}));
+
+    EXPECT_NE(repository.ReadById("team-1"), nullptr);
+}
+
+namespace {
+    std::vector<std::string> IdsOf(const std::vector<std::shared_ptr<domain::Team>>& teams) {
+        std::vector<std::string> ids;
+        for (const auto& team : teams) ids.push_back(team->Id());
+        return ids;
+    }
+
+    // Repositorio decorado que devuelve los ids pedidos que están en known, en orden inverso
+    auto ReadKnownReversed(std::vector<std::string>& requested, std::vector<std::string> known) {
+        return [&requested, known](std::span<const std::string> ids) {
+            requested.assign(ids.begin(), ids.end());
+            std::vector<std::shared_ptr<domain::Team>> teams;
+            for (auto id = ids.rbegin(); id != ids.rend(); ++id) {
+                if (std::find(known.begin(), known.end(), *id) != known.end()) {
+                    teams.push_back(std::make_shared<domain::Team>(*id, "Team " + *id));
+                }
+            }
+            return teams;
+        };
+    }
+}
+
+// Prueba que solo los fallos van al repositorio, en un solo ReadByIds, y que el resultado sigue
+// el orden de la petición aunque mezcle aciertos del caché y filas leídas
+TEST_F(CachingRepositoryTest, ReadByIds_QueriesOnlyMissesAndKeepsRequestOrder) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, ReadById("b"))
+        .WillOnce(Return(std::make_shared<domain::Team>("b", "Team b")));
+    std::vector<std::string> requested;
+    EXPECT_CALL(*mockRepository, ReadByIds(_))
+        .WillOnce(ReadKnownReversed(requested, {"a", "c"}));
+
+    repository.ReadById("b");
+    const std::vector<std::string> ids{"a", "b", "c"};
+    const auto teams = repository.ReadByIds(ids);
+
+    EXPECT_EQ(requested, (std::vector<std::string>{"a", "c"}));
+    EXPECT_EQ(IdsOf(teams), ids);
+    EXPECT_EQ(repository.Metrics().hits, 1);
+}
+
+// Prueba que un id repetido se pide y se devuelve una sola vez, esté o no en el caché
+TEST_F(CachingRepositoryTest, ReadByIds_DeduplicatesRepeatedIds) {
+    auto repository = MakeRepository();
+    std::vector<std::string> requested;
+    EXPECT_CALL(*mockRepository, ReadByIds(_))
+        .WillOnce(ReadKnownReversed(requested, {"a", "b"}));
+
+    const std::vector<std::string> ids{"b", "a", "b", "a"};
+    EXPECT_EQ(IdsOf(repository.ReadByIds(ids)), (std::vector<std::string>{"b", "a"}));
+    EXPECT_EQ(requested, (std::vector<std::string>{"b", "a"}));
+
+    // segunda vez: todo sale del caché, sin repetidos
+    EXPECT_EQ(IdsOf(repository.ReadByIds(ids)), (std::vector<std::string>{"b", "a"}));
+}
+
+// Prueba que los ids que el repositorio no devolvió quedan en el caché negativo, tanto para
+// ReadByIds como para ReadById
+TEST_F(CachingRepositoryTest, ReadByIds_RemembersMissingIds) {
+    auto repository = MakeRepository();
+    std::vector<std::string> requested;
+    EXPECT_CALL(*mockRepository, ReadByIds(_))
+        .WillOnce(ReadKnownReversed(requested, {"a"}));
+    EXPECT_CALL(*mockRepository, ReadById(_)).Times(0);
+
+    const std::vector<std::string> ids{"a", "missing"};
+    EXPECT_EQ(IdsOf(repository.ReadByIds(ids)), (std::vector<std::string>{"a"}));
+    EXPECT_EQ(IdsOf(repository.ReadByIds(ids)), (std::vector<std::string>{"a"}));
+    EXPECT_EQ(repository.ReadById("missing"), nullptr);
+
+    EXPECT_EQ(repository.Metrics().negativeHits, 2);
+}
+
+TEST_F(CachingRepositoryTest, ReadById_ExpiredEntryIsReloaded) {
+    auto repository = MakeRepository(CacheConfiguration{.ttl = std::chrono::milliseconds(0)});
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .Times(2)
+        .WillRepeatedly(Return(std::make_shared<domain::Team>("team-1", "Mexico")));
+
+    repository.ReadById("team-1");
+    repository.ReadById("team-1");
+
+    EXPECT_EQ(repository.Metrics().expirations, 1);
+}
+
+TEST_F(CachingRepositoryTest, ReadById_EvictsLeastRecentlyUsedAtCapacity) {
+    auto repository = MakeRepository(CacheConfiguration{.capacity = 2, .shards = 1});
+    EXPECT_CALL(*mockRepository, ReadById(_))
+        .WillRepeatedly([](std::string id) { return std::make_shared<domain::Team>(id, "Team " + id); });
+
+    repository.ReadById("a");
+    repository.ReadById("b");
+    repository.ReadById("a"); // "b" pasa a ser el menos reciente
+    repository.ReadById("c");
+
+    EXPECT_EQ(repository.Metrics().size, 2);
+    EXPECT_EQ(repository.Metrics().evictions, 1);
+    repository.ReadById("a");
+    EXPECT_EQ(repository.Metrics().hits, 2);
+}
+
+TEST_F(CachingRepositoryTest, Evict_ReloadsEntityWrittenByAnotherReplica) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "Mexico")))
+        .WillOnce(Return(std::make_shared<domain::Team>("team-1", "México")));
+
+    repository.ReadById("team-1");
+    repository.Evict("team-1");
+    auto result = repository.ReadById("team-1");
+
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->Name(), "México");
+}
+
+namespace {
+    bool ReadingFromPrimary() {
+        const auto session = ReadYourWritesSession::Current();
+        return session != nullptr && session->ReadsPrimary(ReadYourWritesSession::Clock::now(), std::chrono::milliseconds(0));
+    }
+}
+
+// Prueba que tras un Evict la recarga lee del primario (una réplica atrasada devolvería la versión
+// anterior y quedaría cacheada), y que la primera carga sigue yendo a las réplicas
+TEST_F(CachingRepositoryTest, Evict_ReloadsThroughPrimary) {
+    auto repository = MakeRepository();
+    std::vector<bool> fromPrimary;
+    EXPECT_CALL(*mockRepository, ReadById("team-1"))
+        .Times(2)
+        .WillRepeatedly([&fromPrimary](std::string id) {
+            fromPrimary.push_back(ReadingFromPrimary());
+            return std::make_shared<domain::Team>(id, "Mexico");
+        });
+
+    repository.ReadById("team-1");
+    repository.Evict("team-1");
+    repository.ReadById("team-1");
+
+    EXPECT_EQ(fromPrimary, (std::vector<bool>{false, true}));
+    EXPECT_EQ(ReadYourWritesSession::Current(), nullptr);
+}
+
+namespace {
+    // shard = llave % número de shards
+    struct IdentityHash {
+        size_t operator()(int key) const { return static_cast<size_t>(key); }
+    };
+}
+
+// Prueba que una invalidación solo cancela las cargas en curso de su propio shard: escribir
+// otra llave en otro shard no impide que se guarde la lectura que se cruzó con ella
+TEST(ShardedLruCacheTest, Invalidate_CancelsOnlyFillsOfTheSameShard) {
+    ShardedLruCache<int, int, IdentityHash> cache(8, 2);
+    const auto ttl = std::chrono::minutes(1);
+
+    const auto generation = cache.Generation(0);
+    cache.Invalidate(1);
+    cache.PutIfUnchanged(0, 10, ttl, generation);
+    EXPECT_EQ(cache.Get(0), 10);
+
+    const auto stale = cache.Generation(2);
+    cache.Invalidate(4);
+    cache.PutIfUnchanged(2, 20, ttl, stale);
+    EXPECT_EQ(cache.Get(2), std::nullopt);
+}
+
+// Prueba que ReadByIds no cachea la versión leída de un id que se escribió durante la carga
+TEST_F(CachingRepositoryTest, ReadByIds_WriteDuringLoadIsNotCached) {
+    auto repository = MakeRepository();
+    EXPECT_CALL(*mockRepository, Update(_)).WillOnce(Return("b"));
+    EXPECT_CALL(*mockRepository, ReadByIds(_))
+        .WillOnce([&repository](std::span<const std::string> ids) {
+            repository.Update(domain::Team{"b", "Chile"});
+            std::vector<std::shared_ptr<domain::Team>> teams;
+            for (const auto& id : ids) teams.push_back(std::make_shared<domain::Team>(id, "Team " + id));
+            return teams;
+        });
+    EXPECT_CALL(*mockRepository, ReadById("b"))
+        .WillOnce(Return(std::make_shared<domain::Team>("b", "Chile")));
+
+    repository.ReadByIds(std::vector<std::string>{"a", "b"});
+    EXPECT_EQ(repository.ReadById("b")->Name(), "Chile");
+}
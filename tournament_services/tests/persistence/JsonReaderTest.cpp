@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "domain/Group.hpp"
+#include "domain/JsonReader.hpp"
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+
+using domain::json_reader::ReadError;
+
+namespace {
+    void ExpectSameMatch(const domain::Match& actual, const domain::Match& expected) {
+        EXPECT_EQ(nlohmann::json(actual).dump(), nlohmann::json(expected).dump());
+    }
+
+    domain::Match FromNlohmann(const std::string& json) {
+        domain::Match match;
+        from_json(nlohmann::json::parse(json), match);
+        return match;
+    }
+}
+
+// Prueba que cada entidad queda igual que con json::parse + from_json
+TEST(JsonReaderTest, Read_DecodesLikeFromJson) {
+    const std::string completed = R"({"groupId":"grupo \"A\" ñ","id":"m-1","matchNumber":3,"nextMatchId":"m-9","phase":"QUARTERFINALS",
+        "status":"COMPLETED","team1Id":"t-1","team1Score":2,"team2Id":"t-2","team2Score":1,"tournamentId":"tour-1"})";
+    const std::string pending = R"({"id":"m-2","tournamentId":"tour-1","phase":"DESCONOCIDA","team1Id":null,"team1Score":null,"extra":{"a":[1,2]}})";
+    for (const auto& json : {completed, pending, std::string("{}")}) {
+        domain::Match match;
+        ASSERT_TRUE(domain::json_reader::Read(json, match)) << json;
+        ExpectSameMatch(match, FromNlohmann(json));
+    }
+
+    domain::Group group;
+    ASSERT_TRUE(domain::json_reader::Read(R"({"id":"g-1","name":"Grupo A","tournamentId":"tour-1","teams":[{"id":"t-1","name":"Uno"},{"name":"Dos"}]})", group));
+    EXPECT_EQ(group.Id(), "g-1");
+    EXPECT_EQ(group.Name(), "Grupo A");
+    EXPECT_EQ(group.TournamentId(), "tour-1");
+    EXPECT_EQ(group.Teams(), (std::vector<domain::Team>{{"t-1", "Uno"}, {"", "Dos"}}));
+
+    domain::Tournament tournament;
+    ASSERT_TRUE(domain::json_reader::Read(R"({"id":"tour-1","name":"Mundial","format":null})", tournament));
+    EXPECT_EQ(tournament.Id(), "tour-1");
+    EXPECT_EQ(tournament.Name(), "Mundial");
+
+    std::vector<domain::Match> matches;
+    ASSERT_TRUE(domain::json_reader::Read("[" + completed + "," + pending + "]", matches));
+    ASSERT_EQ(matches.size(), 2);
+    ExpectSameMatch(matches[0], FromNlohmann(completed));
+    ExpectSameMatch(matches[1], FromNlohmann(pending));
+}
+
+// Prueba que se distingue el texto que no es JSON del JSON que no tiene la forma de la entidad
+TEST(JsonReaderTest, Read_ReportsInvalidJsonAndInvalidDocument) {
+    for (const std::string json : {"", "{", R"({"name":"A")", R"({"name":"A"} x)", R"({"name":"A",})", R"({"name" "A"})"}) {
+        domain::Team team;
+        const auto read = domain::json_reader::Read(json, team);
+        ASSERT_FALSE(read) << json;
+        EXPECT_EQ(read.error(), ReadError::InvalidJson) << json;
+    }
+    for (const std::string json : {"[]", "5", R"({"nombre":"A"})", R"({"name":5})", R"({"name":null})"}) {
+        domain::Team team;
+        const auto read = domain::json_reader::Read(json, team);
+        ASSERT_FALSE(read) << json;
+        EXPECT_EQ(read.error(), ReadError::InvalidDocument) << json;
+    }
+
+    domain::Match match;
+    const auto outOfRange = domain::json_reader::Read(R"({"matchNumber":4294967296})", match);
+    ASSERT_FALSE(outOfRange);
+    EXPECT_EQ(outOfRange.error(), ReadError::InvalidDocument);
+    EXPECT_THROW(domain::json_reader::ReadDocument("{", match), std::runtime_error);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include "persistence/repository/MatchRepository.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/PipelinedTransaction.hpp"
+#include "domain/Match.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+// Flujos en lote de MatchRepository (UpdateById, CreateLinked) contra una BD real;
+// sin TOURNAMENT_DB_URL la prueba se omite.
+class MatchRepositoryPipelineTest : public ::testing::Test {
+protected:
+    const std::string tournamentId = "pipeline-test-tournament";
+    std::shared_ptr<repository::MatchRepository> repository;
+
+    void SetUp() override {
+        const char* url = std::getenv("TOURNAMENT_DB_URL");
+        if (url == nullptr) {
+            GTEST_SKIP() << "TOURNAMENT_DB_URL is not set";
+        }
+        repository = std::make_shared<repository::MatchRepository>(std::make_shared<PostgresConnectionProvider>(url, 1));
+    }
+
+    void TearDown() override {
+        if (!repository) return;
+        for (const auto& match : repository->FindByTournamentId(tournamentId)) {
+            repository->Delete(match->Id());
+        }
+    }
+
+    domain::Match CreateMatch(int number) {
+        domain::Match match(tournamentId, domain::MatchPhase::QUARTERFINALS, number);
+        match.Team1Id() = "team-a";
+        match.Team2Id() = "team-b";
+        return repository->Save(match);
+    }
+};
+
+TEST_F(MatchRepositoryPipelineTest, Save_UpsertsAndReturnsStoredMatch) {
+    auto created = CreateMatch(1);
+    ASSERT_FALSE(created.Id().empty());
+    EXPECT_EQ(created.Team1Id(), "team-a");
+
+    created.SetScore(1, 0);
+    auto saved = repository->Save(created);
+
+    EXPECT_EQ(saved.Id(), created.Id());
+    EXPECT_EQ(saved.Team1Score(), 1);
+    EXPECT_EQ(repository->FindByTournamentId(tournamentId).size(), 1);
+}
+
+TEST_F(MatchRepositoryPipelineTest, UpdateById_PersistsModification) {
+    auto match = CreateMatch(1);
+
+    auto updated = repository->UpdateById(match.Id(), [](domain::Match& m) { m.SetScore(2, 1); });
+
+    ASSERT_NE(updated, nullptr);
+    auto stored = repository->ReadById(match.Id());
+    ASSERT_NE(stored, nullptr);
+    EXPECT_EQ(stored->Team1Score(), 2);
+    EXPECT_EQ(stored->Team2Score(), 1);
+}
+
+TEST_F(MatchRepositoryPipelineTest, UpdateById_RollsBackWhenModifyThrows) {
+    auto match = CreateMatch(1);
+
+    EXPECT_THROW(repository->UpdateById(match.Id(), [](domain::Match& m) {
+        m.SetScore(3, 0);
+        throw std::runtime_error("rejected");
+    }), std::runtime_error);
+
+    auto stored = repository->ReadById(match.Id());
+    ASSERT_NE(stored, nullptr);
+    EXPECT_FALSE(stored->Team1Score().has_value());
+    // la conexión volvió al pool fuera de la transacción y sigue sirviendo
+    EXPECT_NE(repository->UpdateById(match.Id(), [](domain::Match& m) { m.SetScore(1, 0); }), nullptr);
+}
+
+TEST_F(MatchRepositoryPipelineTest, UpdateById_ReturnsNullWhenMissing) {
+    EXPECT_EQ(repository->UpdateById("00000000-0000-0000-0000-000000000000", [](domain::Match&) {}), nullptr);
+}
+
+TEST_F(MatchRepositoryPipelineTest, CreateLinked_CreatesMatchAndLinksCompletedOne) {
+    auto completed = CreateMatch(1);
+
+    auto next = repository->CreateLinked(domain::Match(tournamentId, domain::MatchPhase::SEMIFINALS, 1), completed);
+
+    ASSERT_FALSE(next.Id().empty());
+    EXPECT_NE(repository->ReadById(next.Id()), nullptr);
+    auto storedCompleted = repository->ReadById(completed.Id());
+    ASSERT_NE(storedCompleted, nullptr);
+    EXPECT_EQ(storedCompleted->NextMatchId(), next.Id());
+}
+
+// Prueba que si el partido terminado ya no existe no queda creado el siguiente
+TEST_F(MatchRepositoryPipelineTest, CreateLinked_RollsBackWhenCompletedMatchIsMissing) {
+    domain::Match missing(tournamentId, domain::MatchPhase::QUARTERFINALS, 2);
+    missing.Id() = "00000000-0000-0000-0000-000000000000";
+
+    EXPECT_THROW(repository->CreateLinked(domain::Match(tournamentId, domain::MatchPhase::SEMIFINALS, 1), missing), std::runtime_error);
+    EXPECT_TRUE(repository->FindByTournamentIdAndPhase(tournamentId, domain::MatchPhase::SEMIFINALS).empty());
+}
+
+// Prueba que un partido con ids de equipo que no son UUID se lee junto con los demás resultados
+TEST_F(MatchRepositoryPipelineTest, FindCompletedResultsByGroupId_KeepsNonUuidTeamIds) {
+    const std::string groupId = "pipeline-test-group";
+    const std::string team1 = "0192f1c4-7b3a-7d2e-9a10-4c5d6e7f8091";
+    const std::string team2 = "0192f1c4-7b3a-7d2e-9a10-4c5d6e7f8092";
+
+    domain::Match legacy(tournamentId, domain::MatchPhase::GROUP_STAGE, 1);
+    legacy.SetGroupId(groupId);
+    legacy.Team1Id() = "team-a";
+    legacy.Team2Id() = "team-b";
+    legacy.SetScore(1, 0);
+    repository->Save(legacy);
+
+    domain::Match valid(tournamentId, domain::MatchPhase::GROUP_STAGE, 2);
+    valid.SetGroupId(groupId);
+    valid.Team1Id() = team1;
+    valid.Team2Id() = team2;
+    valid.SetScore(2, 1);
+    repository->Save(valid);
+
+    auto results = repository->FindCompletedResultsByGroupId(groupId);
+
+    ASSERT_EQ(results.size(), 2);
+    std::sort(results.begin(), results.end(), [](const auto& a, const auto& b) { return a.team1Score < b.team1Score; });
+    EXPECT_EQ(results[0].team1Id.ToString(), "team-a");
+    EXPECT_EQ(results[1].team1Id.ToString(), team1);
+    EXPECT_EQ(results[1].team2Score, 1);
+}
+
+// Prueba que el error de una sentencia del pipeline llega como pqxx::sql_error con su SQLSTATE,
+// que la sentencia siguiente del tramo no se aplica y que la conexión vuelve a pqxx usable
+TEST(PipelinedTransactionTest, FailedStatement_ThrowsSqlErrorAndReturnsConnection) {
+    const char* url = std::getenv("TOURNAMENT_DB_URL");
+    if (url == nullptr) {
+        GTEST_SKIP() << "TOURNAMENT_DB_URL is not set";
+    }
+    pqxx::connection connection(url);
+    StatementRegistry::PrepareAll(connection);
+    const std::string id = "7d1f3a52-0c4e-4b7a-9a51-2f6f3c0d9e11";
+
+    try {
+        PipelinedTransaction tx(connection);
+        const auto failed = tx.Execute(statements::match::ReadById, "not-a-uuid");
+        tx.Execute(statements::match::Insert, id, R"({"tournamentId": "pipeline-test-tournament"})");
+        tx.Retrieve(failed);
+        FAIL() << "Retrieve should throw";
+    } catch (const pqxx::sql_error& e) {
+        EXPECT_EQ(e.sqlstate(), "22P02");
+    }
+
+    ASSERT_TRUE(connection.is_open());
+    pqxx::work tx(connection);
+    EXPECT_TRUE(tx.exec_prepared(statements::match::ReadById.name, id).empty());
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+// Sin BD: el puerto 1 rechaza la conexión, el pool no puede crecer y el checkout vence
+TEST(PostgresConnectionProviderTest, TimesOutWhenNoConnectionCanBeOpened) {
+    PostgresConnectionProvider provider(ConnectionPoolConfiguration{
+        .connectionString = "host=127.0.0.1 port=1 connect_timeout=1",
+        .minSize = 1,
+        .maxSize = 2,
+        .acquireTimeout = 200ms});
+
+    EXPECT_THROW(provider.Connection(), ConnectionAcquireTimeout);
+
+    const auto metrics = provider.Metrics();
+    EXPECT_EQ(metrics.open, 0);
+    EXPECT_EQ(metrics.exhausted, 1);
+    EXPECT_GE(metrics.connectionFailures, 1);
+}
+
+// Con BD real (TOURNAMENT_DB_URL): más hilos que conexiones, ninguna se entrega dos veces a la vez
+TEST(PostgresConnectionProviderTest, ConcurrentCheckoutsNeverShareAConnection) {
+    const char* url = std::getenv("TOURNAMENT_DB_URL");
+    if (url == nullptr) {
+        GTEST_SKIP() << "TOURNAMENT_DB_URL is not set";
+    }
+    PostgresConnectionProvider provider(url, 4);
+
+    std::mutex mutex;
+    std::set<pqxx::connection*> inUse;
+    bool shared = false;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 200; i++) {
+                auto pooled = provider.Connection();
+                auto* connection = AsPostgres(pooled)->connection.get();
+                {
+                    std::lock_guard lock(mutex);
+                    shared |= !inUse.insert(connection).second;
+                }
+                std::this_thread::yield();
+                std::lock_guard lock(mutex);
+                inUse.erase(connection);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_FALSE(shared);
+    const auto metrics = provider.Metrics();
+    EXPECT_EQ(metrics.acquisitions, 1600);
+    EXPECT_EQ(metrics.open, 4);
+    EXPECT_EQ(metrics.idle, 4);
+}
+
+// Con BD real: una conexión ociosa cuyo backend terminó (como tras un reinicio) sigue con
+// is_open() == true; el checkout la verifica, la descarta y entrega una que funciona
+TEST(PostgresConnectionProviderTest, DiscardsIdleConnectionWhoseBackendDied) {
+    const char* url = std::getenv("TOURNAMENT_DB_URL");
+    if (url == nullptr) {
+        GTEST_SKIP() << "TOURNAMENT_DB_URL is not set";
+    }
+    PostgresConnectionProvider provider(ConnectionPoolConfiguration{
+        .connectionString = url,
+        .minSize = 1,
+        .maxSize = 1,
+        .validateAfterIdle = 0ms});
+
+    int backendPid;
+    {
+        auto pooled = provider.Connection();
+        backendPid = AsPostgres(pooled)->connection->backendpid();
+    }
+    {
+        pqxx::connection admin(url);
+        pqxx::nontransaction tx(admin);
+        tx.exec("SELECT pg_terminate_backend(" + std::to_string(backendPid) + ")");
+    }
+    std::this_thread::sleep_for(100ms);
+
+    auto pooled = provider.Connection();
+    pqxx::nontransaction tx(*AsPostgres(pooled)->connection);
+    EXPECT_NO_THROW(tx.exec("SELECT 1"));
+    EXPECT_EQ(provider.Metrics().brokenDiscarded, 1);
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "persistence/configuration/StatementRegistry.hpp"
+#include <pqxx/pqxx>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Regresión de planes: cada finder de los repositorios debe resolverse con los índices de
+// database/migrations/ y nunca con un Seq Scan.
+// Necesita una BD con las migraciones aplicadas; sin TOURNAMENT_DB_URL la prueba se omite.
+//
+// Con enable_seqscan = off el planificador solo elige un Seq Scan si no existe ningún
+// índice que sirva para el predicado, así el resultado no depende del tamaño de la tabla.
+class QueryPlanTest : public ::testing::Test {
+protected:
+    std::unique_ptr<pqxx::connection> connection;
+
+    void SetUp() override {
+        const char* url = std::getenv("TOURNAMENT_DB_URL");
+        if (url == nullptr) {
+            GTEST_SKIP() << "TOURNAMENT_DB_URL is not set";
+        }
+        connection = std::make_unique<pqxx::connection>(url);
+        StatementRegistry::PrepareAll(*connection);
+        StatementRegistry::Prepare(*connection, StatementRegistry::MatchRecords);
+    }
+
+    std::string Explain(const PreparedStatement& statement, const std::vector<std::string>& parameters) {
+        pqxx::work tx(*connection);
+        tx.exec("SET LOCAL enable_seqscan = off");
+
+        std::string sql = std::string("EXPLAIN EXECUTE ") + statement.name + "(";
+        for (size_t i = 0; i < parameters.size(); i++) {
+            if (i > 0) sql += ", ";
+            sql += parameters[i];
+        }
+        sql += ")";
+
+        std::string plan;
+        for (const auto& row : tx.exec(sql)) {
+            plan += row[0].as<std::string>() + "\n";
+        }
+        return plan;
+    }
+
+    void ExpectIndexScan(const PreparedStatement& statement, const std::vector<std::string>& parameters,
+                         const std::string& index = "idx_matches_") {
+        const auto plan = Explain(statement, parameters);
+        EXPECT_EQ(plan.find("Seq Scan"), std::string::npos) << statement.name << " falls back to a seq scan:\n" << plan;
+        // el índice de la llave primaria también evita el Seq Scan (id > $n), pero recorre toda la tabla
+        EXPECT_NE(plan.find(index), std::string::npos) << statement.name << " does not use " << index << ":\n" << plan;
+    }
+
+    std::string Quote(const std::string& value) {
+        return connection->quote(value);
+    }
+};
+
+TEST_F(QueryPlanTest, FindByTournamentId_UsesIndex) {
+    ExpectIndexScan(statements::match::FindByTournamentId,
+        {Quote("plan-tournament"), Quote("00000000-0000-0000-0000-000000000000"), "50"});
+}
+
+TEST_F(QueryPlanTest, FindByTournamentIdAndPhase_UsesIndex) {
+    ExpectIndexScan(statements::match::FindByTournamentIdAndPhase,
+        {Quote("plan-tournament"), Quote("GROUP_STAGE"), Quote("00000000-0000-0000-0000-000000000000"), "50"});
+}
+
+TEST_F(QueryPlanTest, FindByGroupId_UsesIndex) {
+    ExpectIndexScan(statements::match::FindByGroupId,
+        {Quote("plan-group"), Quote("00000000-0000-0000-0000-000000000000"), "50"});
+}
+
+TEST_F(QueryPlanTest, FindByTeamId_UsesIndexOnBothBranches) {
+    const auto plan = Explain(statements::match::FindByTeamId,
+        {Quote("plan-team"), Quote("00000000-0000-0000-0000-000000000000"), "50"});
+
+    EXPECT_EQ(plan.find("Seq Scan"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("idx_matches_team1"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("idx_matches_team2"), std::string::npos) << plan;
+}
+
+TEST_F(QueryPlanTest, FindByTeamId_UnpagedUsesIndexOnBothBranches) {
+    // LIMIT NULL: el listado completo tampoco debe recorrer la tabla
+    const auto plan = Explain(statements::match::FindByTeamId,
+        {Quote("plan-team"), Quote("00000000-0000-0000-0000-000000000000"), "NULL"});
+
+    EXPECT_EQ(plan.find("Seq Scan"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("idx_matches_team1"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("idx_matches_team2"), std::string::npos) << plan;
+}
+
+TEST_F(QueryPlanTest, IsGroupStageComplete_UsesIndex) {
+    ExpectIndexScan(statements::match::IsGroupStageComplete, {Quote("plan-tournament")});
+}
+
+TEST_F(QueryPlanTest, MatchProjections_UseIndexes) {
+    ExpectIndexScan(statements::match::FindGroupIdsByTournamentId, {Quote("plan-tournament")}, "idx_matches_tournament_phase");
+    ExpectIndexScan(statements::match::FindCompletedResultsByGroupId, {Quote("plan-group")}, "idx_matches_group");
+}
+
+TEST_F(QueryPlanTest, GroupsByTournament_UsesIndex) {
+    ExpectIndexScan(statements::group::ReadPageByTournamentId,
+        {Quote("plan-tournament"), Quote("00000000-0000-0000-0000-000000000000"), "NULL"}, "idx_groups_tournament");
+}
+
+TEST_F(QueryPlanTest, TournamentAggregate_UsesIndexes) {
+    const auto plan = Explain(statements::tournament::ReadAggregateById, {Quote("11111111-1111-1111-1111-111111111111")});
+    EXPECT_EQ(plan.find("Seq Scan"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("idx_groups_tournament"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("idx_matches_tournament"), std::string::npos) << plan;
+}
+
+TEST_F(QueryPlanTest, TypedTournamentAggregate_UsesIndexes) {
+    const auto plan = Explain(statements::match_record::ReadTournamentAggregateById, {Quote("11111111-1111-1111-1111-111111111111")});
+    EXPECT_EQ(plan.find("Seq Scan"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("idx_groups_tournament"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("idx_match_records_tournament"), std::string::npos) << plan;
+}
+
+TEST_F(QueryPlanTest, TypedMatchFinders_UseIndexes) {
+    const auto uuid = Quote("11111111-1111-1111-1111-111111111111");
+    const auto first = Quote("00000000-0000-0000-0000-000000000000");
+    ExpectIndexScan(statements::match_record::FindByTournamentId, {uuid, first, "50"}, "idx_match_records_tournament");
+    ExpectIndexScan(statements::match_record::FindByTournamentIdAndPhase,
+        {uuid, Quote("GROUP_STAGE"), first, "50"}, "idx_match_records_tournament_phase");
+    ExpectIndexScan(statements::match_record::FindByGroupId, {uuid, first, "50"}, "idx_match_records_group");
+
+    const auto plan = Explain(statements::match_record::FindByTeamId, {uuid, first, "NULL"});
+    EXPECT_EQ(plan.find("Seq Scan"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("idx_match_records_team1"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("idx_match_records_team2"), std::string::npos) << plan;
+}
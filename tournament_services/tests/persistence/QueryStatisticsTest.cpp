@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include "persistence/configuration/LatencyHistogram.hpp"
+#include "persistence/configuration/QueryStatistics.hpp"
+
+using namespace std::chrono_literals;
+
+// Prueba que los percentiles caen dentro del error relativo de la cubeta (< 3.2 %)
+TEST(QueryStatisticsTest, Histogram_PercentilesWithinBucketError) {
+    LatencyHistogram histogram;
+    for (uint64_t micros = 1; micros <= 10000; micros++) {
+        histogram.Record(micros);
+    }
+
+    EXPECT_EQ(histogram.Count(), 10000);
+    EXPECT_EQ(histogram.Max(), 10000);
+    EXPECT_DOUBLE_EQ(histogram.Mean(), 5000.5);
+    EXPECT_NEAR(static_cast<double>(histogram.ValueAtPercentile(50)), 5000.0, 5000.0 * 0.032);
+    EXPECT_NEAR(static_cast<double>(histogram.ValueAtPercentile(99)), 9900.0, 9900.0 * 0.032);
+    EXPECT_EQ(histogram.ValueAtPercentile(100), 10000);
+}
+
+// Prueba que los valores pequeños son exactos y que un histograma vacío reporta ceros
+TEST(QueryStatisticsTest, Histogram_SmallValuesAreExact) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.ValueAtPercentile(99), 0);
+
+    histogram.Record(3);
+    histogram.Record(7);
+    EXPECT_EQ(histogram.ValueAtPercentile(50), 3);
+    EXPECT_EQ(histogram.ValueAtPercentile(100), 7);
+}
+
+// Prueba que las ejecuciones, filas y errores por SQLSTATE aparecen en el snapshot
+TEST(QueryStatisticsTest, Snapshot_CountsCallsRowsAndErrorsBySqlState) {
+    auto& statistics = QueryStatistics::Instance();
+    statistics.Record("query_statistics_test", 2ms, 3);
+    statistics.Record("query_statistics_test", 4ms, 1);
+    statistics.RecordError("query_statistics_test", 1ms, "23505");
+    statistics.RecordError("query_statistics_test", 1ms, "23505");
+    statistics.RecordError("query_statistics_test", 1ms, "");
+
+    const auto snapshot = statistics.Snapshot();
+    ASSERT_TRUE(snapshot.contains("query_statistics_test"));
+    const auto& metrics = snapshot.at("query_statistics_test");
+    EXPECT_EQ(metrics.calls, 5);
+    EXPECT_EQ(metrics.rows, 4);
+    EXPECT_EQ(metrics.errors, 3);
+    EXPECT_EQ(metrics.errorsBySqlState.at("23505"), 2);
+    EXPECT_EQ(metrics.errorsBySqlState.at("unknown"), 1);
+    EXPECT_NEAR(static_cast<double>(metrics.maxMicros), 4000.0, 4000.0 * 0.032);
+
+    // las sentencias registradas que no se han ejecutado no aparecen
+    EXPECT_FALSE(snapshot.contains(statements::team::ReadAll.name));
+}
+
+// Prueba que un COPY queda registrado como una sentencia más: filas copiadas y errores, que se propagan
+TEST(QueryStatisticsTest, ExecCopy_RecordsRowsAndErrors) {
+    EXPECT_EQ(ExecCopy("copy_statistics_test", [] { return uint64_t{25}; }), 25);
+    EXPECT_THROW(ExecCopy("copy_statistics_test", []() -> uint64_t { throw pqxx::broken_connection("lost"); }),
+                 pqxx::broken_connection);
+    EXPECT_THROW(ExecCopy("copy_statistics_test", []() -> uint64_t { throw std::runtime_error("bad row"); }),
+                 std::runtime_error);
+
+    const auto snapshot = QueryStatistics::Instance().Snapshot();
+    ASSERT_TRUE(snapshot.contains("copy_statistics_test"));
+    const auto& metrics = snapshot.at("copy_statistics_test");
+    EXPECT_EQ(metrics.calls, 3);
+    EXPECT_EQ(metrics.rows, 25);
+    EXPECT_EQ(metrics.errors, 2);
+    EXPECT_EQ(metrics.errorsBySqlState.at("08006"), 1);
+    EXPECT_EQ(metrics.errorsBySqlState.at("unknown"), 1);
+}
+
+// Prueba el umbral configurable; 0 deshabilita el registro de consultas lentas
+TEST(QueryStatisticsTest, IsSlow_UsesConfiguredThreshold) {
+    auto& statistics = QueryStatistics::Instance();
+    statistics.Configure(QueryStatisticsConfiguration{50ms, false});
+    EXPECT_FALSE(statistics.IsSlow(49ms));
+    EXPECT_TRUE(statistics.IsSlow(50ms));
+
+    statistics.Configure(QueryStatisticsConfiguration{0ms, false});
+    EXPECT_FALSE(statistics.IsSlow(10s));
+
+    statistics.Configure(nlohmann::json::object().get<QueryStatisticsConfiguration>());
+    EXPECT_TRUE(statistics.IsSlow(500ms));
+}
+
+// Prueba que EXPLAIN ANALYZE solo se ofrece para sentencias de solo lectura
+TEST(QueryStatisticsTest, IsReadOnly_RejectsWrites) {
+    EXPECT_TRUE(query_statistics_detail::IsReadOnly(statements::team::ReadById.sql));
+    EXPECT_FALSE(query_statistics_detail::IsReadOnly(statements::team::Insert.sql));
+    EXPECT_FALSE(query_statistics_detail::IsReadOnly(statements::group::AddTeam.sql));
+    EXPECT_FALSE(query_statistics_detail::IsReadOnly(statements::match::Upsert.sql));
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include "persistence/configuration/ReplicatedConnectionProvider.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/repository/TeamRepository.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace {
+// Conexión de mentira que solo recuerda de qué pool salió
+class TaggedConnection : public IDbConnection {
+public:
+    explicit TaggedConnection(std::string pool) : pool(std::move(pool)) {}
+    std::string pool;
+};
+
+class FakeProvider : public IDbConnectionProvider {
+public:
+    explicit FakeProvider(std::string name) : name(std::move(name)) {}
+
+    std::string name;
+    bool exhausted = false;
+    int released = 0;
+
+    PooledConnection Connection() override {
+        if (exhausted) {
+            throw ConnectionAcquireTimeout("Timed out waiting for a database connection");
+        }
+        return PooledConnection(new TaggedConnection(name), [this](IDbConnection* dbc) {
+            ++released;
+            delete dbc;
+        });
+    }
+};
+
+std::string PoolOf(PooledConnection& connection) {
+    return dynamic_cast<TaggedConnection&>(*connection).pool;
+}
+}
+
+class ReplicatedConnectionProviderTest : public ::testing::Test {
+protected:
+    std::shared_ptr<FakeProvider> primary = std::make_shared<FakeProvider>("primary");
+    std::shared_ptr<FakeProvider> replicaA = std::make_shared<FakeProvider>("replica-a");
+    std::shared_ptr<FakeProvider> replicaB = std::make_shared<FakeProvider>("replica-b");
+
+    ReplicatedConnectionProvider MakeProvider(std::chrono::milliseconds window = 0ms) {
+        return ReplicatedConnectionProvider(primary, {replicaA, replicaB}, window);
+    }
+};
+
+TEST_F(ReplicatedConnectionProviderTest, WritesGoToPrimaryAndReadsRoundRobinOverReplicas) {
+    auto provider = MakeProvider();
+
+    auto write = provider.Connection();
+    auto first = provider.ReadConnection();
+    auto second = provider.ReadConnection();
+    auto third = provider.ReadConnection();
+
+    EXPECT_EQ(PoolOf(write), "primary");
+    EXPECT_EQ(PoolOf(first), "replica-a");
+    EXPECT_EQ(PoolOf(second), "replica-b");
+    EXPECT_EQ(PoolOf(third), "replica-a");
+    EXPECT_EQ(provider.ReplicaReads(), 3);
+}
+
+TEST_F(ReplicatedConnectionProviderTest, ReadsStayOnPrimaryDuringReadYourWritesWindow) {
+    auto provider = MakeProvider(100ms);
+    ReadYourWritesSession session;
+    ReadYourWritesScope scope(session);
+
+    {
+        auto write = provider.Connection();
+        write->committedWrite = true;
+    }
+    EXPECT_EQ(primary->released, 1);
+    EXPECT_TRUE(session.Wrote());
+
+    auto duringWindow = provider.ReadConnection();
+    EXPECT_EQ(PoolOf(duringWindow), "primary");
+
+    std::this_thread::sleep_for(150ms);
+    auto afterWindow = provider.ReadConnection();
+    EXPECT_EQ(PoolOf(afterWindow), "replica-a");
+}
+
+// Prueba que usar el primario sin confirmar una escritura (p. ej. la lectura de un read-modify-write)
+// no abre la ventana
+TEST_F(ReplicatedConnectionProviderTest, PrimaryUseWithoutCommittedWrite_DoesNotOpenWindow) {
+    auto provider = MakeProvider(1000ms);
+    ReadYourWritesSession session;
+    ReadYourWritesScope scope(session);
+
+    {
+        auto readOnly = provider.Connection();
+    }
+
+    EXPECT_FALSE(session.Wrote());
+    auto read = provider.ReadConnection();
+    EXPECT_EQ(PoolOf(read), "replica-a");
+}
+
+// Prueba que la ventana es de la sesión que escribió: otra petición sigue leyendo de las réplicas
+TEST_F(ReplicatedConnectionProviderTest, WindowBelongsToWritingSession) {
+    auto provider = MakeProvider(1000ms);
+    ReadYourWritesSession writer;
+    {
+        ReadYourWritesScope scope(writer);
+        auto write = provider.Connection();
+        write->committedWrite = true;
+    }
+
+    ReadYourWritesSession other;
+    {
+        ReadYourWritesScope scope(other);
+        auto read = provider.ReadConnection();
+        EXPECT_EQ(PoolOf(read), "replica-a");
+    }
+
+    // la siguiente petición del mismo cliente reenvía el token
+    auto resumed = ReadYourWritesSession::FromToken(writer.Token());
+    ReadYourWritesScope scope(resumed);
+    auto read = provider.ReadConnection();
+    EXPECT_EQ(PoolOf(read), "primary");
+}
+
+// Prueba que un token vencido, mal formado o más lejano que la ventana no manda las lecturas al primario
+TEST_F(ReplicatedConnectionProviderTest, IgnoresExpiredMalformedOrForgedTokens) {
+    auto provider = MakeProvider(1000ms);
+    const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        ReadYourWritesSession::Clock::now().time_since_epoch()).count();
+
+    for (const auto& token : {std::to_string(now - 10), std::string("abc"), std::to_string(now + 3600 * 1000)}) {
+        auto session = ReadYourWritesSession::FromToken(token);
+        ReadYourWritesScope scope(session);
+        auto read = provider.ReadConnection();
+        EXPECT_NE(PoolOf(read), "primary") << token;
+    }
+}
+
+TEST_F(ReplicatedConnectionProviderTest, SkipsExhaustedReplicaAndFallsBackToPrimary) {
+    auto provider = MakeProvider();
+    replicaA->exhausted = true;
+
+    auto read = provider.ReadConnection();
+    EXPECT_EQ(PoolOf(read), "replica-b");
+
+    replicaB->exhausted = true;
+    auto fallback = provider.ReadConnection();
+    EXPECT_EQ(PoolOf(fallback), "primary");
+    EXPECT_EQ(provider.ReplicaFailures(), 2);
+    EXPECT_EQ(provider.PrimaryReads(), 1);
+}
+
+// Dos instancias locales de Postgres con el esquema aplicado; sin TOURNAMENT_DB_URL y
+// TOURNAMENT_REPLICA_DB_URL la prueba se omite. No hace falta que estén replicadas: la prueba
+// solo verifica a qué instancia va cada operación.
+TEST(ReplicatedConnectionProviderDatabaseTest, RoutesRepositoryReadsToReplica) {
+    const char* primaryUrl = std::getenv("TOURNAMENT_DB_URL");
+    const char* replicaUrl = std::getenv("TOURNAMENT_REPLICA_DB_URL");
+    if (primaryUrl == nullptr || replicaUrl == nullptr) {
+        GTEST_SKIP() << "TOURNAMENT_DB_URL or TOURNAMENT_REPLICA_DB_URL is not set";
+    }
+
+    auto primaryPool = std::make_shared<PostgresConnectionProvider>(primaryUrl, 1);
+    auto replicaPool = std::make_shared<PostgresConnectionProvider>(replicaUrl, 1);
+    auto provider = std::make_shared<ReplicatedConnectionProvider>(
+        primaryPool, std::vector<std::shared_ptr<IDbConnectionProvider>>{replicaPool}, 200ms);
+    TeamRepository repository(provider);
+    ReadYourWritesSession session;
+    ReadYourWritesScope scope(session);
+
+    auto id = repository.Create(domain::Team{"", "Replica routing"});
+    ASSERT_TRUE(id.has_value());
+
+    // dentro de la ventana la lectura ve la escritura aunque la réplica no la tenga
+    EXPECT_NE(repository.ReadById(*id), nullptr);
+    EXPECT_EQ(replicaPool->Metrics().acquisitions, 0);
+
+    std::this_thread::sleep_for(300ms);
+    repository.ReadAll();
+    EXPECT_EQ(replicaPool->Metrics().acquisitions, 1);
+    EXPECT_EQ(provider->ReplicaReads(), 1);
+
+    repository.Delete(*id);
+}
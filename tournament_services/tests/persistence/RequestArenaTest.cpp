@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "domain/JsonWriter.hpp"
+#include "domain/Match.hpp"
+#include "memory/RequestArena.hpp"
+
+namespace {
+    domain::Match CompletedMatch() {
+        domain::Match match("0192f1c4-7b3a-7d2e-9a10-4c5d6e7f8091", domain::MatchPhase::QUARTERFINALS, 3);
+        match.Id() = "0192f1c4-7b3a-7d2e-9a10-4c5d6e7f8092";
+        match.SetGroupId("grupo \"A\"\\\n\t\x01 ñ");
+        match.SetTeam1("team-1");
+        match.SetTeam2("team-2");
+        match.SetScore(2, 1);
+        match.SetNextMatchId("next");
+        return match;
+    }
+}
+
+// Prueba que el escritor directo produce el mismo texto que nlohmann::json(...).dump()
+TEST(RequestArenaTest, AppendJson_MatchesNlohmannDump) {
+    const auto completed = CompletedMatch();
+    const domain::Match pending("tournament", domain::MatchPhase::GROUP_STAGE, -1);
+
+    std::string text;
+    domain::AppendJson(text, completed);
+    EXPECT_EQ(text, nlohmann::json(completed).dump());
+
+    std::pmr::string arenaText;
+    domain::AppendJson(arenaText, pending);
+    EXPECT_EQ(std::string(arenaText), nlohmann::json(pending).dump());
+
+    const std::vector<std::shared_ptr<domain::Match>> list{std::make_shared<domain::Match>(completed), nullptr};
+    text.clear();
+    domain::AppendJsonArray(text, list);
+    EXPECT_EQ(text, nlohmann::json(list).dump());
+}
+
+// Prueba que el bloque del hilo crece tras una petición grande y la siguiente ya no usa malloc
+TEST(RequestArenaTest, ThreadBlockGrowsAndIsReused) {
+    {
+        RequestArena arena;
+        (void)arena.Resource()->allocate(RequestArena::MaxRetainedBytes);
+        EXPECT_GT(arena.OverflowBytes(), 0);
+    }
+    {
+        RequestArena arena;
+        (void)arena.Resource()->allocate(RequestArena::MaxRetainedBytes / 2);
+        EXPECT_EQ(arena.OverflowBytes(), 0);
+    }
+}
+
+// Prueba que una arena anidada no comparte el bloque del hilo con la exterior
+TEST(RequestArenaTest, NestedArenaUsesItsOwnMemory) {
+    RequestArena outer;
+    void* outerMemory = outer.Resource()->allocate(64);
+    {
+        RequestArena inner;
+        void* innerMemory = inner.Resource()->allocate(64);
+        EXPECT_NE(innerMemory, outerMemory);
+        EXPECT_GT(inner.OverflowBytes(), 0);
+    }
+    EXPECT_EQ(outer.OverflowBytes(), 0);
+
+    std::pmr::vector<std::shared_ptr<domain::Match>> matches(outer.Resource());
+    matches.push_back(std::allocate_shared<domain::Match>(std::pmr::polymorphic_allocator<domain::Match>(outer.Resource())));
+    EXPECT_EQ(outer.OverflowBytes(), 0);
+}
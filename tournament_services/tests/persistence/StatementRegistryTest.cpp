@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string>
+#include "persistence/configuration/StatementRegistry.hpp"
+
+namespace {
+    struct Declared {
+        std::string qualifiedName; // statements::<entidad>::<Sentencia>
+        std::string entity;
+    };
+
+    // C++ no permite recorrer un namespace: las sentencias declaradas se leen del propio encabezado
+    // (STATEMENT_REGISTRY_HEADER lo define tests/CMakeLists.txt), nombre SQL -> declaración
+    std::multimap<std::string, Declared> DeclaredStatements() {
+        std::ifstream header(STATEMENT_REGISTRY_HEADER);
+        std::stringstream text;
+        text << header.rdbuf();
+        const auto source = text.str();
+
+        const std::regex token(R"(namespace\s+(\w+)\s*\{|inline\s+constexpr\s+PreparedStatement\s+(\w+)\s*\{\s*"([^"]+)\")");
+        std::multimap<std::string, Declared> declared;
+        std::string entity;
+        for (auto it = std::sregex_iterator(source.begin(), source.end(), token); it != std::sregex_iterator(); ++it) {
+            const auto& match = *it;
+            if (match[1].matched) {
+                entity = match[1].str();
+            } else {
+                declared.emplace(match[3].str(), Declared{"statements::" + entity + "::" + match[2].str(), entity});
+            }
+        }
+        return declared;
+    }
+}
+
+// Prueba que los nombres SQL de ambas listas no se repiten: PQprepare falla con un nombre ya usado
+TEST(StatementRegistryTest, Names_AreUniqueAcrossBothLists) {
+    std::set<std::string> names;
+    for (const auto& statement : StatementRegistry::All) {
+        EXPECT_TRUE(names.insert(statement.name).second) << statement.name;
+    }
+    for (const auto& statement : StatementRegistry::MatchRecords) {
+        EXPECT_TRUE(names.insert(statement.name).second) << statement.name;
+    }
+}
+
+// Prueba que cada statements::* está registrada exactamente una vez, y que las de MATCH_RECORDS
+// van en MatchRecords (preparadas al primer uso) y las demás en All (preparadas al abrir la conexión)
+TEST(StatementRegistryTest, EveryDeclaredStatement_IsRegisteredOnce) {
+    const auto declared = DeclaredStatements();
+    ASSERT_FALSE(declared.empty()) << "No se pudo leer " << STATEMENT_REGISTRY_HEADER;
+
+    std::map<std::string, int> inAll, inMatchRecords;
+    for (const auto& statement : StatementRegistry::All) ++inAll[statement.name];
+    for (const auto& statement : StatementRegistry::MatchRecords) ++inMatchRecords[statement.name];
+
+    for (const auto& [name, statement] : declared) {
+        EXPECT_EQ(declared.count(name), 1) << statement.qualifiedName << " repite el nombre " << name;
+        const auto all = inAll.contains(name) ? inAll.at(name) : 0;
+        const auto matchRecords = inMatchRecords.contains(name) ? inMatchRecords.at(name) : 0;
+        if (statement.entity == "match_record") {
+            EXPECT_EQ(all, 0) << statement.qualifiedName << " no debe estar en StatementRegistry::All";
+            EXPECT_EQ(matchRecords, 1) << statement.qualifiedName;
+        } else {
+            EXPECT_EQ(all, 1) << statement.qualifiedName;
+            EXPECT_EQ(matchRecords, 0) << statement.qualifiedName << " no debe estar en StatementRegistry::MatchRecords";
+        }
+    }
+    EXPECT_EQ(StatementRegistry::All.size() + StatementRegistry::MatchRecords.size(), declared.size());
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include "persistence/repository/TypedMatchRepository.hpp"
+#include "persistence/repository/TeamRepository.hpp"
+#include "persistence/repository/TournamentRepository.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/MatchStorage.hpp"
+#include "domain/Match.hpp"
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <nlohmann/json.hpp>
+
+// TypedMatchRepository contra una BD real con V005 aplicada; sin TOURNAMENT_DB_URL la prueba
+// se omite. MATCH_RECORDS exige UUIDs y equipos existentes, así que se crean dos equipos.
+class TypedMatchRepositoryTest : public ::testing::Test {
+protected:
+    const std::string tournamentId = GenerateUuid();
+    std::shared_ptr<PostgresConnectionProvider> provider;
+    std::shared_ptr<TeamRepository> teams;
+    std::shared_ptr<repository::TypedMatchRepository> repository;
+    std::string team1;
+    std::string team2;
+
+    void SetUp() override {
+        const char* url = std::getenv("TOURNAMENT_DB_URL");
+        if (url == nullptr) {
+            GTEST_SKIP() << "TOURNAMENT_DB_URL is not set";
+        }
+        provider = std::make_shared<PostgresConnectionProvider>(url, 1);
+        teams = std::make_shared<TeamRepository>(provider);
+        repository = std::make_shared<repository::TypedMatchRepository>(provider);
+        team1 = teams->Create(domain::Team{"", "Typed match 1"}).value();
+        team2 = teams->Create(domain::Team{"", "Typed match 2"}).value();
+    }
+
+    void TearDown() override {
+        if (!repository) return;
+        for (const auto& match : repository->FindByTournamentId(tournamentId)) {
+            repository->Delete(match->Id());
+        }
+        teams->Delete(team1);
+        teams->Delete(team2);
+    }
+
+    domain::Match MakeMatch(domain::MatchPhase phase, int number) {
+        domain::Match match(tournamentId, phase, number);
+        match.SetTeam1(team1);
+        match.SetTeam2(team2);
+        return match;
+    }
+};
+
+TEST_F(TypedMatchRepositoryTest, Save_RoundTripsEveryColumn) {
+    auto match = MakeMatch(domain::MatchPhase::GROUP_STAGE, 3);
+    const auto groupId = GenerateUuid();
+    match.SetGroupId(groupId);
+    match.SetScore(2, 0);
+
+    auto saved = repository->Save(match);
+    auto stored = repository->ReadById(saved.Id());
+
+    ASSERT_NE(stored, nullptr);
+    EXPECT_EQ(stored->TournamentId(), tournamentId);
+    EXPECT_EQ(stored->GroupId(), groupId);
+    EXPECT_EQ(stored->Phase(), domain::MatchPhase::GROUP_STAGE);
+    EXPECT_EQ(stored->MatchNumber(), 3);
+    EXPECT_EQ(stored->Team1Id(), team1);
+    EXPECT_EQ(stored->Team2Id(), team2);
+    EXPECT_EQ(stored->Team1Score(), 2);
+    EXPECT_EQ(stored->Team2Score(), 0);
+    EXPECT_EQ(stored->Status(), domain::MatchStatus::COMPLETED);
+    EXPECT_FALSE(stored->NextMatchId().has_value());
+}
+
+// Prueba que CreateMany conserva los ids que trae el lote y solo genera los que faltan, así un
+// partido puede apuntar a otro del mismo lote
+TEST_F(TypedMatchRepositoryTest, CreateMany_KeepsCallerIds) {
+    auto next = MakeMatch(domain::MatchPhase::QUARTERFINALS, 1);
+    next.Id() = GenerateUuid();
+    auto first = MakeMatch(domain::MatchPhase::ROUND_OF_16, 1);
+    first.SetNextMatchId(next.Id());
+    const auto second = MakeMatch(domain::MatchPhase::ROUND_OF_16, 2);
+
+    const auto ids = repository->CreateMany({first, second, next});
+
+    ASSERT_EQ(ids.size(), 3);
+    EXPECT_EQ(ids[2], next.Id());
+    EXPECT_FALSE(ids[1].empty());
+    const auto stored = repository->ReadById(ids[0]);
+    ASSERT_NE(stored, nullptr);
+    EXPECT_EQ(stored->NextMatchId(), next.Id());
+    EXPECT_NE(repository->ReadById(next.Id()), nullptr);
+}
+
+TEST_F(TypedMatchRepositoryTest, Save_WithoutGroupOrTeamsStoresNulls) {
+    auto saved = repository->Save(domain::Match(tournamentId, domain::MatchPhase::FINALS, 1));
+    auto stored = repository->ReadById(saved.Id());
+
+    ASSERT_NE(stored, nullptr);
+    EXPECT_EQ(stored->GroupId(), "");
+    EXPECT_FALSE(stored->Team1Id().has_value());
+    EXPECT_FALSE(stored->Team1Score().has_value());
+    EXPECT_EQ(stored->Status(), domain::MatchStatus::PENDING);
+}
+
+TEST_F(TypedMatchRepositoryTest, Finders_FilterByTypedColumns) {
+    repository->SaveAll({MakeMatch(domain::MatchPhase::GROUP_STAGE, 1),
+                         MakeMatch(domain::MatchPhase::GROUP_STAGE, 2),
+                         MakeMatch(domain::MatchPhase::SEMIFINALS, 1)});
+
+    EXPECT_EQ(repository->FindByTournamentId(tournamentId).size(), 3);
+    EXPECT_EQ(repository->FindByTournamentIdAndPhase(tournamentId, domain::MatchPhase::GROUP_STAGE).size(), 2);
+    EXPECT_EQ(repository->FindByTeamId(team2).size(), 3);
+    EXPECT_EQ(repository->FindByTournamentId(tournamentId, PageRequest{std::nullopt, 2}).size(), 2);
+    EXPECT_FALSE(repository->IsGroupStageComplete(tournamentId));
+}
+
+TEST_F(TypedMatchRepositoryTest, UpdateByIdAndCreateLinked_WriteColumns) {
+    auto completed = repository->Save(MakeMatch(domain::MatchPhase::QUARTERFINALS, 1));
+
+    auto updated = repository->UpdateById(completed.Id(), [](domain::Match& m) { m.SetScore(1, 0); });
+    ASSERT_NE(updated, nullptr);
+    auto next = repository->CreateLinked(domain::Match(tournamentId, domain::MatchPhase::SEMIFINALS, 1), *updated);
+
+    auto stored = repository->ReadById(completed.Id());
+    ASSERT_NE(stored, nullptr);
+    EXPECT_EQ(stored->Team1Score(), 1);
+    EXPECT_EQ(stored->NextMatchId(), next.Id());
+    EXPECT_NE(repository->ReadById(next.Id()), nullptr);
+}
+
+// Prueba que con "matchStorage": "typed" el agregado del torneo trae los partidos de
+// MATCH_RECORDS, con los mismos campos que guarda TypedMatchRepository
+TEST_F(TypedMatchRepositoryTest, TournamentAggregate_ReadsMatchRecordsWhenTyped) {
+    TournamentRepository tournaments(provider, MatchStorage::Typed);
+    const auto id = tournaments.Create(domain::Tournament{"Typed aggregate"});
+    ASSERT_TRUE(id.has_value());
+    domain::Match match(*id, domain::MatchPhase::GROUP_STAGE, 1);
+    match.SetTeam1(team1);
+    match.SetTeam2(team2);
+    match.SetScore(3, 1);
+    const auto saved = repository->Save(match);
+
+    const auto aggregate = tournaments.ReadAggregateById(*id);
+
+    repository->Delete(saved.Id());
+    tournaments.Delete(*id);
+    ASSERT_NE(aggregate, nullptr);
+    ASSERT_EQ(aggregate->Matches().size(), 1);
+    const auto& stored = aggregate->Matches()[0];
+    EXPECT_EQ(stored.Id(), saved.Id());
+    EXPECT_EQ(stored.TournamentId(), *id);
+    EXPECT_TRUE(stored.GroupId().empty());
+    EXPECT_EQ(stored.Team1Id(), team1);
+    EXPECT_EQ(stored.Team1Score(), 3);
+    EXPECT_EQ(stored.Team2Score(), 1);
+    EXPECT_EQ(stored.Status(), domain::MatchStatus::COMPLETED);
+    EXPECT_FALSE(stored.NextMatchId().has_value());
+}
+
+// Prueba que databaseConfig.matchStorage elige la tabla y que un valor desconocido no cae en "document"
+TEST(MatchStorageConfigurationTest, ReadsDatabaseConfig) {
+    EXPECT_EQ(nlohmann::json::object().get<MatchStorageConfiguration>().storage, MatchStorage::Document);
+    EXPECT_EQ(nlohmann::json({{"matchStorage", "document"}}).get<MatchStorageConfiguration>().storage, MatchStorage::Document);
+    EXPECT_EQ(nlohmann::json({{"matchStorage", "typed"}}).get<MatchStorageConfiguration>().storage, MatchStorage::Typed);
+    EXPECT_THROW(nlohmann::json({{"matchStorage", "columns"}}).get<MatchStorageConfiguration>(), std::invalid_argument);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <unordered_set>
+#include <nlohmann/json.hpp>
+#include "domain/Uuid.hpp"
+#include "persistence/configuration/UuidTraits.hpp"
+#include "persistence/repository/IdGenerator.hpp"
+#include "persistence/repository/IMatchRepository.hpp"
+#include "controller/Pagination.hpp"
+
+// Prueba que el texto canónico sobrevive al ida y vuelta y sale en minúsculas
+TEST(UuidTest, Parse_RoundTripsCanonicalText) {
+    const auto uuid = domain::Uuid::Parse("0192F1C4-7B3A-7D2E-9A10-4C5D6E7F8091");
+
+    ASSERT_TRUE(uuid.has_value());
+    EXPECT_EQ(uuid->ToString(), "0192f1c4-7b3a-7d2e-9a10-4c5d6e7f8091");
+    EXPECT_EQ(uuid->Bytes()[0], 0x01);
+    EXPECT_EQ(uuid->Bytes()[15], 0x91);
+    EXPECT_FALSE(uuid->IsNil());
+    EXPECT_TRUE(domain::Uuid{}.IsNil());
+}
+
+// Prueba que se rechazan longitudes, guiones y dígitos inválidos
+TEST(UuidTest, Parse_RejectsMalformedText) {
+    EXPECT_FALSE(domain::Uuid::Parse("").has_value());
+    EXPECT_FALSE(domain::Uuid::Parse("team-1").has_value());
+    EXPECT_FALSE(domain::Uuid::Parse("0192f1c47b3a7d2e9a104c5d6e7f8091").has_value());
+    EXPECT_FALSE(domain::Uuid::Parse("0192f1c4-7b3a-7d2e-9a10_4c5d6e7f8091").has_value());
+    EXPECT_FALSE(domain::Uuid::Parse("0192f1c4-7b3a-7d2e-9a10-4c5d6e7f809g").has_value());
+}
+
+// Prueba que el orden es byte por byte (el de PostgreSQL) y que el hash distingue ids
+TEST(UuidTest, OrderingAndHashing) {
+    const auto low = *domain::Uuid::Parse("00000000-0000-0000-0000-0000000000ff");
+    const auto high = *domain::Uuid::Parse("00000000-0000-0000-0000-000000000100");
+
+    EXPECT_LT(low, high);
+    EXPECT_NE(low, high);
+    EXPECT_EQ(low, *domain::Uuid::Parse("00000000-0000-0000-0000-0000000000FF"));
+
+    std::unordered_set<domain::Uuid> ids{low, high, low};
+    EXPECT_EQ(ids.size(), 2);
+}
+
+// Prueba la conversión JSON y la de pqxx (parámetros y field::as)
+TEST(UuidTest, JsonAndPqxxConversions) {
+    const auto uuid = *domain::Uuid::Parse("0192f1c4-7b3a-7d2e-9a10-4c5d6e7f8091");
+
+    const nlohmann::json json = uuid;
+    EXPECT_EQ(json, "0192f1c4-7b3a-7d2e-9a10-4c5d6e7f8091");
+    EXPECT_EQ(json.get<domain::Uuid>(), uuid);
+    EXPECT_THROW(nlohmann::json("team-1").get<domain::Uuid>(), std::invalid_argument);
+
+    char buffer[64];
+    const auto text = pqxx::string_traits<domain::Uuid>::to_buf(buffer, buffer + sizeof(buffer), uuid);
+    EXPECT_EQ(std::string_view(text), "0192f1c4-7b3a-7d2e-9a10-4c5d6e7f8091");
+    EXPECT_EQ(pqxx::string_traits<domain::Uuid>::from_string(text), uuid);
+    EXPECT_THROW(pqxx::string_traits<domain::Uuid>::from_string("team-1"), pqxx::conversion_error);
+    EXPECT_THROW(pqxx::string_traits<domain::Uuid>::into_buf(buffer, buffer + 10, uuid), pqxx::conversion_overrun);
+}
+
+// Prueba que los ids generados son UUIDv7 y crecen estrictamente dentro de un hilo
+TEST(UuidTest, GenerateUuidValue_IsVersion7AndIncreasing) {
+    auto previous = GenerateUuidValue();
+    for (int i = 0; i < 10000; i++) {
+        const auto next = GenerateUuidValue();
+        ASSERT_EQ(next.Bytes()[6] >> 4, 7);
+        ASSERT_EQ(next.Bytes()[8] >> 6, 2);
+        ASSERT_LT(previous, next);
+        previous = next;
+    }
+    EXPECT_TRUE(domain::Uuid::Parse(GenerateUuid()).has_value());
+}
+
+// Prueba que los resultados guardan como Uuid solo los ids canónicos y que la validación de la API usa domain::Uuid
+TEST(UuidTest, MatchResultAndApiValidation_ShareParser) {
+    const std::string team1 = "0192f1c4-7b3a-7d2e-9a10-4c5d6e7f8091";
+    const std::string team2 = "0192F1C4-7B3A-7D2E-9A10-4C5D6E7F8092";
+
+    const auto result = repository::MatchResult::FromText(team1, team2, 3, 1);
+    EXPECT_TRUE(result.team1Id.IsUuid());
+    EXPECT_EQ(result.team1Id, repository::TeamKey(*domain::Uuid::Parse(team1)));
+    EXPECT_EQ(result.team1Score, 3);
+    // un UUID en mayúsculas o un id heredado se conservan como texto, sin cambiar el id
+    EXPECT_FALSE(result.team2Id.IsUuid());
+    EXPECT_EQ(result.team2Id.ToString(), team2);
+    const auto legacy = repository::MatchResult::FromText("team-1", "", 3, 1);
+    EXPECT_EQ(legacy.team1Id.ToString(), "team-1");
+    EXPECT_EQ(legacy.team2Id.ToString(), "");
+
+    for (const std::string_view text : {std::string_view(team1), std::string_view(team2), std::string_view("team-1"),
+                                        std::string_view("0192f1c4-7b3a-7d2e-9a10_4c5d6e7f8091")}) {
+        EXPECT_EQ(pagination::IsUuid(text), domain::Uuid::Parse(text).has_value()) << text;
+    }
+}
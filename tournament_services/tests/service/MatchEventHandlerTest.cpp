@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "handlers/MatchEventHandler.hpp"
+#include "events/Events.hpp"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::Return;
+using ::testing::SaveArg;
+
+namespace {
+    domain::Uuid Id(int n) {
+        std::array<uint8_t, 16> bytes{};
+        bytes[15] = static_cast<uint8_t>(n);
+        return domain::Uuid(bytes);
+    }
+
+    class MockMatchRepository : public repository::IMatchRepository {
+    public:
+        MOCK_METHOD(std::optional<std::string>, Create, (const domain::Match& entity), (override));
+        MOCK_METHOD(std::vector<std::string>, CreateMany, (const std::vector<domain::Match>& entities), (override));
+        MOCK_METHOD(std::shared_ptr<domain::Match>, ReadById, (std::string id), (override));
+        MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, ReadAll, (), (override));
+        MOCK_METHOD(std::string, Update, (const domain::Match& entity), (override));
+        MOCK_METHOD(void, Delete, (std::string id), (override));
+        MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, FindByTournamentId, (std::string tournamentId, const PageRequest& page), (override));
+        MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, FindByTournamentIdAndPhase, (std::string tournamentId, domain::MatchPhase phase, const PageRequest& page), (override));
+        MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, FindByGroupId, (std::string groupId, const PageRequest& page), (override));
+        MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, FindByTeamId, (std::string teamId, const PageRequest& page), (override));
+        MOCK_METHOD(bool, IsGroupStageComplete, (std::string tournamentId), (override));
+        MOCK_METHOD(domain::Match, Save, (const domain::Match& match), (override));
+        MOCK_METHOD(std::vector<std::string>, FindGroupIdsByTournamentId, (std::string tournamentId), (override));
+        MOCK_METHOD(std::vector<repository::MatchResult>, FindCompletedResultsByGroupId, (std::string groupId), (override));
+        MOCK_METHOD(std::vector<domain::Match>, SaveAll, (const std::vector<domain::Match>& matches), (override));
+    };
+
+    // Partido de playoffs ya terminado, enlazado con el siguiente
+    std::shared_ptr<domain::Match> CompletedPlayoffMatch(domain::MatchPhase phase, int number, const std::string& nextMatchId) {
+        auto match = std::make_shared<domain::Match>("tournament", phase, number);
+        match->Id() = "completed";
+        match->SetTeam1(Id(1).ToString());
+        match->SetTeam2(Id(2).ToString());
+        if (!nextMatchId.empty()) match->SetNextMatchId(nextMatchId);
+        return match;
+    }
+}
+
+// Prueba victorias, puntos a favor/en contra y el orden de la tabla de un grupo
+TEST(MatchEventHandlerTest, ComputeStandings_OrdersByWinsThenPoints) {
+    const std::vector<repository::MatchResult> results{
+        {Id(1), Id(2), 3, 1},
+        {Id(3), Id(4), 2, 2},
+        {Id(1), Id(3), 0, 1},
+        {Id(2), Id(4), 4, 0},
+        {Id(1), Id(4), 2, 0},
+        {Id(2), Id(3), 1, 0},
+    };
+
+    const auto standings = handlers::MatchEventHandler::ComputeStandings(results);
+
+    ASSERT_EQ(standings.size(), 4);
+    EXPECT_EQ(standings[0].teamId, repository::TeamKey(Id(2))); // 2 victorias, 6 a favor
+    EXPECT_EQ(standings[1].teamId, repository::TeamKey(Id(1))); // 2 victorias, 5 a favor
+    EXPECT_EQ(standings[2].teamId, repository::TeamKey(Id(3)));
+    EXPECT_EQ(standings[3].teamId, repository::TeamKey(Id(4)));
+    EXPECT_EQ(standings[2].draws, 1);
+    EXPECT_EQ(standings[3].matchesPlayed, 3);
+    EXPECT_EQ(standings[3].pointsAgainst, 8);
+}
+
+// Prueba que un empate en todos los criterios se resuelve por id y que sin resultados no hay tabla
+TEST(MatchEventHandlerTest, ComputeStandings_BreaksFullTiesById) {
+    const auto standings = handlers::MatchEventHandler::ComputeStandings({{Id(9), Id(5), 1, 1}});
+
+    ASSERT_EQ(standings.size(), 2);
+    EXPECT_EQ(standings[0].teamId, repository::TeamKey(Id(5)));
+    EXPECT_EQ(standings[1].teamId, repository::TeamKey(Id(9)));
+    EXPECT_TRUE(handlers::MatchEventHandler::ComputeStandings({}).empty());
+}
+
+// Prueba que los ids heredados que no son UUID ("team-1") siguen contando en la tabla, mezclados
+// con UUID, y que el desempate por id sigue el orden del texto
+TEST(MatchEventHandlerTest, ComputeStandings_CountsNonUuidTeamIds) {
+    const auto uuid = Id(1).ToString();
+    const std::vector<repository::MatchResult> results{
+        repository::MatchResult::FromText("team-b", "team-a", 2, 0),
+        repository::MatchResult::FromText("team-a", uuid, 1, 1),
+        repository::MatchResult::FromText(uuid, "team-b", 3, 0),
+    };
+
+    const auto standings = handlers::MatchEventHandler::ComputeStandings(results);
+
+    ASSERT_EQ(standings.size(), 3);
+    EXPECT_EQ(standings[0].teamId.ToString(), uuid); // 1 victoria, 4 a favor
+    EXPECT_EQ(standings[1].teamId.ToString(), "team-b"); // 1 victoria, 2 a favor
+    EXPECT_EQ(standings[2].teamId.ToString(), "team-a");
+    EXPECT_EQ(standings[2].draws, 1);
+    EXPECT_EQ(standings[2].matchesPlayed, 2);
+
+    // empate total: "0000..." va antes que "team-x" como en el orden del texto
+    const auto tied = handlers::MatchEventHandler::ComputeStandings({repository::MatchResult::FromText("team-x", uuid, 0, 0)});
+    ASSERT_EQ(tied.size(), 2);
+    EXPECT_EQ(tied[0].teamId.ToString(), uuid);
+    EXPECT_EQ(tied[1].teamId.ToString(), "team-x");
+}
+
+// Prueba que al cerrar la fase de grupos el cuadro se guarda enlazado: los partidos 2k-1 y 2k de
+// cada fase apuntan al k-ésimo de la siguiente y la final no apunta a ninguno
+TEST(MatchEventHandlerTest, GroupStageComplete_SavesLinkedPlayoffBracket) {
+    auto repository = std::make_shared<MockMatchRepository>();
+    std::vector<std::string> groupIds;
+    for (int group = 0; group < 8; group++) groupIds.push_back("group-" + std::to_string(group));
+
+    EXPECT_CALL(*repository, IsGroupStageComplete("tournament")).WillOnce(Return(true));
+    EXPECT_CALL(*repository, FindGroupIdsByTournamentId("tournament")).WillOnce(Return(groupIds));
+    for (int group = 0; group < 8; group++) {
+        EXPECT_CALL(*repository, FindCompletedResultsByGroupId(groupIds[group]))
+            .WillOnce(Return(std::vector<repository::MatchResult>{{Id(2 * group + 1), Id(2 * group + 2), 2, 1}}));
+    }
+    std::vector<domain::Match> saved;
+    EXPECT_CALL(*repository, SaveAll(_)).WillOnce(DoAll(SaveArg<0>(&saved), Return(std::vector<domain::Match>{})));
+
+    handlers::MatchEventHandler handler(repository);
+    handler.OnScoreRegistered(events::ScoreRegisteredEvent("group-match", "tournament", 2, 1, Id(1).ToString(), "GROUP_STAGE"));
+
+    ASSERT_EQ(saved.size(), 15);
+    std::map<std::pair<domain::MatchPhase, int>, const domain::Match*> byPosition;
+    for (const auto& match : saved) {
+        ASSERT_FALSE(match.Id().empty());
+        EXPECT_TRUE(byPosition.emplace(std::pair{match.Phase(), match.MatchNumber()}, &match).second);
+    }
+
+    const std::vector<std::pair<domain::MatchPhase, domain::MatchPhase>> rounds{
+        {domain::MatchPhase::ROUND_OF_16, domain::MatchPhase::QUARTERFINALS},
+        {domain::MatchPhase::QUARTERFINALS, domain::MatchPhase::SEMIFINALS},
+        {domain::MatchPhase::SEMIFINALS, domain::MatchPhase::FINALS},
+    };
+    for (const auto& [phase, nextPhase] : rounds) {
+        for (const auto& [position, match] : byPosition) {
+            if (position.first != phase) continue;
+            const auto next = byPosition.find({nextPhase, (position.second + 1) / 2});
+            ASSERT_NE(next, byPosition.end());
+            ASSERT_TRUE(match->NextMatchId().has_value()) << "partido " << position.second;
+            EXPECT_EQ(match->NextMatchId().value(), next->second->Id()) << "partido " << position.second;
+        }
+    }
+    const auto final = byPosition.find({domain::MatchPhase::FINALS, 1});
+    ASSERT_NE(final, byPosition.end());
+    EXPECT_FALSE(final->second->NextMatchId().has_value());
+}
+
+// Prueba que el ganador de un partido impar ocupa el lugar del equipo 1 del siguiente
+TEST(MatchEventHandlerTest, PlayoffWinner_OddMatchFillsTeam1) {
+    auto repository = std::make_shared<MockMatchRepository>();
+    EXPECT_CALL(*repository, ReadById("completed"))
+        .WillOnce(Return(CompletedPlayoffMatch(domain::MatchPhase::ROUND_OF_16, 3, "quarterfinal")));
+    EXPECT_CALL(*repository, ReadById("quarterfinal"))
+        .WillOnce(Return(std::make_shared<domain::Match>("tournament", domain::MatchPhase::QUARTERFINALS, 2)));
+    domain::Match updated;
+    EXPECT_CALL(*repository, Update(_)).WillOnce(DoAll(SaveArg<0>(&updated), Return("quarterfinal")));
+
+    handlers::MatchEventHandler handler(repository);
+    handler.OnScoreRegistered(events::ScoreRegisteredEvent("completed", "tournament", 1, 0, Id(1).ToString(), "ROUND_OF_16"));
+
+    EXPECT_EQ(updated.Team1Id(), Id(1).ToString());
+    EXPECT_FALSE(updated.Team2Id().has_value());
+}
+
+// Prueba que el ganador de un partido par ocupa el lugar del equipo 2 del siguiente
+TEST(MatchEventHandlerTest, PlayoffWinner_EvenMatchFillsTeam2) {
+    auto repository = std::make_shared<MockMatchRepository>();
+    EXPECT_CALL(*repository, ReadById("completed"))
+        .WillOnce(Return(CompletedPlayoffMatch(domain::MatchPhase::ROUND_OF_16, 4, "quarterfinal")));
+    EXPECT_CALL(*repository, ReadById("quarterfinal"))
+        .WillOnce(Return(std::make_shared<domain::Match>("tournament", domain::MatchPhase::QUARTERFINALS, 2)));
+    domain::Match updated;
+    EXPECT_CALL(*repository, Update(_)).WillOnce(DoAll(SaveArg<0>(&updated), Return("quarterfinal")));
+
+    handlers::MatchEventHandler handler(repository);
+    handler.OnScoreRegistered(events::ScoreRegisteredEvent("completed", "tournament", 0, 1, Id(2).ToString(), "ROUND_OF_16"));
+
+    EXPECT_FALSE(updated.Team1Id().has_value());
+    EXPECT_EQ(updated.Team2Id(), Id(2).ToString());
+}
+
+// Prueba que la final no avanza a nadie: ni lee otro partido ni actualiza
+TEST(MatchEventHandlerTest, FinalsWinner_DoesNotAdvance) {
+    auto repository = std::make_shared<MockMatchRepository>();
+    EXPECT_CALL(*repository, ReadById("completed"))
+        .WillOnce(Return(CompletedPlayoffMatch(domain::MatchPhase::FINALS, 1, "")));
+    EXPECT_CALL(*repository, Update(_)).Times(0);
+    EXPECT_CALL(*repository, Create(_)).Times(0);
+
+    handlers::MatchEventHandler handler(repository);
+    handler.OnScoreRegistered(events::ScoreRegisteredEvent("completed", "tournament", 3, 1, Id(1).ToString(), "FINALS"));
+}